@@ -317,6 +317,64 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive up to @p max messages at once.
+ *
+ * This function blocks until at least one message was received. Then it takes
+ * all messages available, up to @p max, from the message queue and from
+ * blocked senders within a single critical section. Senders unblocked this way
+ * only get scheduled after all messages were taken.
+ *
+ * The messages are stored in @p buf in the order they would have been
+ * returned by subsequent calls to @ref msg_receive().
+ *
+ * @param[out] buf  Pointer to a preallocated array of at least @p max
+ *                  ``msg_t`` structures, must not be NULL.
+ * @param[in] max   Maximum number of messages to receive, must be > 0.
+ *
+ * @return  Number of messages received, at least 1.
+ */
+int msg_receive_bulk(msg_t *buf, unsigned max);
+
+/**
+ * @brief Send multiple messages to the same thread at once (blocking).
+ *
+ * The messages are delivered in order within a single critical section, as
+ * far as the receiver is waiting or has space left in its message queue. The
+ * context switch to a higher priority receiver happens only afterwards.
+ * Messages that do not fit are sent one by one with @ref msg_send(), so this
+ * function blocks until all messages were delivered. If called from an
+ * interrupt, this function will never block.
+ *
+ * @param[in] m             Pointer to an array of @p num preallocated
+ *                          ``msg_t`` structures, must not be NULL.
+ * @param[in] num           Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  Number of messages delivered directly or to the queue. Only less
+ *          than @p num if called from an interrupt or the receiver is the
+ *          current thread and its message queue is full.
+ * @return  -1, on error (invalid PID)
+ */
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
+/**
+ * @brief Send multiple messages to the same thread at once (non-blocking).
+ *
+ * Like @ref msg_send_bulk(), but stops when the receiver can not accept any
+ * more messages instead of blocking.
+ *
+ * @param[in] m             Pointer to an array of @p num preallocated
+ *                          ``msg_t`` structures, must not be NULL.
+ * @param[in] num           Number of messages in @p m.
+ * @param[in] target_pid    PID of target thread
+ *
+ * @return  Number of messages delivered directly or to the queue, counted
+ *          from the start of @p m
+ * @return  -1, on error (invalid PID)
+ */
+int msg_try_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid);
+
 /**
  * @brief Send a message, block until reply received.
  *
@@ -344,6 +344,25 @@ static inline void sched_runq_advance(uint8_t prio)
 extern void sched_runq_callback(uint8_t prio);
 #endif
 
+#if (IS_USED(MODULE_SCHED_WAKEUP_CALLBACK)) || defined(DOXYGEN)
+/**
+ * @brief   Scheduler wake-up callback
+ *
+ * @details Function has to be provided by the user of this API.
+ *          It will be called by sched_set_status() whenever a thread that
+ *          was not runnable enters its runqueue, e.g. when it is unblocked.
+ *          It may be called from interrupt context and with interrupts
+ *          disabled.
+ *
+ * @warning This API is not intended for out of tree users.
+ *          Breaking API changes will be done without notice and
+ *          without deprecation. Consider yourself warned!
+ *
+ * @param   thread    the thread that became runnable
+ */
+extern void sched_wakeup_callback(thread_t *thread);
+#endif
+
 /**
  * @brief   Tell if the number of threads in a runqueue is 0
  *
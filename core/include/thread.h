@@ -179,6 +179,11 @@ struct _thread {
 #endif
 
     clist_node_t rq_entry;          /**< run queue entry                */
+#if defined(MODULE_CORE_WAITQ_BUCKETS) || defined(DOXYGEN)
+    thread_t *wq_tail;              /**< last waiting thread of this
+                                         priority if first of it in a
+                                         waiter list, else NULL         */
+#endif
 
 #if defined(MODULE_CORE_MSG) || defined(MODULE_CORE_THREAD_FLAGS) \
     || defined(MODULE_CORE_MBOX) || defined(DOXYGEN)
@@ -437,6 +442,12 @@ char *thread_stack_init(thread_task_func_t task_func, void *arg,
  * It reuses the thread's rq_entry field.
  * Used internally by msg and mutex implementations.
  *
+ * Threads of the same priority are kept in the order they were added. With
+ * the module `core_waitq_buckets`, this takes time linear in the number of
+ * distinct priorities in @p list instead of the number of threads in it.
+ * Threads added must then only be removed with
+ * @ref thread_remove_head_from_list and @ref thread_remove_from_list.
+ *
  * @note Only use for threads *not on any runqueue* and with interrupts
  *       disabled.
  *
@@ -445,6 +456,44 @@ char *thread_stack_init(thread_task_func_t task_func, void *arg,
  */
 void thread_add_to_list(list_node_t *list, thread_t *thread);
 
+#if IS_USED(MODULE_CORE_WAITQ_BUCKETS) || defined(DOXYGEN)
+/**
+ * @brief Remove the first thread from a list filled by
+ *        @ref thread_add_to_list (internal)
+ *
+ * @note Only use with interrupts disabled.
+ *
+ * @param[in] list      ptr to list root node
+ *
+ * @return  the rq_entry of the removed thread
+ * @return  NULL if @p list is empty
+ */
+list_node_t *thread_remove_head_from_list(list_node_t *list);
+
+/**
+ * @brief Remove a thread from a list filled by @ref thread_add_to_list
+ *        (internal)
+ *
+ * @note Only use with interrupts disabled.
+ *
+ * @param[in] list      ptr to list root node
+ * @param[in] thread    thread to remove
+ *
+ * @return  true if @p thread was in @p list and was removed
+ */
+bool thread_remove_from_list(list_node_t *list, thread_t *thread);
+#else
+static inline list_node_t *thread_remove_head_from_list(list_node_t *list)
+{
+    return list_remove_head(list);
+}
+
+static inline bool thread_remove_from_list(list_node_t *list, thread_t *thread)
+{
+    return list_remove(list, (list_node_t *)&thread->rq_entry) != NULL;
+}
+#endif
+
 /**
  * @brief Returns the name of a process
  *
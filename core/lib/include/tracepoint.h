@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    core_util_tracepoint Static tracepoints
+ * @ingroup     core_util
+ * @brief       Static tracepoints recorded by the @ref sys_trace module
+ *
+ * The kernel and some system modules contain static tracepoints at the places
+ * that matter for finding latency problems: context switches, threads
+ * becoming runnable, message passing, contended mutexes, GNRC netapi and
+ * ztimer. Each tracepoint records a typed event with two arguments, see
+ * @ref trace_event_id_t.
+ *
+ * The tracepoints compile to nothing unless the module `tracepoints` is used,
+ * which also pulls in @ref sys_trace to record the events.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Static tracepoint definitions
+ */
+
+#include <stdint.h>
+
+#include "kernel_defines.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Trace event types
+ *
+ * The arguments of the events are listed as `arg0`, `arg1`, unlisted
+ * arguments are 0.
+ */
+typedef enum {
+    TRACE_EVENT_USER = 0,           /**< trace() called, arg0: user value */
+    TRACE_EVENT_DROPPED,            /**< events were lost because the trace
+                                         buffer was full, arg0: number of
+                                         lost events */
+    TRACE_EVENT_SCHED_SWITCH,       /**< context switch, arg0: pid of the
+                                         previous thread, arg1: pid of the
+                                         next thread */
+    TRACE_EVENT_SCHED_WAKEUP,       /**< thread became runnable, arg0: pid,
+                                         arg1: priority */
+    TRACE_EVENT_MSG_SEND,           /**< message sent, arg0: target pid,
+                                         arg1: message type */
+    TRACE_EVENT_MSG_RECV,           /**< message received, arg0: sender pid,
+                                         arg1: message type */
+    TRACE_EVENT_MUTEX_BLOCK,        /**< thread blocks on a locked mutex,
+                                         arg0: mutex */
+    TRACE_EVENT_MUTEX_RESUME,       /**< blocked thread got the mutex (or the
+                                         locking was cancelled), arg0: mutex */
+    TRACE_EVENT_MUTEX_HANDOVER,     /**< mutex unlocked with a thread waiting,
+                                         arg0: mutex, arg1: pid of the waiter */
+    TRACE_EVENT_NETAPI_SEND,        /**< GNRC netapi packet passed on, arg0:
+                                         target pid, arg1: netapi message
+                                         type */
+    TRACE_EVENT_NETAPI_DISPATCH,    /**< GNRC netapi dispatch, arg0:
+                                         @ref gnrc_nettype_t, arg1: demux
+                                         context */
+    TRACE_EVENT_ZTIMER_SET,         /**< ztimer set, arg0: timer, arg1:
+                                         timeout in ticks of its clock */
+    TRACE_EVENT_ZTIMER_FIRE,        /**< ztimer callback called, arg0: timer */
+    TRACE_EVENT_NUMOF,              /**< number of predefined event types */
+    TRACE_EVENT_APP = 0x100,        /**< first event type free for use by the
+                                         application */
+} trace_event_id_t;
+
+/**
+ * @brief   Records an event in the trace buffer
+ *
+ * Can be called from any context. Provided by @ref sys_trace.
+ *
+ * @param[in]   id      type of the event, see @ref trace_event_id_t
+ * @param[in]   arg0    first argument of the event
+ * @param[in]   arg1    second argument of the event
+ */
+void trace_event(uint16_t id, uint32_t arg0, uint32_t arg1);
+
+#if IS_USED(MODULE_TRACEPOINTS) || defined(DOXYGEN)
+/**
+ * @brief   Static tracepoint
+ *
+ * Records an event when the module `tracepoints` is used, does nothing
+ * otherwise. Pointers are recorded as their lower 32 bits.
+ *
+ * @param[in]   id      type of the event, see @ref trace_event_id_t
+ * @param[in]   arg0    first argument of the event
+ * @param[in]   arg1    second argument of the event
+ */
+#define TRACEPOINT(id, arg0, arg1) \
+    trace_event((id), (uint32_t)(uintptr_t)(arg0), (uint32_t)(uintptr_t)(arg1))
+#else
+#define TRACEPOINT(id, arg0, arg1) do { (void)(arg0); (void)(arg1); } while (0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
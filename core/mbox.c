@@ -61,7 +61,7 @@ int _mbox_put(mbox_t *mbox, msg_t *msg, int blocking)
 {
     unsigned irqstate = irq_disable();
 
-    list_node_t *next = list_remove_head(&mbox->readers);
+    list_node_t *next = thread_remove_head_from_list(&mbox->readers);
 
     if (next) {
         DEBUG("mbox: Thread %" PRIkernel_pid " mbox 0x%08" PRIxPTR ": _tryput(): "
@@ -103,7 +103,7 @@ int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking)
               "got queued message.\n", thread_getpid(), (uintptr_t)mbox);
         /* copy msg from queue */
         *msg = mbox->msg_array[cib_get_unsafe(&mbox->cib)];
-        list_node_t *next = list_remove_head(&mbox->writers);
+        list_node_t *next = thread_remove_head_from_list(&mbox->writers);
         if (next) {
             thread_t *thread = container_of((clist_node_t *)next, thread_t,
                                             rq_entry);
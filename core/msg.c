@@ -35,6 +35,7 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#include "tracepoint.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -105,6 +106,8 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block,
         return -1;
     }
 
+    TRACEPOINT(TRACE_EVENT_MSG_SEND, target_pid, m->type);
+
     thread_t *me = thread_get_active();
 
     DEBUG("msg_send() %s:%i: Sending from %" PRIkernel_pid " to %" PRIkernel_pid
@@ -209,6 +212,8 @@ static int _msg_send_oneway(msg_t *m, kernel_pid_t target_pid)
         return -1;
     }
 
+    TRACEPOINT(TRACE_EVENT_MSG_SEND, target_pid, m->type);
+
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", __func__, thread_getpid(), target_pid);
@@ -274,6 +279,86 @@ int msg_send_bus(msg_t *m, msg_bus_t *bus)
     return count;
 }
 
+static int _msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid,
+                          bool block)
+{
+#ifdef DEVELHELP
+    if (!pid_is_valid(target_pid)) {
+        DEBUG("%s: target_pid is invalid, continuing anyways\n", __func__);
+    }
+#endif /* DEVELHELP */
+
+    const bool in_irq = irq_is_in();
+    kernel_pid_t sender_pid = in_irq ? KERNEL_PID_ISR : thread_getpid();
+    unsigned n = 0;
+
+    unsigned state = irq_disable();
+    thread_t *target = thread_get_unchecked(target_pid);
+
+    if (target == NULL) {
+        DEBUG("%s: target thread %d does not exist\n", __func__, target_pid);
+        irq_restore(state);
+        return -1;
+    }
+
+    if ((num > 0) && (target->status == STATUS_RECEIVE_BLOCKED)) {
+        DEBUG("%s: Direct msg copy from %" PRIkernel_pid " to %"
+              PRIkernel_pid ".\n", __func__, sender_pid, target_pid);
+        m[0].sender_pid = sender_pid;
+        *((msg_t *)target->wait_data) = m[0];
+        sched_set_status(target, STATUS_PENDING);
+        n++;
+    }
+
+    /* the receiver runs only after all of these got queued */
+    for (; n < num; n++) {
+        m[n].sender_pid = sender_pid;
+        if (!queue_msg(target, &m[n])) {
+            break;
+        }
+    }
+    DEBUG("%s: delivered %u of %u messages to %" PRIkernel_pid "\n",
+          __func__, n, num, target_pid);
+    for (unsigned i = 0; i < n; i++) {
+        TRACEPOINT(TRACE_EVENT_MSG_SEND, target_pid, m[i].type);
+    }
+
+    if (in_irq) {
+        if (n > 0) {
+            sched_context_switch_request = 1;
+        }
+        irq_restore(state);
+        return n;
+    }
+
+    irq_restore(state);
+
+    if (block && (n < num)) {
+        /* receiver can't take more right now, hand over the remaining
+         * messages one by one */
+        for (; n < num; n++) {
+            if (msg_send(&m[n], target_pid) < 1) {
+                break;
+            }
+        }
+    }
+    else if (n > 0) {
+        thread_yield_higher();
+    }
+
+    return n;
+}
+
+int msg_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    return _msg_send_bulk(m, num, target_pid, true);
+}
+
+int msg_try_send_bulk(msg_t *m, unsigned num, kernel_pid_t target_pid)
+{
+    return _msg_send_bulk(m, num, target_pid, false);
+}
+
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(thread_getpid() != target_pid);
@@ -345,12 +430,20 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res == 1) {
+        TRACEPOINT(TRACE_EVENT_MSG_RECV, m->sender_pid, m->type);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    TRACEPOINT(TRACE_EVENT_MSG_RECV, m->sender_pid, m->type);
+    return res;
 }
 
 static int _msg_receive(msg_t *m, int block)
@@ -383,7 +476,7 @@ static int _msg_receive(msg_t *m, int block)
         me->wait_data = (void *)m;
     }
 
-    list_node_t *next = list_remove_head(&me->msg_waiters);
+    list_node_t *next = thread_remove_head_from_list(&me->msg_waiters);
 
     if (next == NULL) {
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): No thread in "
@@ -442,6 +535,81 @@ static int _msg_receive(msg_t *m, int block)
     DEBUG("This should have never been reached!\n");
 }
 
+int msg_receive_bulk(msg_t *buf, unsigned max)
+{
+    assert(max > 0);
+
+    unsigned state = irq_disable();
+    thread_t *me = thread_get_active();
+    bool has_queue = thread_has_msg_queue(me);
+    uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+    unsigned n = 0;
+    int queue_index;
+
+    /* queued messages were sent before those of any waiting thread */
+    while (has_queue && (n < max) &&
+           ((queue_index = cib_get(&(me->msg_queue))) >= 0)) {
+        buf[n++] = me->msg_array[queue_index];
+    }
+
+    /* take the messages of waiting threads, first into buf, then into the
+     * just freed queue space */
+    while (me->msg_waiters.next) {
+        msg_t *dest;
+
+        if (n < max) {
+            dest = &buf[n++];
+        }
+        else if (has_queue &&
+                 ((queue_index = cib_put(&(me->msg_queue))) >= 0)) {
+            dest = &me->msg_array[queue_index];
+        }
+        else {
+            break;
+        }
+
+        thread_t *sender = container_of(
+            (clist_node_t *)thread_remove_head_from_list(&me->msg_waiters),
+            thread_t, rq_entry);
+
+        *dest = *((msg_t *)sender->wait_data);
+
+        if (sender->status != STATUS_REPLY_BLOCKED) {
+            sender->wait_data = NULL;
+            sched_set_status(sender, STATUS_PENDING);
+            if (sender->priority < sender_prio) {
+                sender_prio = sender->priority;
+            }
+        }
+    }
+
+    if (n == 0) {
+        DEBUG("msg_receive_bulk(): %" PRIkernel_pid ": No msg available. "
+              "Going blocked.\n", thread_getpid());
+        me->wait_data = buf;
+        sched_set_status(me, STATUS_RECEIVE_BLOCKED);
+
+        irq_restore(state);
+        thread_yield_higher();
+
+        /* sender copied message */
+        assert(thread_get_active()->status != STATUS_RECEIVE_BLOCKED);
+        TRACEPOINT(TRACE_EVENT_MSG_RECV, buf[0].sender_pid, buf[0].type);
+        return 1;
+    }
+
+    DEBUG("msg_receive_bulk(): %" PRIkernel_pid ": got %u messages\n",
+          thread_getpid(), n);
+    irq_restore(state);
+    for (unsigned i = 0; i < n; i++) {
+        TRACEPOINT(TRACE_EVENT_MSG_RECV, buf[i].sender_pid, buf[i].type);
+    }
+    if (sender_prio < THREAD_PRIORITY_IDLE) {
+        sched_switch(sender_prio);
+    }
+    return n;
+}
+
 static unsigned _msg_avail(thread_t *thread)
 {
     DEBUG("msg_available: %" PRIkernel_pid ": msg_available.\n",
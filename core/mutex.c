@@ -30,6 +30,7 @@
 #include "sched.h"
 #include "irq.h"
 #include "list.h"
+#include "tracepoint.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -65,16 +66,14 @@ void _block(mutex_t *mutex,
     /* Fail visibly even if a blocking action is called from somewhere where
      * it's subtly not allowed, eg. board_init */
     assert(me != NULL);
+    TRACEPOINT(TRACE_EVENT_MUTEX_BLOCK, mutex, 0);
     DEBUG("PID[%" PRIkernel_pid "] mutex_lock() Adding node to mutex queue: "
           "prio: %" PRIu32 "\n", thread_getpid(), (uint32_t)me->priority);
     sched_set_status(me, STATUS_MUTEX_BLOCKED);
     if (mutex->queue.next == MUTEX_LOCKED) {
-        mutex->queue.next = (list_node_t *)&me->rq_entry;
-        mutex->queue.next->next = NULL;
-    }
-    else {
-        thread_add_to_list(&mutex->queue, me);
+        mutex->queue.next = NULL;
     }
+    thread_add_to_list(&mutex->queue, me);
 
 #ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
     thread_t *owner = thread_get(mutex->owner);
@@ -90,6 +89,7 @@ void _block(mutex_t *mutex,
     irq_restore(irq_state);
     thread_yield_higher();
     /* We were woken up by scheduler. Waker removed us from queue. */
+    TRACEPOINT(TRACE_EVENT_MUTEX_RESUME, mutex, 0);
 #if IS_USED(MODULE_CORE_MUTEX_DEBUG)
     mutex->owner_calling_pc = pc;
 #endif
@@ -204,12 +204,13 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
-    list_node_t *next = list_remove_head(&mutex->queue);
+    list_node_t *next = thread_remove_head_from_list(&mutex->queue);
 
     thread_t *process = container_of((clist_node_t *)next, thread_t, rq_entry);
 
     DEBUG("PID[%" PRIkernel_pid "] mutex_unlock(): waking up waiting thread %"
           PRIkernel_pid "\n", thread_getpid(),  process->pid);
+    TRACEPOINT(TRACE_EVENT_MUTEX_HANDOVER, mutex, process->pid);
     sched_set_status(process, STATUS_PENDING);
 
     if (!mutex->queue.next) {
@@ -244,11 +245,12 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             mutex->queue.next = NULL;
         }
         else {
-            list_node_t *next = list_remove_head(&mutex->queue);
+            list_node_t *next = thread_remove_head_from_list(&mutex->queue);
             thread_t *process = container_of((clist_node_t *)next, thread_t,
                                              rq_entry);
             DEBUG("PID[%" PRIkernel_pid "] mutex_unlock_and_sleep(): waking up "
                   "waiter.\n", process->pid);
+            TRACEPOINT(TRACE_EVENT_MUTEX_HANDOVER, mutex, process->pid);
             sched_set_status(process, STATUS_PENDING);
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
@@ -281,7 +283,7 @@ void mutex_cancel(mutex_cancel_t *mc)
 
     if ((mutex->queue.next != MUTEX_LOCKED)
         && (mutex->queue.next != NULL)
-        && list_remove(&mutex->queue, (list_node_t *)&thread->rq_entry)) {
+        && thread_remove_from_list(&mutex->queue, thread)) {
         /* Thread was queued and removed from list, wake it up */
         if (mutex->queue.next == NULL) {
             mutex->queue.next = MUTEX_LOCKED;
@@ -30,6 +30,7 @@
 #include "log.h"
 #include "sched.h"
 #include "thread.h"
+#include "tracepoint.h"
 #include "panic.h"
 
 #ifdef MODULE_MPU_STACK_GUARD
@@ -152,6 +153,8 @@ thread_t *__attribute__((used)) sched_run(void)
     if (!IS_USED(MODULE_CORE_IDLE_THREAD) && !runqueue_bitcache) {
         if (active_thread) {
             _unschedule(active_thread);
+            TRACEPOINT(TRACE_EVENT_SCHED_SWITCH, active_thread->pid,
+                       KERNEL_PID_UNDEF);
             active_thread = NULL;
         }
 
@@ -180,6 +183,10 @@ thread_t *__attribute__((used)) sched_run(void)
     next_thread->status = STATUS_RUNNING;
 
     if (previous_thread == next_thread) {
+        if (!active_thread) {
+            TRACEPOINT(TRACE_EVENT_SCHED_SWITCH, KERNEL_PID_UNDEF,
+                       next_thread->pid);
+        }
 #ifdef MODULE_SCHED_CB
         /* Call the sched callback again only if the active thread is NULL. When
          * active_thread is NULL, there was a sleep in between descheduling the
@@ -198,6 +205,10 @@ thread_t *__attribute__((used)) sched_run(void)
             _unschedule(active_thread);
         }
 
+        TRACEPOINT(TRACE_EVENT_SCHED_SWITCH,
+                   active_thread ? active_thread->pid : KERNEL_PID_UNDEF,
+                   next_thread->pid);
+
         sched_active_pid = next_thread->pid;
         sched_active_thread = next_thread;
 
@@ -267,6 +278,11 @@ void sched_set_status(thread_t *process, thread_status_t status)
     if (status >= STATUS_ON_RUNQUEUE) {
         if (!(process->status >= STATUS_ON_RUNQUEUE)) {
             _runqueue_push(process, process->priority);
+            TRACEPOINT(TRACE_EVENT_SCHED_WAKEUP, process->pid,
+                       process->priority);
+#if (IS_USED(MODULE_SCHED_WAKEUP_CALLBACK))
+            sched_wakeup_callback(process);
+#endif
         }
     }
     else {
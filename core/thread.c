@@ -160,6 +160,7 @@ void thread_yield(void)
     thread_yield_higher();
 }
 
+#if !IS_USED(MODULE_CORE_WAITQ_BUCKETS)
 /*
  * Example of insertion operations in the linked list
  *   thread_add_to_list(list,new_node) //Prio4
@@ -203,6 +204,103 @@ void thread_add_to_list(list_node_t *list, thread_t *thread)
     list->next = new_node;
 }
 
+#else /* MODULE_CORE_WAITQ_BUCKETS */
+
+/*
+ * The waiting threads of one priority form a bucket in the list. The first
+ * thread of a bucket points to the last one with wq_tail, so a thread is
+ * added by skipping whole buckets: the time spent with interrupts disabled
+ * only depends on the number of distinct priorities waiting (at most
+ * SCHED_PRIO_LEVELS), not on the number of waiting threads.
+ *
+ * The first thread of a bucket is the one with wq_tail set, not the one with
+ * a different priority than the thread before it, so the buckets stay intact
+ * when the priority of a waiting thread is changed.
+ */
+static inline thread_t *_list_entry(list_node_t *node)
+{
+    return container_of((clist_node_t *)node, thread_t, rq_entry);
+}
+
+void thread_add_to_list(list_node_t *list, thread_t *thread)
+{
+    assert(thread->status < STATUS_ON_RUNQUEUE);
+
+    uint16_t my_prio = thread->priority;
+    list_node_t *new_node = (list_node_t *)&thread->rq_entry;
+    thread_t *first = NULL;
+
+    while (list->next) {
+        first = _list_entry(list->next);
+        if (first->priority >= my_prio) {
+            break;
+        }
+        list = (list_node_t *)&first->wq_tail->rq_entry;
+        first = NULL;
+    }
+
+    if (first && (first->priority == my_prio)) {
+        /* append to the bucket of my priority */
+        list = (list_node_t *)&first->wq_tail->rq_entry;
+        first->wq_tail = thread;
+        thread->wq_tail = NULL;
+    }
+    else {
+        /* start a bucket before the one of lower priority, if any */
+        thread->wq_tail = thread;
+    }
+
+    new_node->next = list->next;
+    list->next = new_node;
+}
+
+list_node_t *thread_remove_head_from_list(list_node_t *list)
+{
+    list_node_t *head = list_remove_head(list);
+
+    if (head) {
+        thread_t *thread = _list_entry(head);
+
+        if (thread->wq_tail != thread) {
+            /* the next thread is the first of the bucket now */
+            _list_entry(list->next)->wq_tail = thread->wq_tail;
+        }
+        thread->wq_tail = NULL;
+    }
+
+    return head;
+}
+
+bool thread_remove_from_list(list_node_t *list, thread_t *thread)
+{
+    list_node_t *node = (list_node_t *)&thread->rq_entry;
+    thread_t *first = NULL;
+
+    for (; list->next; list = list->next) {
+        thread_t *entry = _list_entry(list->next);
+
+        if (entry->wq_tail) {
+            first = entry;
+        }
+        if (entry != thread) {
+            continue;
+        }
+
+        if (first == thread) {
+            thread_remove_head_from_list(list);
+            return true;
+        }
+        if (first->wq_tail == thread) {
+            first->wq_tail = _list_entry(list);
+        }
+        list->next = node->next;
+        return true;
+    }
+
+    return false;
+}
+#endif /* MODULE_CORE_WAITQ_BUCKETS */
+
 uintptr_t measure_stack_free_internal(const char *stack, size_t size)
 {
     /* Alignment of stack has been fixed (if needed) by thread_create(), so
@@ -201,7 +201,7 @@ BaseType_t IRAM_ATTR xQueueReset( QueueHandle_t xQueue )
     }
 
     /* otherwise unlock the waiting sending thread */
-    list_node_t *next = list_remove_head(&queue->sending);
+    list_node_t *next = thread_remove_head_from_list(&queue->sending);
     thread_t *proc = container_of((clist_node_t*)next, thread_t, rq_entry);
     sched_set_status(proc, STATUS_PENDING);
 
@@ -243,8 +243,7 @@ static void _queue_timeout(void *arg)
     vTaskEnterCritical(0);
 
     /* remove the thread from the waiting queue */
-    list_node_t *node = (list_node_t *)&(wtd->thread->rq_entry);
-    list_remove(wtd->queue, node);
+    thread_remove_from_list(wtd->queue, wtd->thread);
 
     /* unblock the waintg thread */
     sched_set_status(wtd->thread, STATUS_PENDING);
@@ -307,7 +306,7 @@ BaseType_t IRAM_ATTR _queue_generic_send(QueueHandle_t xQueue,
 
             /* unlock waiting receiving thread */
             if (queue->receiving.next != NULL) {
-                list_node_t *next = list_remove_head(&queue->receiving);
+                list_node_t *next = thread_remove_head_from_list(&queue->receiving);
                 thread_t *proc = container_of((clist_node_t*)next, thread_t, rq_entry);
                 sched_set_status(proc, STATUS_PENDING);
                 ctx_switch = proc->priority < thread_get_priority(thread_get_active());
@@ -434,7 +433,7 @@ BaseType_t IRAM_ATTR _queue_generic_recv (QueueHandle_t xQueue,
             }
 
             /* otherwise unlock the waiting sending thread */
-            list_node_t *next = list_remove_head(&queue->sending);
+            list_node_t *next = thread_remove_head_from_list(&queue->sending);
             thread_t *proc = container_of((clist_node_t*)next, thread_t, rq_entry);
             sched_set_status(proc, STATUS_PENDING);
 
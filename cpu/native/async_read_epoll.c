@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @file
+ * @brief   Multiple asynchronous read on file descriptors, using epoll
+ * @ingroup cpu_native
+ *
+ * All file descriptors are registered one-shot with a single epoll instance.
+ * On SIGIO, only the callbacks of the file descriptors epoll reports ready
+ * are run, instead of polling every file descriptor. A reported file
+ * descriptor is not watched again until native_async_read_continue() is
+ * called for it, then it is reported again right away if it still has data.
+ *
+ * File descriptors added with native_async_read_add_handler() raise SIGIO
+ * themselves (O_ASYNC). For the ones added with
+ * native_async_read_add_int_handler(), which may not support O_ASYNC, a host
+ * thread waits on a second epoll instance and raises SIGIO for them, instead
+ * of a fork()ed process per file descriptor. The host thread has all signals
+ * blocked, so signals keep being handled in the RIOT process context. It is
+ * only started with the first such file descriptor and is stopped via an
+ * eventfd on cleanup.
+ */
+
+#include <dlfcn.h>
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "async_read.h"
+#include "container.h"
+#include "irq.h"
+#include "native_internal.h"
+
+/* epoll data of the eventfd stopping the host thread */
+#define _STOP_INDEX     (ASYNC_READ_NUMOF)
+
+typedef struct {
+    int fd;                             /**< watched fd, -1 if unused */
+    bool by_thread;                     /**< watched by the host thread */
+    native_async_read_callback_t cb;    /**< callback */
+    void *arg;                          /**< argument of @ref cb */
+} _poller_t;
+
+static int _epoll_fd = -1;
+static int _thread_epoll_fd = -1;
+static int _stop_fd = -1;
+static _poller_t _pollers[ASYNC_READ_NUMOF];
+
+static void _async_io_isr(void)
+{
+    struct epoll_event events[ASYNC_READ_NUMOF];
+    int n = epoll_wait(_epoll_fd, events, ARRAY_SIZE(events), 0);
+
+    for (int i = 0; i < n; i++) {
+        _poller_t *poller = &_pollers[events[i].data.u32];
+
+        if (poller->fd >= 0) {
+            poller->cb(poller->fd, poller->arg);
+        }
+    }
+}
+
+static void *_io_thread(void *arg)
+{
+    (void)arg;
+    struct epoll_event events[ASYNC_READ_NUMOF + 1];
+
+    while (1) {
+        int n = epoll_wait(_thread_epoll_fd, events, ARRAY_SIZE(events), -1);
+
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            /* err() of RIOT is not usable outside of the RIOT process context */
+            kill(_native_pid, SIGKILL);
+            return NULL;
+        }
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.u32 == _STOP_INDEX) {
+                return NULL;
+            }
+        }
+        if (n) {
+            /* the fds are reported to _async_io_isr() by _epoll_fd */
+            kill(_native_pid, SIGIO);
+        }
+    }
+}
+
+static void _start_thread(void)
+{
+    if ((_thread_epoll_fd = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+        err(EXIT_FAILURE, "native_async_read: epoll_create1");
+    }
+    if ((_stop_fd = eventfd(0, EFD_CLOEXEC)) == -1) {
+        err(EXIT_FAILURE, "native_async_read: eventfd");
+    }
+
+    struct epoll_event event = { .events = EPOLLIN, .data.u32 = _STOP_INDEX };
+    if (epoll_ctl(_thread_epoll_fd, EPOLL_CTL_ADD, _stop_fd, &event) == -1) {
+        err(EXIT_FAILURE, "native_async_read: epoll_ctl");
+    }
+
+    /* RIOT may provide a pthread_create() of its own */
+    int (*create)(pthread_t *, const pthread_attr_t *, void *(*)(void *), void *);
+    *(void **)(&create) = dlsym(RTLD_NEXT, "pthread_create");
+    if (!create) {
+        errx(EXIT_FAILURE, "native_async_read: no pthread_create()");
+    }
+
+    /* the host thread inherits the signal mask with all signals blocked */
+    pthread_t thread;
+    unsigned state = irq_disable();
+    int res = create(&thread, NULL, _io_thread, NULL);
+    irq_restore(state);
+    if (res) {
+        errx(EXIT_FAILURE, "native_async_read: pthread_create: %d", res);
+    }
+}
+
+static void _arm(int epoll_fd, unsigned index, int op)
+{
+    struct epoll_event event = {
+        .events = EPOLLIN | EPOLLPRI | EPOLLONESHOT,
+        .data.u32 = index,
+    };
+
+    if (epoll_ctl(epoll_fd, op, _pollers[index].fd, &event) == -1) {
+        err(EXIT_FAILURE, "native_async_read: epoll_ctl");
+    }
+}
+
+void native_async_read_setup(void)
+{
+    native_register_interrupt(SIGIO, _async_io_isr);
+
+    if (_epoll_fd >= 0) {
+        return;
+    }
+
+    for (unsigned i = 0; i < ASYNC_READ_NUMOF; i++) {
+        _pollers[i].fd = -1;
+    }
+    if ((_epoll_fd = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+        err(EXIT_FAILURE, "native_async_read_setup: epoll_create1");
+    }
+}
+
+void native_async_read_cleanup(void)
+{
+    native_unregister_interrupt(SIGIO);
+
+    if (_stop_fd >= 0) {
+        uint64_t stop = 1;
+        real_write(_stop_fd, &stop, sizeof(stop));
+    }
+
+    for (unsigned i = 0; i < ASYNC_READ_NUMOF; i++) {
+        /* don't close stdin */
+        if ((_pollers[i].fd >= 0) && (_pollers[i].fd != STDIN_FILENO)) {
+            real_close(_pollers[i].fd);
+        }
+    }
+}
+
+void native_async_read_continue(int fd)
+{
+    /* handle a SIGIO raised here when done */
+    _native_syscall_enter();
+
+    for (unsigned i = 0; i < ASYNC_READ_NUMOF; i++) {
+        if (_pollers[i].fd != fd) {
+            continue;
+        }
+
+        _arm(_epoll_fd, i, EPOLL_CTL_MOD);
+        if (_pollers[i].by_thread) {
+            _arm(_thread_epoll_fd, i, EPOLL_CTL_MOD);
+        }
+        else {
+            /* O_ASYNC only signals new data, not data left over */
+            struct pollfd pfd = { .fd = fd, .events = POLLIN | POLLPRI };
+            if (real_poll(&pfd, 1, 0) == 1) {
+                kill(_native_pid, SIGIO);
+            }
+        }
+    }
+
+    _native_syscall_leave();
+}
+
+static void _add_handler(int fd, void *arg, native_async_read_callback_t handler,
+                         bool by_thread)
+{
+    unsigned i;
+
+    for (i = 0; (i < ASYNC_READ_NUMOF) && (_pollers[i].fd >= 0); i++) { }
+    if (i == ASYNC_READ_NUMOF) {
+        errx(EXIT_FAILURE, "native_async_read_add_handler(): too many callbacks");
+    }
+
+    _pollers[i].fd = fd;
+    _pollers[i].by_thread = by_thread;
+    _pollers[i].cb = handler;
+    _pollers[i].arg = arg;
+    _arm(_epoll_fd, i, EPOLL_CTL_ADD);
+    if (by_thread) {
+        if (_thread_epoll_fd < 0) {
+            _start_thread();
+        }
+        _arm(_thread_epoll_fd, i, EPOLL_CTL_ADD);
+    }
+}
+
+void native_async_read_add_handler(int fd, void *arg, native_async_read_callback_t handler)
+{
+    /* configure fds to send signals on io */
+    if (real_fcntl(fd, F_SETOWN, _native_pid) == -1) {
+        err(EXIT_FAILURE, "native_async_read_add_handler(): fcntl(F_SETOWN)");
+    }
+    /* set file access mode to non-blocking */
+    if (real_fcntl(fd, F_SETFL, O_NONBLOCK | O_ASYNC) == -1) {
+        err(EXIT_FAILURE, "native_async_read_add_handler(): fcntl(F_SETFL)");
+    }
+
+    _add_handler(fd, arg, handler, false);
+}
+
+void native_async_read_remove_handler(int fd)
+{
+    for (unsigned i = 0; i < ASYNC_READ_NUMOF; i++) {
+        if (_pollers[i].fd != fd) {
+            continue;
+        }
+
+        if (!_pollers[i].by_thread) {
+            int res = real_fcntl(fd, F_GETFL);
+            if (res < 0) {
+                err(EXIT_FAILURE, "native_async_read_remove_handler(): fcntl(F_GETFL)");
+            }
+            if (real_fcntl(fd, F_SETFL, (unsigned)res & ~O_ASYNC) < 0) {
+                err(EXIT_FAILURE, "native_async_read_remove_handler(): fcntl(F_SETFL)");
+            }
+        }
+        else {
+            epoll_ctl(_thread_epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+        }
+        epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+        _pollers[i].fd = -1;
+    }
+}
+
+void native_async_read_add_int_handler(int fd, void *arg, native_async_read_callback_t handler)
+{
+    _add_handler(fd, arg, handler, true);
+}
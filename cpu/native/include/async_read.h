@@ -65,7 +65,10 @@ void native_async_read_cleanup(void);
 /**
  * @brief   resume monitoring of file descriptors
  *
- * Call this function after reading file descriptors.
+ * Call this function after reading file descriptors. With the
+ * `native_async_read_epoll` backend, a file descriptor is not monitored again
+ * after its callback ran until this is called, then its callback runs again
+ * right away if it still has data to read.
  *
  * @param[in] fd  The file descriptor to monitor
  */
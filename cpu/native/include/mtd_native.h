@@ -24,12 +24,60 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+
+#include "kernel_defines.h"
 #include "mtd.h"
 
+/**
+ * @defgroup drivers_mtd_native_conf Native MTD compile configurations
+ * @ingroup  config
+ * @brief    Flash timings emulated by the `mtd_native_mmap` module
+ *
+ * The calling thread sleeps this long per operation, 0 for no delay.
+ * @{
+ */
+/**
+ * @brief   Time to read, per read operation in µs
+ */
+#ifndef CONFIG_MTD_NATIVE_READ_US
+#define CONFIG_MTD_NATIVE_READ_US   (0U)
+#endif
+
+/**
+ * @brief   Time to program a page in µs
+ */
+#ifndef CONFIG_MTD_NATIVE_WRITE_US
+#define CONFIG_MTD_NATIVE_WRITE_US  (0U)
+#endif
+
+/**
+ * @brief   Time to erase a sector in µs
+ */
+#ifndef CONFIG_MTD_NATIVE_ERASE_US
+#define CONFIG_MTD_NATIVE_ERASE_US  (0U)
+#endif
+/** @} */
+
+/**
+ * @brief   Operation counters of an mtd native device
+ */
+typedef struct {
+    uint32_t reads;             /**< read operations */
+    uint32_t writes;            /**< page write operations */
+    uint32_t erases;            /**< sectors erased */
+    uint32_t erase_max;         /**< erases of the most erased sector */
+} mtd_native_stats_t;
+
 /** mtd native descriptor */
 typedef struct mtd_native_dev {
     mtd_dev_t base;     /**< mtd generic device */
     const char *fname;  /**< filename to use for memory emulation */
+#if IS_USED(MODULE_MTD_NATIVE_MMAP) || DOXYGEN
+    uint8_t *map;               /**< file mapped by `mtd_native_mmap` */
+    uint32_t *erase_count;      /**< erases per sector */
+    mtd_native_stats_t stats;   /**< operation counters */
+#endif
 } mtd_native_dev_t;
 
 /**
@@ -37,6 +85,26 @@ typedef struct mtd_native_dev {
  */
 extern const mtd_desc_t native_flash_driver;
 
+#if IS_USED(MODULE_MTD_NATIVE_MMAP) || DOXYGEN
+/**
+ * @brief   Gets the operation counters of a device
+ *
+ * @param[in]  dev      initialized device
+ * @param[out] stats    operation counters
+ */
+void mtd_native_stats_get(const mtd_native_dev_t *dev, mtd_native_stats_t *stats);
+
+/**
+ * @brief   Gets how often a sector was erased since the device was initialized
+ *
+ * @param[in] dev       initialized device
+ * @param[in] sector    sector
+ *
+ * @return  erases of @p sector, 0 if there is no such sector
+ */
+uint32_t mtd_native_erase_count(const mtd_native_dev_t *dev, uint32_t sector);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
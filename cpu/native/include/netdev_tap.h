@@ -26,9 +26,10 @@ extern "C" {
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "kernel_defines.h"
 #include "net/netdev.h"
 
-#include "net/ethernet/hdr.h"
+#include "net/ethernet.h"
 
 #include "net/if.h"
 
@@ -37,6 +38,18 @@ extern "C" {
  * @name Low-level ethernet driver for native tap interfaces
  * @{
  */
+/**
+ * @brief   Number of frames received per interrupt with the
+ *          `netdev_tap_batch` module
+ *
+ * All frames pending on the tap are read into a ring of this many
+ * preallocated buffers before they are handed to the upper layer. More frames
+ * are left for the next interrupt, which follows right away.
+ */
+#ifndef CONFIG_NETDEV_TAP_RX_BATCH
+#define CONFIG_NETDEV_TAP_RX_BATCH  (8U)
+#endif
+
 /**
  * @brief tap interface state
  */
@@ -47,6 +60,15 @@ typedef struct netdev_tap {
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     bool promiscuous;                   /**< Flag for promiscuous mode */
     bool wired;                         /**< Flag for wired mode */
+#if IS_USED(MODULE_NETDEV_TAP_BATCH) || DOXYGEN
+    /**
+     * @brief   Frames received, not yet passed to the upper layer
+     */
+    uint8_t rx_buf[CONFIG_NETDEV_TAP_RX_BATCH][ETHERNET_FRAME_LEN];
+    uint16_t rx_len[CONFIG_NETDEV_TAP_RX_BATCH];    /**< lengths of @ref rx_buf */
+    uint8_t rx_head;                    /**< index of the oldest frame */
+    uint8_t rx_count;                   /**< number of frames in @ref rx_buf */
+#endif
 } netdev_tap_t;
 
 /**
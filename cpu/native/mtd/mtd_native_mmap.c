@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @file
+ * @ingroup drivers_mtd_native
+ * @brief   MTD flash emulation for native, on a memory mapped file
+ *
+ * The whole flash image is mapped shared into the RIOT process, so reads are
+ * a memcpy() and writes and erases modify the image in place, with NOR flash
+ * semantics: writing can only clear bits, erasing sets all bits of a sector.
+ * The host writes the changes back to the file.
+ */
+
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_native.h"
+#include "native_internal.h"
+#include "ztimer.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static inline size_t _sector_size(const mtd_dev_t *dev)
+{
+    return dev->pages_per_sector * dev->page_size;
+}
+
+static inline size_t _mtd_size(const mtd_dev_t *dev)
+{
+    return dev->sector_count * _sector_size(dev);
+}
+
+static inline void _delay(uint32_t us)
+{
+    if (us) {
+        ztimer_sleep(ZTIMER_USEC, us);
+    }
+}
+
+static int _init(mtd_dev_t *dev)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+
+    DEBUG("mtd_native: init, filename=%s\n", _dev->fname);
+
+    if (_dev->map) {
+        return 0;
+    }
+
+    int fd = real_open(_dev->fname, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return -EIO;
+    }
+
+    struct stat st;
+    if (real_fstat(fd, &st) < 0) {
+        real_close(fd);
+        return -EIO;
+    }
+
+    bool created = (st.st_size == 0);
+    if (created) {
+        DEBUG("mtd_native: init: creating file %s\n", _dev->fname);
+        if (ftruncate(fd, _mtd_size(dev)) < 0) {
+            real_close(fd);
+            return -EIO;
+        }
+    }
+    else if ((size_t)st.st_size < _sector_size(dev)) {
+        /* would map nothing, an image is never padded to not alter it */
+        warnx("mtd_native: %s: image of %lld bytes is smaller than one sector "
+              "(%u bytes)", _dev->fname, (long long)st.st_size,
+              (unsigned)_sector_size(dev));
+        real_close(fd);
+        return -EINVAL;
+    }
+    else {
+        /* a partial sector at the end of the image is not used */
+        dev->sector_count = st.st_size / _sector_size(dev);
+    }
+
+    uint8_t *map = mmap(NULL, _mtd_size(dev), PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, 0);
+    /* the mapping stays valid without the fd */
+    real_close(fd);
+    if (map == MAP_FAILED) {
+        return -EIO;
+    }
+    if (created) {
+        memset(map, 0xff, _mtd_size(dev));
+    }
+
+    _dev->erase_count = real_calloc(dev->sector_count, sizeof(uint32_t));
+    if (!_dev->erase_count) {
+        munmap(map, _mtd_size(dev));
+        return -ENOMEM;
+    }
+    memset(&_dev->stats, 0, sizeof(_dev->stats));
+    _dev->map = map;
+
+    return 0;
+}
+
+static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+
+    DEBUG("mtd_native: read from page %" PRIu32 " count %" PRIu32 "\n", addr, size);
+
+    if ((uint64_t)addr + size > _mtd_size(dev)) {
+        return -EOVERFLOW;
+    }
+
+    memcpy(buff, &_dev->map[addr], size);
+    _dev->stats.reads++;
+    _delay(CONFIG_MTD_NATIVE_READ_US);
+
+    return 0;
+}
+
+static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t offset,
+                       uint32_t size)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    const uint8_t *src = buff;
+
+    DEBUG("mtd_native: write from page %" PRIx32 ", offset 0x%" PRIx32 " count %" PRIu32 "\n",
+          page, offset, size);
+
+    if (page >= dev->sector_count * dev->pages_per_sector) {
+        return -EOVERFLOW;
+    }
+
+    if (offset > dev->page_size) {
+        return -EOVERFLOW;
+    }
+
+    uint32_t remaining = dev->page_size - offset;
+    size = MIN(remaining, size);
+
+    /* programming can only clear bits */
+    uint8_t *dst = &_dev->map[page * dev->page_size + offset];
+    for (size_t i = 0; i < size; i++) {
+        dst[i] &= src[i];
+    }
+    _dev->stats.writes++;
+    _delay(CONFIG_MTD_NATIVE_WRITE_US);
+
+    return size;
+}
+
+static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
+{
+    mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    size_t sector_size = _sector_size(dev);
+
+    DEBUG("mtd_native: erase from sector %" PRIu32 " count %" PRIu32 "\n", addr, size);
+
+    if ((uint64_t)addr + size > _mtd_size(dev)) {
+        return -EOVERFLOW;
+    }
+    if (((addr % sector_size) != 0) || ((size % sector_size) != 0)) {
+        return -EOVERFLOW;
+    }
+
+    memset(&_dev->map[addr], 0xff, size);
+    for (uint32_t sector = addr / sector_size;
+         sector < (addr + size) / sector_size; sector++) {
+        uint32_t count = ++_dev->erase_count[sector];
+
+        _dev->stats.erase_max = MAX(_dev->stats.erase_max, count);
+        _dev->stats.erases++;
+        _delay(CONFIG_MTD_NATIVE_ERASE_US);
+    }
+
+    return 0;
+}
+
+static int _power(mtd_dev_t *dev, enum mtd_power_state power)
+{
+    (void) dev;
+    (void) power;
+
+    return -ENOTSUP;
+}
+
+void mtd_native_stats_get(const mtd_native_dev_t *dev, mtd_native_stats_t *stats)
+{
+    *stats = dev->stats;
+}
+
+uint32_t mtd_native_erase_count(const mtd_native_dev_t *dev, uint32_t sector)
+{
+    if (!dev->erase_count || (sector >= dev->base.sector_count)) {
+        return 0;
+    }
+    return dev->erase_count[sector];
+}
+
+const mtd_desc_t native_flash_driver = {
+    .read = _read,
+    .power = _power,
+    .write_page = _write_page,
+    .erase = _erase,
+    .init = _init,
+};
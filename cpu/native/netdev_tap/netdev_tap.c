@@ -32,6 +32,7 @@
 
 /* needs to be included before native's declarations of ntohl etc. */
 #include "byteorder.h"
+#include "kernel_defines.h"
 
 #if defined(__FreeBSD__)
 #  include <sys/socket.h>
@@ -96,8 +97,17 @@ static inline int _get_wired(netdev_t *netdev)
     return dev->wired;
 }
 
+#if IS_USED(MODULE_NETDEV_TAP_BATCH)
+static void _isr_batch(netdev_tap_t *dev);
+#endif
+
 static inline void _isr(netdev_t *netdev)
 {
+#if IS_USED(MODULE_NETDEV_TAP_BATCH)
+    _isr_batch(container_of(netdev, netdev_tap_t, netdev));
+    return;
+#endif
+
     if (netdev->event_callback) {
         netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
     }
@@ -189,13 +199,13 @@ static const netdev_driver_t netdev_driver_tap = {
 };
 
 /* driver implementation */
-static inline bool _is_addr_broadcast(uint8_t *addr)
+static inline bool _is_addr_broadcast(const uint8_t *addr)
 {
     return ((addr[0] == 0xff) && (addr[1] == 0xff) && (addr[2] == 0xff) &&
             (addr[3] == 0xff) && (addr[4] == 0xff) && (addr[5] == 0xff));
 }
 
-static inline bool _is_addr_multicast(uint8_t *addr)
+static inline bool _is_addr_multicast(const uint8_t *addr)
 {
     /* source: http://ieee802.org/secmail/pdfocSP2xXA6d.pdf */
     return (addr[0] & 0x01);
@@ -203,6 +213,12 @@ static inline bool _is_addr_multicast(uint8_t *addr)
 
 static void _continue_reading(netdev_tap_t *dev)
 {
+    if (IS_USED(MODULE_NATIVE_ASYNC_READ_EPOLL)) {
+        /* reports the tap again right away if there are more frames */
+        native_async_read_continue(dev->tap_fd);
+        return;
+    }
+
     /* work around lost signals */
     fd_set rfds;
     struct timeval t;
@@ -228,11 +244,108 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_pending_syscalls_down();
 }
 
+static bool _is_for_me(netdev_tap_t *dev, const void *buf)
+{
+    const ethernet_hdr_t *hdr = buf;
+
+    if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
+        !_is_addr_broadcast(hdr->dst) &&
+        (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
+        DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
+              "That's not me => Dropped\n",
+              hdr->dst[0], hdr->dst[1], hdr->dst[2],
+              hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+        return false;
+    }
+    return true;
+}
+
+#if IS_USED(MODULE_NETDEV_TAP_BATCH)
+static void _batch_pop(netdev_tap_t *dev)
+{
+    dev->rx_head = (dev->rx_head + 1) % CONFIG_NETDEV_TAP_RX_BATCH;
+    dev->rx_count--;
+}
+
+static void _batch_read(netdev_tap_t *dev)
+{
+    while (dev->rx_count < CONFIG_NETDEV_TAP_RX_BATCH) {
+        unsigned idx = (dev->rx_head + dev->rx_count) % CONFIG_NETDEV_TAP_RX_BATCH;
+        int nread = real_read(dev->tap_fd, dev->rx_buf[idx],
+                              sizeof(dev->rx_buf[idx]));
+
+        if (nread == -1) {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                break;
+            }
+            err(EXIT_FAILURE, "netdev_tap: read");
+        }
+        if ((nread < (int)sizeof(ethernet_hdr_t)) ||
+            !_is_for_me(dev, dev->rx_buf[idx])) {
+            continue;
+        }
+        dev->rx_len[idx] = nread;
+        dev->rx_count++;
+    }
+    DEBUG("netdev_tap: read %u frames\n", dev->rx_count);
+}
+
+static void _isr_batch(netdev_tap_t *dev)
+{
+    netdev_t *netdev = &dev->netdev;
+
+    _batch_read(dev);
+    /* the tap is reported again right away if the ring got full */
+    _continue_reading(dev);
+
+    while (dev->rx_count) {
+        unsigned count = dev->rx_count;
+
+        if (netdev->event_callback) {
+            netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+        }
+        if (dev->rx_count == count) {
+            /* not fetched by the upper layer */
+            _batch_pop(dev);
+        }
+    }
+}
+
+static int _recv_batch(netdev_tap_t *dev, void *buf, size_t len)
+{
+    if (!dev->rx_count) {
+        return -ENODATA;
+    }
+
+    size_t frame_len = dev->rx_len[dev->rx_head];
+
+    if (!buf) {
+        if (len > 0) {
+            DEBUG("netdev_tap: discarding the frame\n");
+            _batch_pop(dev);
+        }
+        return frame_len;
+    }
+    if (len < frame_len) {
+        _batch_pop(dev);
+        return -ENOBUFS;
+    }
+
+    memcpy(buf, dev->rx_buf[dev->rx_head], frame_len);
+    _batch_pop(dev);
+    return frame_len;
+}
+#endif
+
 static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
 {
     netdev_tap_t *dev = container_of(netdev, netdev_tap_t, netdev);
     (void)info;
 
+#if IS_USED(MODULE_NETDEV_TAP_BATCH)
+    return _recv_batch(dev, buf, len);
+#endif
+
     if (!buf) {
         if (len > 0) {
             /* no memory available in pktbuf, discarding the frame */
@@ -262,15 +375,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     DEBUG("netdev_tap: read %d bytes\n", nread);
 
     if (nread > 0) {
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
-        if (!(dev->promiscuous) && !_is_addr_multicast(hdr->dst) &&
-            !_is_addr_broadcast(hdr->dst) &&
-            (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
-            DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
-                  "That's not me => Dropped\n",
-                  hdr->dst[0], hdr->dst[1], hdr->dst[2],
-                  hdr->dst[3], hdr->dst[4], hdr->dst[5]);
-
+        if (!_is_for_me(dev, buf)) {
             native_async_read_continue(dev->tap_fd);
 
             return 0;
@@ -282,6 +387,7 @@ static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
     }
     else if (nread == -1) {
         if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            native_async_read_continue(dev->tap_fd);
         }
         else {
             err(EXIT_FAILURE, "netdev_tap: read");
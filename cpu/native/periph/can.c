@@ -132,8 +132,6 @@ static void _callback_can_sigio(int sockfd, void *arg)
         dev->candev.event_callback(&dev->candev, CANDEV_EVENT_ISR, NULL);
     }
 
-    native_async_read_continue(sockfd);
-
     if (sched_context_switch_request) {
         thread_yield_higher();
     }
@@ -241,6 +239,8 @@ static void _isr(candev_t *candev)
 
     DEBUG("candev_native _isr: CAN SIGIO interrupt received, sock = %i\n", dev->sock);
     nbytes = real_read(dev->sock, &rcv_frame, sizeof(can_frame_t));
+    /* monitor the socket again once the frame is read */
+    native_async_read_continue(dev->sock);
 
     if (nbytes < 0) {   /* SIGIO signal was probably due to an error with the socket */
         DEBUG("candev_native _isr: read: error during read\n");
@@ -27,6 +27,7 @@
 #include "async_read.h"
 #include "byteorder.h"
 #include "checksum/crc16_ccitt.h"
+#include "kernel_defines.h"
 #include "native_internal.h"
 
 #include "net/ieee802154/radio.h"
@@ -104,6 +105,13 @@ static inline size_t _zep_hdr_fill(socket_zep_t *dev, zep_hdr_t *hdr,
 
 static void _continue_reading(socket_zep_t *dev)
 {
+    if (IS_USED(MODULE_NATIVE_ASYNC_READ_EPOLL)) {
+        /* reports the socket again right away if there are more frames */
+        dev->state = ZEPDEV_STATE_RX_ON;
+        native_async_read_continue(dev->sock_fd);
+        return;
+    }
+
     /* work around lost signals */
     fd_set rfds;
     struct timeval t;
@@ -311,6 +319,7 @@ static void _socket_isr(int fd, void *arg)
     if (zepdev->state != ZEPDEV_STATE_RX_ON) {
         res = real_recv(zepdev->sock_fd, &res, sizeof(res), MSG_TRUNC);
         DEBUG("socket_zep::_socket_isr: discard frame (%d bytes, state %u)\n", res, zepdev->state);
+        native_async_read_continue(fd);
         return;
     }
 
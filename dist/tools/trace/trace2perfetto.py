@@ -0,0 +1,124 @@
+#! /usr/bin/env python3
+#
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+"""
+Converts a trace stream written by the `trace_stream` module to the JSON trace
+event format, which can be loaded by Perfetto UI (https://ui.perfetto.dev) or
+chrome://tracing.
+
+Every thread gets a track showing when it was running, all other events are
+shown as instant events on the track of the thread (or the ISR track) they
+were recorded in.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0xC1FC1FC1
+RECORD = struct.Struct("<IHHII")
+CTX_ISR = 0x8000
+
+EVENTS = [
+    ("user", "value", None),
+    ("dropped", "count", None),
+    ("sched_switch", "prev_pid", "next_pid"),
+    ("sched_wakeup", "pid", "priority"),
+    ("msg_send", "target_pid", "type"),
+    ("msg_recv", "sender_pid", "type"),
+    ("mutex_block", "mutex", None),
+    ("mutex_resume", "mutex", None),
+    ("mutex_handover", "mutex", "waiter_pid"),
+    ("netapi_send", "target_pid", "type"),
+    ("netapi_dispatch", "nettype", "demux_ctx"),
+    ("ztimer_set", "timer", "val"),
+    ("ztimer_fire", "timer", None),
+]
+EV_SCHED_SWITCH = 2
+ISR_TID = 0xFFFF
+
+
+def read_records(data):
+    if len(data) < 4 or struct.unpack_from("<I", data)[0] != MAGIC:
+        raise ValueError("not a trace stream (magic number missing)")
+    # a stream cut off while recording may end with a partial record
+    end = 4 + ((len(data) - 4) // RECORD.size) * RECORD.size
+    for offset in range(4, end, RECORD.size):
+        yield RECORD.unpack_from(data, offset)
+
+
+def convert(data, names):
+    out = []
+    last_time = None
+    base = 0
+    running = None
+
+    def tid(ctx):
+        return ISR_TID if ctx & CTX_ISR else ctx
+
+    for time, ev_id, ctx, arg0, arg1 in read_records(data):
+        # extend the 32 bit µs timestamps
+        if last_time is not None and time < last_time:
+            base += 1 << 32
+        last_time = time
+        ts = base + time
+
+        if ev_id == EV_SCHED_SWITCH:
+            if running is not None:
+                out.append({"ph": "E", "pid": 0, "tid": running, "ts": ts})
+            running = arg1 if arg1 else None
+            if running is not None:
+                out.append({"ph": "B", "pid": 0, "tid": running, "ts": ts,
+                            "name": "running"})
+            continue
+
+        if ev_id < len(EVENTS):
+            name, arg0_name, arg1_name = EVENTS[ev_id]
+        else:
+            name, arg0_name, arg1_name = "app_0x%x" % ev_id, "arg0", "arg1"
+        args = {arg0_name: arg0}
+        if arg1_name:
+            args[arg1_name] = arg1
+        out.append({"ph": "i", "s": "t", "pid": 0, "tid": tid(ctx), "ts": ts,
+                    "name": name, "args": args})
+
+    tids = {e["tid"] for e in out}
+    for t in sorted(tids):
+        name = "isr" if t == ISR_TID else names.get(t, "thread %d" % t)
+        out.append({"ph": "M", "pid": 0, "tid": t, "name": "thread_name",
+                    "args": {"name": name}})
+    out.append({"ph": "M", "pid": 0, "name": "process_name",
+                "args": {"name": "RIOT"}})
+    return {"traceEvents": out, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("stream", type=argparse.FileType("rb"),
+                        help="trace stream file, - for stdin")
+    parser.add_argument("-o", "--output", type=argparse.FileType("w"),
+                        default=sys.stdout, help="JSON output file")
+    parser.add_argument("-n", "--name", action="append", default=[],
+                        metavar="PID=NAME", help="name of a thread")
+    args = parser.parse_args()
+
+    names = {}
+    for entry in args.name:
+        pid, name = entry.split("=", 1)
+        names[int(pid)] = name
+
+    data = args.stream.read()
+    try:
+        json.dump(convert(data, names), args.output)
+    except ValueError as e:
+        sys.exit(str(e))
+
+
+if __name__ == "__main__":
+    main()
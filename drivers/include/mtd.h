@@ -313,6 +313,18 @@ struct mtd_desc {
      */
     int (*power)(mtd_dev_t *dev, enum mtd_power_state power);
 
+    /**
+     * @brief   Write back data buffered by the Memory Technology Device (MTD)
+     *
+     * Optional, for devices which do not complete writes right away.
+     *
+     * @param[in] dev       Pointer to the selected driver
+     *
+     * @retval 0 on success
+     * @retval <0 value on error
+     */
+    int (*sync)(mtd_dev_t *dev);
+
     /**
      * @brief   Properties of the MTD driver
      */
@@ -523,6 +535,20 @@ int mtd_write_sector(mtd_dev_t *mtd, const void *src, uint32_t sector, uint32_t
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write back all data buffered by a MTD device
+ *
+ * Afterwards, all data written to @p mtd is stored on the medium. File
+ * systems call this when they sync.
+ *
+ * @param      mtd   the device to access
+ *
+ * @retval 0 on success, or if @p mtd does not buffer writes
+ * @retval <0 if an error occurred
+ * @retval -ENODEV if @p mtd is not a valid device
+ */
+int mtd_sync(mtd_dev_t *mtd);
+
 /**
  * @brief   Get an MTD device by index
  *
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    drivers_mtd_cache  MTD write-back sector cache
+ * @ingroup     drivers_mtd
+ * @brief       MTD device buffering writes to another MTD device in RAM
+ *
+ * Writing a part of a sector with @ref mtd_write_page reads, erases and
+ * writes back the whole sector on every call, so small sequential writes
+ * erase the same sector over and over. This module wraps any MTD device and
+ * holds up to @ref CONFIG_MTD_CACHE_SECTORS sectors of it in RAM. Writes are
+ * merged into the cached sectors, which are only written back when they are
+ * evicted, when the cache is synced with @ref mtd_sync or powered down with
+ * @ref mtd_power.
+ *
+ * A cached sector is only erased when written back if a write changed data
+ * that was already on the device. Data written to erased memory, e.g.
+ * appended to a file, is written back without erasing the sector.
+ *
+ * The cache accepts overwrites (@ref MTD_DRIVER_FLAG_DIRECT_WRITE), so no
+ * `work_area` is allocated for it.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += mtd_cache
+ * ```
+ *
+ * ```
+ * static uint8_t cache_buf[CONFIG_MTD_CACHE_SECTORS * SECTOR_SIZE];
+ * static mtd_cache_t cache = MTD_CACHE_INIT(MTD_0, cache_buf);
+ *
+ * mtd_dev_t *dev = &cache.mtd;
+ * ```
+ *
+ * `SECTOR_SIZE` is the sector size of the cached device. The cache device
+ * takes its geometry from the cached device in @ref mtd_init.
+ *
+ * @warning Data not yet written back is lost on reset or power loss.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Interface definitions for the MTD write-back sector cache
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mtd.h"
+#include "mutex.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup drivers_mtd_cache_conf MTD write-back sector cache configuration
+ * @ingroup  config
+ * @{
+ */
+/**
+ * @brief   Number of sectors held in RAM
+ */
+#ifndef CONFIG_MTD_CACHE_SECTORS
+#define CONFIG_MTD_CACHE_SECTORS    (1U)
+#endif
+/** @} */
+
+/**
+ * @brief   Initializer for a @ref mtd_cache_t
+ *
+ * @param   _parent     MTD device to cache
+ * @param   _buf        buffer of @ref CONFIG_MTD_CACHE_SECTORS sectors of
+ *                      @p _parent, must be an array
+ */
+#define MTD_CACHE_INIT(_parent, _buf) \
+{ \
+    .mtd = { .driver = &mtd_cache_driver }, \
+    .parent = _parent, \
+    .buf = _buf, \
+    .buf_size = sizeof(_buf), \
+    .lock = MUTEX_INIT, \
+}
+
+/**
+ * @brief   Operations of the cache on the cached device
+ */
+typedef struct {
+    uint32_t hits;              /**< accesses to cached sectors */
+    uint32_t misses;            /**< sectors read into the cache */
+    uint32_t writes;            /**< sectors written back */
+    uint32_t erases;            /**< sectors erased */
+} mtd_cache_stats_t;
+
+/**
+ * @brief   Sector held in RAM
+ */
+typedef struct {
+    uint32_t sector;            /**< cached sector, UINT32_MAX if none */
+    uint32_t last_use;          /**< time of the last access */
+    uint32_t dirty_start;       /**< first byte not written back */
+    uint32_t dirty_end;         /**< end of bytes not written back, 0 if
+                                     none */
+    bool erase;                 /**< sector must be erased to write back */
+} mtd_cache_line_t;
+
+/**
+ * @brief   MTD write-back sector cache
+ */
+typedef struct {
+    mtd_dev_t mtd;              /**< MTD context */
+    mtd_dev_t *parent;          /**< cached MTD device */
+    uint8_t *buf;               /**< sectors held in RAM */
+    size_t buf_size;            /**< size of @ref buf */
+    mutex_t lock;               /**< lock of the cache */
+    uint32_t uses;              /**< accesses, as time for eviction */
+    mtd_cache_stats_t stats;    /**< operations on @ref parent */
+    mtd_cache_line_t lines[CONFIG_MTD_CACHE_SECTORS]; /**< sectors in RAM */
+} mtd_cache_t;
+
+/**
+ * @brief   Cache MTD device operations table
+ */
+extern const mtd_desc_t mtd_cache_driver;
+
+/**
+ * @brief   Gets the operations of a cache on the cached device
+ *
+ * @param[in]  cache    cache
+ * @param[out] stats    operations
+ */
+void mtd_cache_stats_get(mtd_cache_t *cache, mtd_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -415,4 +415,17 @@ int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power)
     }
 }
 
+int mtd_sync(mtd_dev_t *mtd)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+    if (mtd->driver->sync) {
+        return mtd->driver->sync(mtd);
+    }
+
+    return 0;
+}
+
 /** @} */
@@ -0,0 +1,318 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     drivers_mtd_cache
+ * @{
+ *
+ * @file
+ * @brief       MTD write-back sector cache
+ *
+ * The bytes of a cached sector not yet written back are tracked as one range,
+ * aligned to the write size of the cached device. As long as every write unit
+ * that joins the range is erased on the device, the range can be written back
+ * without erasing the sector: units already in the range are not on the
+ * device yet, however often they are written.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include "container.h"
+#include "macros/math.h"
+#include "macros/utils.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mutex.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define NO_SECTOR   UINT32_MAX
+
+static uint32_t _sector_size(const mtd_dev_t *mtd)
+{
+    return mtd->pages_per_sector * mtd->page_size;
+}
+
+static uint8_t *_line_buf(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    return &cache->buf[(line - cache->lines) * _sector_size(&cache->mtd)];
+}
+
+static bool _is_erased(const uint8_t *buf, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        if (buf[i] != 0xff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int _flush(mtd_cache_t *cache, mtd_cache_line_t *line)
+{
+    if (!line->dirty_end) {
+        return 0;
+    }
+
+    uint8_t *buf = _line_buf(cache, line);
+    uint32_t page = line->sector * cache->mtd.pages_per_sector;
+    int res;
+
+    if (line->erase) {
+        DEBUG("mtd_cache: write back sector %" PRIu32 " erased\n", line->sector);
+        res = mtd_write_sector(cache->parent, buf, line->sector, 1);
+        if (res == 0) {
+            cache->stats.erases++;
+        }
+    }
+    else {
+        DEBUG("mtd_cache: write back sector %" PRIu32 " bytes %" PRIu32
+              "-%" PRIu32 "\n", line->sector, line->dirty_start, line->dirty_end);
+        res = mtd_write_page_raw(cache->parent, buf + line->dirty_start, page,
+                                 line->dirty_start,
+                                 line->dirty_end - line->dirty_start);
+    }
+    if (res < 0) {
+        return res;
+    }
+
+    cache->stats.writes++;
+    line->dirty_end = 0;
+    line->erase = false;
+    return 0;
+}
+
+static mtd_cache_line_t *_find(mtd_cache_t *cache, uint32_t sector)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        if (cache->lines[i].sector == sector) {
+            cache->lines[i].last_use = ++cache->uses;
+            cache->stats.hits++;
+            return &cache->lines[i];
+        }
+    }
+    return NULL;
+}
+
+static mtd_cache_line_t *_load(mtd_cache_t *cache, uint32_t sector, int *res)
+{
+    mtd_cache_line_t *line = _find(cache, sector);
+
+    if (line) {
+        return line;
+    }
+
+    /* evict the least recently used sector */
+    line = &cache->lines[0];
+    for (unsigned i = 1; i < ARRAY_SIZE(cache->lines); i++) {
+        if (cache->lines[i].last_use < line->last_use) {
+            line = &cache->lines[i];
+        }
+    }
+    if ((*res = _flush(cache, line)) < 0) {
+        return NULL;
+    }
+
+    line->sector = NO_SECTOR;
+    *res = mtd_read_page(cache->parent, _line_buf(cache, line),
+                         sector * cache->mtd.pages_per_sector, 0,
+                         _sector_size(&cache->mtd));
+    if (*res < 0) {
+        return NULL;
+    }
+
+    cache->stats.misses++;
+    line->sector = sector;
+    line->last_use = ++cache->uses;
+    return line;
+}
+
+static int _init(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    mtd_dev_t *parent = cache->parent;
+
+    /* keep what is cached when initialized again */
+    if (mtd->sector_count) {
+        return 0;
+    }
+
+    int res = mtd_init(parent);
+    if (res < 0) {
+        return res;
+    }
+
+    if (cache->buf_size < ARRAY_SIZE(cache->lines) * _sector_size(parent)) {
+        return -ENOMEM;
+    }
+
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        cache->lines[i] = (mtd_cache_line_t){ .sector = NO_SECTOR };
+    }
+    memset(&cache->stats, 0, sizeof(cache->stats));
+
+    /* inherit physical properties */
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    mtd->write_size = 1;
+    mtd->sector_count = parent->sector_count;
+
+    return 0;
+}
+
+static int _read(mtd_dev_t *mtd, void *dest, uint32_t addr, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t sector_size = _sector_size(mtd);
+    uint8_t *dst = dest;
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    while (count) {
+        uint32_t sector = addr / sector_size;
+        uint32_t offset = addr % sector_size;
+        uint32_t len = MIN(count, sector_size - offset);
+        mtd_cache_line_t *line = _find(cache, sector);
+
+        if (line) {
+            memcpy(dst, _line_buf(cache, line) + offset, len);
+        }
+        else if ((res = mtd_read(cache->parent, dst, addr, len)) < 0) {
+            break;
+        }
+
+        dst += len;
+        addr += len;
+        count -= len;
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                       uint32_t offset, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    const uint32_t write_size = cache->parent->write_size;
+    uint32_t sector = page / mtd->pages_per_sector;
+    int res = 0;
+
+    count = MIN(count, mtd->page_size - offset);
+    offset += (page % mtd->pages_per_sector) * mtd->page_size;
+
+    mutex_lock(&cache->lock);
+    mtd_cache_line_t *line = _load(cache, sector, &res);
+    if (!line) {
+        goto out;
+    }
+
+    uint8_t *buf = _line_buf(cache, line);
+    uint32_t start = offset - (offset % write_size);
+    uint32_t end = DIV_ROUND_UP(offset + count, write_size) * write_size;
+
+    if (!line->dirty_end) {
+        line->dirty_start = start;
+        line->dirty_end = start;
+    }
+    /* write units joining the range, written or not, must be erased on the
+     * device, which is what the cache holds outside the range */
+    if (start < line->dirty_start) {
+        line->erase |= !_is_erased(buf + start, line->dirty_start - start);
+        line->dirty_start = start;
+    }
+    if (end > line->dirty_end) {
+        line->erase |= !_is_erased(buf + line->dirty_end, end - line->dirty_end);
+        line->dirty_end = end;
+    }
+    if (cache->parent->driver->flags & MTD_DRIVER_FLAG_DIRECT_WRITE) {
+        line->erase = false;
+    }
+
+    memcpy(buf + offset, src, count);
+    res = count;
+
+out:
+    mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int _erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    mutex_lock(&cache->lock);
+    /* erased anyway, drop what is not written back */
+    for (unsigned i = 0; i < ARRAY_SIZE(cache->lines); i++) {
+        mtd_cache_line_t *line = &cache->lines[i];
+
+        if ((line->sector >= sector) && (line->sector - sector < count)) {
+            *line = (mtd_cache_line_t){ .sector = NO_SECTOR };
+        }
+    }
+    int res = mtd_erase_sector(cache->parent, sector, count);
+    if (res == 0) {
+        cache->stats.erases += count;
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _sync(mtd_dev_t *mtd)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+    int res = 0;
+
+    mutex_lock(&cache->lock);
+    for (unsigned i = 0; (i < ARRAY_SIZE(cache->lines)) && (res == 0); i++) {
+        res = _flush(cache, &cache->lines[i]);
+    }
+    if (res == 0) {
+        res = mtd_sync(cache->parent);
+    }
+    mutex_unlock(&cache->lock);
+
+    return res;
+}
+
+static int _power(mtd_dev_t *mtd, enum mtd_power_state power)
+{
+    mtd_cache_t *cache = container_of(mtd, mtd_cache_t, mtd);
+
+    if (power == MTD_POWER_DOWN) {
+        int res = _sync(mtd);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    return mtd_power(cache->parent, power);
+}
+
+void mtd_cache_stats_get(mtd_cache_t *cache, mtd_cache_stats_t *stats)
+{
+    mutex_lock(&cache->lock);
+    *stats = cache->stats;
+    mutex_unlock(&cache->lock);
+}
+
+const mtd_desc_t mtd_cache_driver = {
+    .init = _init,
+    .read = _read,
+    .write_page = _write_page,
+    .erase_sector = _erase_sector,
+    .power = _power,
+    .sync = _sync,
+    .flags = MTD_DRIVER_FLAG_DIRECT_WRITE,
+};
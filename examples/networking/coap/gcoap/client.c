@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -39,6 +40,9 @@
 #if IS_USED(MODULE_GCOAP_DTLS)
 #include "net/dsm.h"
 #endif
+#if IS_USED(MODULE_NANOCOAP_CACHE)
+#include "net/nanocoap/cache.h"
+#endif
 
 #ifndef CONFIG_URI_MAX
 #define CONFIG_URI_MAX      128
@@ -257,6 +261,29 @@ static int _cli_cmd(int argc, char **argv)
 #endif
         printf(" CLI requests sent: %u\n", req_count);
         printf("CoAP open requests: %u\n", open_reqs);
+#if IS_USED(MODULE_GCOAP_WORKERS)
+        for (unsigned i = 0; i < CONFIG_GCOAP_WORKERS_NUMOF; i++) {
+            gcoap_worker_stats_t stats;
+
+            gcoap_worker_stats_get(i, &stats);
+            printf("Worker %u: %" PRIu32 " requests, latency avg %" PRIu32
+                   " us, max %" PRIu32 " us\n", i, stats.requests,
+                   stats.requests ? (uint32_t)(stats.latency_sum / stats.requests) : 0,
+                   stats.latency_max);
+        }
+        printf("Requests rejected, workers busy: %" PRIu32 "\n",
+               gcoap_workers_rejected());
+#endif
+#if IS_USED(MODULE_NANOCOAP_CACHE)
+        nanocoap_cache_stats_t cache_stats;
+
+        nanocoap_cache_stats_get(&cache_stats);
+        printf("Cache: %" PRIuSIZE " entries, %" PRIuSIZE "/%u bytes, %" PRIu32
+               " hits, %" PRIu32 " misses, %" PRIu32 " evictions\n",
+               nanocoap_cache_used_count(), nanocoap_cache_arena_used(),
+               CONFIG_NANOCOAP_CACHE_ARENA_SIZE, cache_stats.hits,
+               cache_stats.misses, cache_stats.evictions);
+#endif
         printf("Configured Proxy: ");
         if (*_proxy_uri) {
             printf("%s\n", _proxy_uri);
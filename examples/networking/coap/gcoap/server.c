@@ -82,12 +82,9 @@ static const char *_link_params[] = {
 };
 
 static gcoap_listener_t _listener = {
-    &_resources[0],
-    ARRAY_SIZE(_resources),
-    GCOAP_SOCKET_TYPE_UNDEF,
-    _encode_link,
-    NULL,
-    NULL
+    .resources = &_resources[0],
+    .resources_len = ARRAY_SIZE(_resources),
+    .link_encoder = _encode_link,
 };
 
 /* Adds link format params to resource list */
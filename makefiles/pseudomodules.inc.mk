@@ -84,6 +84,7 @@ PSEUDOMODULES += gcoap_forward_proxy
 PSEUDOMODULES += gcoap_forward_proxy_thread
 PSEUDOMODULES += gcoap_fileserver
 PSEUDOMODULES += gcoap_dtls
+PSEUDOMODULES += gcoap_workers
 ## @addtogroup net_gcoap_dns
 ## @{
 ## Enable @ref net_gcoap_dns
@@ -241,6 +242,15 @@ PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
+## @defgroup pseudomodule_gnrc_sock_mbox_pool gnrc_sock_mbox_pool
+## @{
+## @brief Queue packets received by GNRC socks in a shared pool
+##
+## Instead of a queue of `GNRC_SOCK_MBOX_SIZE` packets in every sock, the
+## packets are queued in slots taken from a pool shared by all socks when
+## they are received. See @ref net_gnrc_sock.
+PSEUDOMODULES += gnrc_sock_mbox_pool
+## @}
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += ieee802154_security
 PSEUDOMODULES += ieee802154_submac
@@ -286,11 +296,30 @@ PSEUDOMODULES += mpu_noexec_ram
 PSEUDOMODULES += pmp_noexec_ram
 ## @}
 
+## @defgroup pseudomodule_mtd_native_mmap mtd_native_mmap
+## @{
+## @brief Memory map the flash image of the native MTD
+##
+## Maps the whole flash image file of @ref drivers_mtd_native instead of
+## accessing it with stdio calls per operation. Counts operations and erases
+## per sector, and emulates flash timings, see @ref drivers_mtd_native_conf.
+## Used by default, disable it to use stdio.
+PSEUDOMODULES += mtd_native_mmap
+## @}
 PSEUDOMODULES += mtd_write_page
 PSEUDOMODULES += nanocoap_%
 PSEUDOMODULES += nanocoap_fileserver_callback
 PSEUDOMODULES += nanocoap_fileserver_delete
 PSEUDOMODULES += nanocoap_fileserver_put
+## @defgroup pseudomodule_native_async_read_epoll native_async_read_epoll
+## @{
+## @brief Watch host file descriptors of native with a single epoll instance
+##
+## Replaces the SIGIO sweep over all file descriptors and the fork()ed
+## listener processes of the native CPU with one epoll instance, watched by a
+## host thread. Used by default on Linux hosts.
+PSEUDOMODULES += native_async_read_epoll
+## @}
 PSEUDOMODULES += netdev_default
 PSEUDOMODULES += netdev_ieee802154_%
 PSEUDOMODULES += netdev_ieee802154_rx_timestamp
@@ -300,6 +329,16 @@ PSEUDOMODULES += netdev_layer
 PSEUDOMODULES += netdev_legacy_api
 PSEUDOMODULES += netdev_new_api
 PSEUDOMODULES += netdev_register
+## @defgroup pseudomodule_netdev_tap_batch netdev_tap_batch
+## @{
+## @brief Receive all pending frames per interrupt with netdev_tap
+##
+## Reads all frames pending on the tap interface of native into a ring of
+## @ref CONFIG_NETDEV_TAP_RX_BATCH preallocated buffers per interrupt, instead
+## of one frame per interrupt. With `netstats_l2`, `ifconfig` shows the
+## packets received per wakeup.
+PSEUDOMODULES += netdev_tap_batch
+## @}
 PSEUDOMODULES += netstats
 PSEUDOMODULES += netstats_l2
 PSEUDOMODULES += netstats_neighbor_etx
@@ -364,6 +403,7 @@ PSEUDOMODULES += saul_pwm
 PSEUDOMODULES += scanf_float
 PSEUDOMODULES += sched_cb
 PSEUDOMODULES += sched_runq_callback
+PSEUDOMODULES += sched_wakeup_callback
 ## @defgroup pseudomodule_sema_deprecated sema_deprecated
 ## @ingroup sys_sema
 ## @{
@@ -435,6 +475,7 @@ PSEUDOMODULES += shell_cmd_random
 PSEUDOMODULES += shell_cmd_rtc
 PSEUDOMODULES += shell_cmd_rtt
 PSEUDOMODULES += shell_cmd_saul_reg
+PSEUDOMODULES += shell_cmd_sched_profiler
 PSEUDOMODULES += shell_cmd_semtech-loramac
 PSEUDOMODULES += shell_cmd_sha1sum
 PSEUDOMODULES += shell_cmd_sha256sum
@@ -465,6 +506,7 @@ PSEUDOMODULES += sock_dtls_verify_public_key
 PSEUDOMODULES += sock_ip
 PSEUDOMODULES += sock_tcp
 PSEUDOMODULES += sock_udp
+PSEUDOMODULES += sock_udp_recv_view
 PSEUDOMODULES += socket_zep_hello
 PSEUDOMODULES += soft_uart_modecfg
 PSEUDOMODULES += stdin
@@ -499,6 +541,10 @@ PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
 PSEUDOMODULES += tiny_strerror_as_strerror
 PSEUDOMODULES += tiny_strerror_minimal
+PSEUDOMODULES += trace_stream
+PSEUDOMODULES += trace_stream_vfs
+PSEUDOMODULES += tracepoints
+PSEUDOMODULES += tsrb_spscrb
 
 # An umbrella module for the unicoap_driver_rfc7252_common_pdu
 # and unicoap_driver_rfc7252_common_messaging modules
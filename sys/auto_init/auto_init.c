@@ -60,11 +60,21 @@ extern void auto_init_random(void);
 AUTO_INIT(auto_init_random,
           AUTO_INIT_PRIO_MOD_RANDOM);
 #endif
+#if IS_USED(MODULE_TRACE)
+extern void trace_init(void);
+AUTO_INIT(trace_init,
+          AUTO_INIT_PRIO_MOD_TRACE);
+#endif
 #if IS_USED(MODULE_SCHEDSTATISTICS)
 extern void init_schedstatistics(void);
 AUTO_INIT(init_schedstatistics,
           AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS);
 #endif
+#if IS_USED(MODULE_SCHED_PROFILER)
+extern void sched_profiler_init(void);
+AUTO_INIT(sched_profiler_init,
+          AUTO_INIT_PRIO_MOD_SCHED_PROFILER);
+#endif
 #if IS_USED(MODULE_SCHED_ROUND_ROBIN)
 extern void sched_round_robin_init(void);
 AUTO_INIT(sched_round_robin_init,
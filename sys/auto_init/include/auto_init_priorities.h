@@ -52,12 +52,24 @@ extern "C" {
  */
 #define AUTO_INIT_PRIO_MOD_RANDOM                       1040
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_TRACE
+/**
+ * @brief   trace priority
+ */
+#define AUTO_INIT_PRIO_MOD_TRACE                        1045
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS
 /**
  * @brief   scheduling statistics priority
  */
 #define AUTO_INIT_PRIO_MOD_SCHEDSTATISTICS              1050
 #endif
+#ifndef AUTO_INIT_PRIO_MOD_SCHED_PROFILER
+/**
+ * @brief   scheduler profiler priority
+ */
+#define AUTO_INIT_PRIO_MOD_SCHED_PROFILER               1055
+#endif
 #ifndef AUTO_INIT_PRIO_MOD_SCHED_ROUND_ROBIN
 /**
  * @brief   round robin scheduling priority
@@ -13,6 +13,10 @@
  * @ingroup sys
  * @brief ISR -> userspace pipe
  *
+ * An isrpipe has a single writer (the ISR) and a single reader, so the module
+ * `tsrb_spscrb` can be used to make it copy data in bulk without disabling
+ * interrupts, see @ref sys_spscrb.
+ *
  * @{
  * @file
  * @brief       isrpipe Interface
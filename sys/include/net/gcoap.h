@@ -358,6 +358,25 @@
  * are available the server destroys the session that has not been used for the
  * longest time after CONFIG_GCOAP_DTLS_MINIMUM_AVAILABLE_SESSIONS_TIMEOUT_USEC.
  *
+ * ## Worker threads ##
+ *
+ * By default, the gcoap thread runs the handler of every request, so a slow
+ * handler (e.g. a block transfer from a file system) delays all other
+ * requests. With the module gcoap_workers, the gcoap thread still receives
+ * and parses requests, looks up the resource and maintains Observe
+ * registrations, but hands the request over to one of
+ * CONFIG_GCOAP_WORKERS_NUMOF worker threads, which runs the handler and sends
+ * the response. A request goes to the worker with the fewest requests queued.
+ * If the queues of all workers are full (see CONFIG_GCOAP_WORKER_QUEUE_LEN),
+ * the request is answered with 5.03 (Service Unavailable). Requests received
+ * via DTLS are still handled by the gcoap thread.
+ *
+ * As handlers may run concurrently, they must not share state without
+ * synchronization. Workers run at a lower priority than the gcoap thread, so
+ * requests are dispatched and responses are matched while handlers run.
+ * gcoap_worker_stats_get() reports how many requests a worker handled and how
+ * long they took.
+ *
  * ## Implementation Notes ##
  *
  * ### Waiting for a response ###
@@ -365,8 +384,8 @@
  * We take advantage of RIOT's asynchronous messaging by using an xtimer to wait
  * for a response, so the gcoap thread does not block while waiting. The user is
  * notified via the same callback, whether the message is received or the wait
- * times out. We track the response with an entry in the
- * `_coap_state.open_reqs` array.
+ * times out. We track the response with an entry in the pool of request memos,
+ * which is indexed by token and message ID to match responses quickly.
  *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
@@ -407,6 +426,9 @@
 #endif
 #include "net/nanocoap.h"
 #include "net/nanocoap/cache.h"
+#if IS_USED(MODULE_NANOCOAP_URI_TRIE) || defined(DOXYGEN)
+#include "net/nanocoap/uri_trie.h"
+#endif
 #include "timex.h"
 
 #ifdef __cplusplus
@@ -465,10 +487,23 @@ extern "C" {
 
 /**
  * @brief   Maximum number of requests awaiting a response
+ *
+ * This is the size of the built-in pool of request memos, a larger pool can be
+ * provided at runtime with gcoap_req_memo_pool_set().
  */
 #ifndef CONFIG_GCOAP_REQ_WAITING_MAX
 #define CONFIG_GCOAP_REQ_WAITING_MAX   (2)
 #endif
+
+/**
+ * @brief   Number of hash buckets to look up request memos by token and by
+ *          message ID, and observe memos by resource
+ *
+ * Must be a power of 2. 1 degrades the lookups to a search of all memos.
+ */
+#ifndef CONFIG_GCOAP_MEMO_HASH_BUCKETS
+#define CONFIG_GCOAP_MEMO_HASH_BUCKETS (8U)
+#endif
 /** @} */
 
 /**
@@ -665,8 +700,46 @@ extern "C" {
                           + sizeof(coap_pkt_t) + GCOAP_DTLS_EXTRA_STACKSIZE \
                           + GCOAP_VFS_EXTRA_STACKSIZE)
 #endif
+
+/**
+ * @brief Stack size for a worker thread of module gcoap_workers
+ */
+#ifndef GCOAP_WORKER_STACK_SIZE
+#define GCOAP_WORKER_STACK_SIZE (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE \
+                                 + GCOAP_VFS_EXTRA_STACKSIZE)
+#endif
 /** @} */
 
+/**
+ * @brief   Priority of the worker threads of module gcoap_workers
+ *
+ * Must be lower than the priority of the gcoap thread, which is
+ * THREAD_PRIORITY_MAIN - 1.
+ */
+#ifndef GCOAP_WORKER_PRIO
+#define GCOAP_WORKER_PRIO       (THREAD_PRIORITY_MAIN)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of worker threads running request handlers, if module
+ *          gcoap_workers is used
+ */
+#ifndef CONFIG_GCOAP_WORKERS_NUMOF
+#define CONFIG_GCOAP_WORKERS_NUMOF      (2U)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of requests queued per worker thread, if module
+ *          gcoap_workers is used
+ *
+ * Each queued request takes a buffer of CONFIG_GCOAP_PDU_BUF_SIZE bytes.
+ */
+#ifndef CONFIG_GCOAP_WORKER_QUEUE_LEN
+#define CONFIG_GCOAP_WORKER_QUEUE_LEN   (2U)
+#endif
+
 /**
  * @ingroup net_gcoap_conf
  * @brief   Count of PDU buffers available for resending confirmable messages
@@ -800,6 +873,17 @@ struct gcoap_listener {
      * @ref resources_len fields to fit their needs.
      */
     gcoap_request_matcher_t request_matcher;
+
+#if IS_USED(MODULE_NANOCOAP_URI_TRIE) || defined(DOXYGEN)
+    /**
+     * @brief   Trie to match the resources with the default request matcher
+     *
+     * Optional, leaving this NULL matches every resource in turn. If set to
+     * a trie initialized with @ref COAP_URI_TRIE_INIT, the trie is built on
+     * registration, see @ref net_nanocoap_uri_trie.
+     */
+    coap_uri_trie_t *uri_trie;
+#endif
 };
 
 /**
@@ -844,6 +928,9 @@ struct gcoap_request_memo {
     event_timeout_t resp_evt_tmout;     /**< Limits wait for response */
     event_callback_t resp_tmout_cb;     /**< Callback for response timeout */
     gcoap_socket_t socket;              /**< Transport type to remote endpoint */
+    gcoap_request_memo_t *next_by_token;/**< Next memo in the token hash bucket */
+    gcoap_request_memo_t *next_by_mid;  /**< Next memo in the message ID hash
+                                             bucket */
 #if IS_USED(MODULE_NANOCOAP_CACHE) || DOXYGEN
     /**
      * @brief   Cache key for the request
@@ -857,7 +944,7 @@ struct gcoap_request_memo {
 /**
  * @brief   Memo for Observe registration and notifications
  */
-typedef struct {
+typedef struct gcoap_observe_memo {
     sock_udp_ep_t *observer;            /**< Client endpoint; unused if null */
     sock_udp_ep_t *notifier;            /**< Local endpoint to send notifications */
     const coap_resource_t *resource;    /**< Entity being observed */
@@ -865,6 +952,9 @@ typedef struct {
     uint16_t last_msgid;                /**< Message ID of last notification */
     unsigned token_len;                 /**< Actual length of token attribute */
     gcoap_socket_t socket;              /**< Transport type to observer */
+    struct gcoap_observe_memo *next_by_resource;
+                                        /**< Next memo in the resource hash
+                                             bucket */
 } gcoap_observe_memo_t;
 
 /**
@@ -1028,6 +1118,8 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
  * @brief   Initializes a CoAP response packet on a buffer
  *
  * Initializes payload location within the buffer based on packet setup.
+ * Afterwards, @p pdu refers to the response in @p buf, which may be a
+ * different buffer than the one holding the request.
  *
  * @param[out] pdu      Response metadata
  * @param[in] buf       Buffer containing the PDU
@@ -1126,15 +1218,73 @@ size_t gcoap_obs_send(const uint8_t *buf, size_t len,
 int gcoap_obs_req_forget(const sock_udp_ep_t *remote, const uint8_t *token,
                          size_t tokenlen);
 
+/**
+ * @brief   Replaces the pool of request memos
+ *
+ * The pool limits the number of requests awaiting a response. Initially, a
+ * built-in pool of @ref CONFIG_GCOAP_REQ_WAITING_MAX memos is used. Note that
+ * confirmable requests additionally need one of
+ * @ref CONFIG_GCOAP_RESEND_BUFS_MAX buffers, and that the forward proxy
+ * forwards at most @ref CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX requests at
+ * once, regardless of the pool.
+ *
+ * Response timeouts still pending for memos of the previous pool, e.g. of
+ * observe requests released by gcoap_obs_req_forget(), are canceled, so the
+ * previous pool may be reused once this function returned successfully.
+ *
+ * @param[in] memos     memory for the memos, must stay valid until replaced,
+ *                      NULL to restore the built-in pool
+ * @param[in] numof     number of memos in @p memos
+ *
+ * @return  0 on success
+ * @return  -EBUSY if requests are awaiting a response
+ */
+int gcoap_req_memo_pool_set(gcoap_request_memo_t *memos, size_t numof);
+
 /**
  * @brief   Provides important operational statistics
  *
  * Useful for monitoring.
  *
- * @return  count of unanswered requests
+ * @return  count of unanswered requests, saturated at UINT8_MAX
  */
 uint8_t gcoap_op_state(void);
 
+/**
+ * @brief   Statistics of a worker thread of module gcoap_workers
+ */
+typedef struct {
+    uint32_t requests;                  /**< Requests handled */
+    uint32_t latency_max;               /**< Longest time from dispatching a
+                                             request to sending the response,
+                                             in microseconds */
+    uint64_t latency_sum;               /**< Sum of these times of all
+                                             requests, in microseconds */
+} gcoap_worker_stats_t;
+
+/**
+ * @brief   Gets the statistics of a worker thread
+ *
+ * Only available with module gcoap_workers.
+ *
+ * @param[in]  worker   index of the worker, < CONFIG_GCOAP_WORKERS_NUMOF
+ * @param[out] stats    statistics of the worker
+ *
+ * @return  0 on success
+ * @return  -ENOENT if there is no such worker
+ */
+int gcoap_worker_stats_get(unsigned worker, gcoap_worker_stats_t *stats);
+
+/**
+ * @brief   Provides the number of requests rejected with 5.03 since all
+ *          workers were busy
+ *
+ * Only available with module gcoap_workers.
+ *
+ * @return  count of rejected requests
+ */
+uint32_t gcoap_workers_rejected(void);
+
 /**
  * @brief   Get the resource list, currently only `CoRE Link Format`
  *          (COAP_FORMAT_LINK) supported
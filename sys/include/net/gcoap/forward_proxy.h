@@ -46,6 +46,20 @@ extern "C" {
 #ifndef CONFIG_GCOAP_FORWARD_PROXY_EMPTY_ACK_MS
 #define CONFIG_GCOAP_FORWARD_PROXY_EMPTY_ACK_MS     ((CONFIG_COAP_ACK_TIMEOUT_MS / 4) * 3)
 #endif
+
+/**
+ * @brief Maximum number of requests the forward proxy forwards at once
+ *
+ * Each forwarded request takes a client endpoint of the proxy and a request
+ * memo of gcoap. The client endpoints are allocated at compile time, so they
+ * do not grow with a larger pool of request memos set by
+ * gcoap_req_memo_pool_set(). Set this to the size of that pool to forward as
+ * many requests at once. Must be a power of 2 with module
+ * gcoap_forward_proxy_thread.
+ */
+#ifndef CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX
+#define CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX      CONFIG_GCOAP_REQ_WAITING_MAX
+#endif
 /** @} */
 
 /**
@@ -69,9 +83,8 @@ int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
                                         const sock_udp_ep_t *client, const sock_udp_ep_t *local);
 
 /**
- * @brief  Finds the memo for an outstanding request within the
- *         _coap_state.open_reqs array. Matches on remote endpoint and
- *         token.
+ * @brief  Finds the memo for an outstanding request among the open
+ *         requests of gcoap. Matches on remote endpoint and token.
  *
  * @param[out] memo_ptr   Registered request memo, or NULL if not found
  * @param[in]  src_pdu    PDU for token to match
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_ipv6_fwd_cache IPv6 forwarding cache
+ * @ingroup     net_gnrc_ipv6
+ * @brief       Caches the next hops of forwarded flows
+ *
+ * A router resolves the next hop of every packet it forwards in the
+ * @ref net_gnrc_ipv6_nib "NIB" and builds a new interface header for it. This
+ * module remembers the outgoing interface and link-layer address of the last
+ * @ref CONFIG_GNRC_IPV6_FWD_CACHE_SIZE flows, by destination address and
+ * receiving interface. A packet of a cached flow is sent by reusing the
+ * interface header it was received with, without asking the NIB.
+ *
+ * Only next hops with a reachable or unmanaged neighbor cache entry are
+ * cached. Any change of the neighbor cache, the forwarding table, the prefix
+ * list or the default router list invalidates the whole cache, so a packet
+ * never takes a path the NIB would not choose for it.
+ *
+ * ## Usage
+ *
+ * ```
+ * USEMODULE += gnrc_ipv6_fwd_cache
+ * ```
+ *
+ * The module is used by @ref net_gnrc_ipv6 when forwarding, it selects
+ * `gnrc_ipv6_router`.
+ *
+ * @{
+ *
+ * @file
+ * @brief   IPv6 forwarding cache definitions
+ */
+
+#include <stdint.h>
+
+#include "net/gnrc/ipv6/nib/nc.h"
+#include "net/ipv6/addr.h"
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    net_gnrc_ipv6_fwd_cache_conf GNRC IPv6 forwarding cache compile configurations
+ * @ingroup     net_gnrc_ipv6_fwd_cache
+ * @ingroup     net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of flows in the forwarding cache
+ */
+#ifndef CONFIG_GNRC_IPV6_FWD_CACHE_SIZE
+#define CONFIG_GNRC_IPV6_FWD_CACHE_SIZE     (4U)
+#endif
+/** @} */
+
+/**
+ * @brief   Next hop of a flow
+ */
+typedef struct {
+    ipv6_addr_t dst;            /**< destination address of the flow */
+    uint32_t generation;        /**< cache generation the entry is valid in */
+    uint32_t last_use;          /**< time of the last hit, for eviction */
+    kernel_pid_t in_iface;      /**< interface the flow is received on */
+    kernel_pid_t iface;         /**< interface to the next hop */
+    /**
+     * @brief   Link-layer address of the next hop
+     */
+    uint8_t l2addr[CONFIG_GNRC_IPV6_NIB_L2ADDR_MAX_LEN];
+    uint8_t l2addr_len;         /**< length of gnrc_ipv6_fwd_cache_entry_t::l2addr */
+} gnrc_ipv6_fwd_cache_entry_t;
+
+/**
+ * @brief   Forwarding cache statistics
+ */
+typedef struct {
+    uint32_t hits;              /**< packets forwarded by a cached next hop */
+    uint32_t misses;            /**< packets forwarded by a next hop of the NIB */
+    uint32_t invalidations;     /**< NIB changes invalidating the cache */
+} gnrc_ipv6_fwd_cache_stats_t;
+
+/**
+ * @brief   Gets the next hop of a flow
+ *
+ * @note    Only the IPv6 thread may use the cache.
+ *
+ * @param[in] dst       destination address of the flow
+ * @param[in] in_iface  interface the flow is received on
+ *
+ * @return  the next hop of the flow, valid until the next call of
+ *          @ref gnrc_ipv6_fwd_cache_add()
+ * @return  NULL, if the flow is not in the cache
+ */
+const gnrc_ipv6_fwd_cache_entry_t *gnrc_ipv6_fwd_cache_get(const ipv6_addr_t *dst,
+                                                           kernel_pid_t in_iface);
+
+/**
+ * @brief   Records that a packet was forwarded by a cached next hop
+ *
+ * @note    Only the IPv6 thread may use the cache.
+ *
+ * @param[in] entry     next hop the packet was sent to, as returned by
+ *                      @ref gnrc_ipv6_fwd_cache_get()
+ */
+void gnrc_ipv6_fwd_cache_hit(const gnrc_ipv6_fwd_cache_entry_t *entry);
+
+/**
+ * @brief   Gets the current generation of the cache
+ *
+ * Get it before resolving a next hop that is added to the cache, so a NIB
+ * change in between is not missed.
+ *
+ * @return  the current generation of the cache
+ */
+uint32_t gnrc_ipv6_fwd_cache_generation(void);
+
+/**
+ * @brief   Adds the next hop of a flow to the cache
+ *
+ * Counts the packet as a miss. The next hop is not added if its neighbor
+ * cache entry is neither reachable nor unmanaged, or if the cache was
+ * invalidated since @p generation.
+ *
+ * @note    Only the IPv6 thread may use the cache.
+ *
+ * @param[in] dst           destination address of the flow
+ * @param[in] in_iface      interface the flow is received on
+ * @param[in] nce           neighbor cache entry of the next hop, as resolved
+ *                          by @ref gnrc_ipv6_nib_get_next_hop_l2addr()
+ * @param[in] generation    generation of the cache before resolving @p nce
+ */
+void gnrc_ipv6_fwd_cache_add(const ipv6_addr_t *dst, kernel_pid_t in_iface,
+                             const gnrc_ipv6_nib_nc_t *nce, uint32_t generation);
+
+/**
+ * @brief   Invalidates all flows in the cache
+ *
+ * Called by the NIB on every change that may affect a next hop.
+ */
+void gnrc_ipv6_fwd_cache_invalidate(void);
+
+/**
+ * @brief   Gets the statistics of the cache
+ *
+ * @param[out] stats    statistics
+ */
+void gnrc_ipv6_fwd_cache_stats_get(gnrc_ipv6_fwd_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -309,6 +309,31 @@ extern "C" {
 #  define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF            (8)
 #endif
 
+/**
+ * @brief   Index on-link and off-link entries for sub-linear lookup
+ *
+ * When set to 1, on-link entries are additionally kept in a hash table keyed
+ * on their IPv6 address and off-link entries in a path-compressed prefix trie.
+ * This trades `O(n)` scans of the NIB arrays on every forwarded packet for a
+ * few bytes of RAM per entry, which pays off on nodes with large
+ * @ref CONFIG_GNRC_IPV6_NIB_NUMOF and @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF
+ * (e.g. 6LBRs).
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_INDEX
+#  define CONFIG_GNRC_IPV6_NIB_INDEX                 0
+#endif
+
+/**
+ * @brief   Number of hash buckets for the on-link entry index
+ *
+ * @pre     Must be a power of 2.
+ *
+ * Only used with @ref CONFIG_GNRC_IPV6_NIB_INDEX.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_INDEX_BUCKETS
+#  define CONFIG_GNRC_IPV6_NIB_INDEX_BUCKETS         (16)
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
@@ -92,6 +92,17 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   Maximum number of messages a GNRC thread takes from its message
+ *          queue at once with @ref msg_receive_bulk()
+ *
+ * Also the number of messages @ref gnrc_netapi_send_bulk() and
+ * @ref gnrc_netapi_receive_bulk() deliver per critical section.
+ */
+#ifndef CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE
+#define CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE   (4U)
+#endif
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -118,6 +129,29 @@ typedef struct {
  */
 int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type);
 
+/**
+ * @brief   Shortcut function for sending multiple @ref GNRC_NETAPI_MSG_TYPE_SND
+ *          or @ref GNRC_NETAPI_MSG_TYPE_RCV messages to the same module
+ *
+ * The messages are delivered with @ref msg_try_send_bulk() in batches of
+ * @ref CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE, so the targeted module gets
+ * scheduled once per batch instead of once per packet.
+ *
+ * @param[in] pid       PID of the targeted network module
+ * @param[in] pkts      pointers into the packet buffer holding the data to send
+ * @param[in] num       number of packets in @p pkts
+ * @param[in] type      type of the messages to send. Must be either
+ *                      @ref GNRC_NETAPI_MSG_TYPE_SND or
+ *                      @ref GNRC_NETAPI_MSG_TYPE_RCV
+ *
+ * @return              number of packets successfully delivered, counted from
+ *                      the start of @p pkts. The caller keeps ownership of the
+ *                      others.
+ * @return              -1 on error (invalid PID)
+ */
+int _gnrc_netapi_send_recv_bulk(kernel_pid_t pid, gnrc_pktsnip_t **pkts,
+                                unsigned num, uint16_t type);
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET or
  *          @ref GNRC_NETAPI_MSG_TYPE_SET messages and parsing the returned
@@ -154,6 +188,25 @@ static inline int gnrc_netapi_send(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
     return _gnrc_netapi_send_recv(pid, pkt, GNRC_NETAPI_MSG_TYPE_SND);
 }
 
+/**
+ * @brief   Shortcut function for sending multiple
+ *          @ref GNRC_NETAPI_MSG_TYPE_SND messages
+ *
+ * @see _gnrc_netapi_send_recv_bulk()
+ *
+ * @param[in] pid       PID of the targeted network module
+ * @param[in] pkts      pointers into the packet buffer holding the data to send
+ * @param[in] num       number of packets in @p pkts
+ *
+ * @return              number of packets successfully delivered
+ * @return              -1 on error (invalid PID)
+ */
+static inline int gnrc_netapi_send_bulk(kernel_pid_t pid, gnrc_pktsnip_t **pkts,
+                                        unsigned num)
+{
+    return _gnrc_netapi_send_recv_bulk(pid, pkts, num, GNRC_NETAPI_MSG_TYPE_SND);
+}
+
 /**
  * @brief   Sends @p cmd to all subscribers to (@p type, @p demux_ctx).
  *
@@ -197,6 +250,26 @@ static inline int gnrc_netapi_receive(kernel_pid_t pid, gnrc_pktsnip_t *pkt)
     return _gnrc_netapi_send_recv(pid, pkt, GNRC_NETAPI_MSG_TYPE_RCV);
 }
 
+/**
+ * @brief   Shortcut function for sending multiple
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV messages
+ *
+ * @see _gnrc_netapi_send_recv_bulk()
+ *
+ * @param[in] pid       PID of the targeted network module
+ * @param[in] pkts      pointers into the packet buffer holding the received
+ *                      data
+ * @param[in] num       number of packets in @p pkts
+ *
+ * @return              number of packets successfully delivered
+ * @return              -1 on error (invalid PID)
+ */
+static inline int gnrc_netapi_receive_bulk(kernel_pid_t pid,
+                                           gnrc_pktsnip_t **pkts, unsigned num)
+{
+    return _gnrc_netapi_send_recv_bulk(pid, pkts, num, GNRC_NETAPI_MSG_TYPE_RCV);
+}
+
 /**
  * @brief   Sends a @ref GNRC_NETAPI_MSG_TYPE_RCV command to all subscribers to
  *          (@p type, @p demux_ctx).
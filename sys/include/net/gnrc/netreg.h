@@ -35,6 +35,27 @@
 extern "C" {
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf GNRC netreg compile configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of hash buckets per protocol type to demultiplex entries by
+ *          gnrc_netreg_entry_t::demux_ctx.
+ *
+ * @details Lookups only walk the entries of one bucket, so with many
+ *          registrations of one type (e.g. many bound UDP ports) they stay
+ *          short. Entries registered with @ref GNRC_NETREG_DEMUX_CTX_ALL are
+ *          kept in a separate list per type. Each bucket costs one pointer
+ *          per @ref gnrc_nettype_t. Must be a power of 2, 1 results in a
+ *          plain list per type.
+ */
+#ifndef CONFIG_GNRC_NETREG_DEMUX_BUCKETS
+#define CONFIG_GNRC_NETREG_DEMUX_BUCKETS    (8U)
+#endif
+/** @} */
+
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS) || \
     defined(DOXYGEN)
 /**
@@ -343,6 +364,9 @@ static inline void gnrc_netreg_entry_init_cb(gnrc_netreg_entry_t *entry,
  * @warning Call gnrc_netreg_unregister() *before* you leave the context you
  *          allocated @p entry in. Otherwise it might get overwritten.
  *
+ * @note    gnrc_netreg_entry_t::demux_ctx of @p entry must not be changed
+ *          while it is registered.
+ *
  * @pre The calling thread must provide a [message queue](@ref msg_init_queue)
  *      when using @ref GNRC_NETREG_TYPE_DEFAULT for gnrc_netreg_entry_t::type
  *      of @p entry.
@@ -167,6 +167,69 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
  */
 int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size);
 
+/**
+ * @brief   Marks the beginning of @p pkt as headroom that can be given back to
+ *          @p pkt later.
+ *
+ * Works like @ref gnrc_pktbuf_mark() with type @ref GNRC_NETTYPE_UNDEF, but
+ * keeps the marked bytes in front of the new gnrc_pktsnip_t::data of @p pkt.
+ * A protocol that replaces a header with a longer one, e.g. IPHC
+ * decompression, can then use @ref gnrc_pktbuf_take_headroom() to write the
+ * new header directly in front of the payload instead of allocating a new
+ * snip and copying the payload behind it.
+ *
+ * The returned snip is inserted behind @p pkt like with gnrc_pktbuf_mark().
+ * Its content is undefined and its size may be smaller than @p size, it
+ * must only be passed to gnrc_pktbuf_take_headroom() or released.
+ *
+ * @note    Only `gnrc_pktbuf_static` and @ref net_gnrc_pktbuf_slab keep the
+ *          headroom in place. With other implementations this is
+ *          gnrc_pktbuf_mark() and the headroom can not be taken.
+ *
+ * @pre @p pkt != NULL && @p size != 0 && @p size < pkt->size
+ *
+ * @param[in] pkt   A received packet.
+ * @param[in] size  Number of bytes at the beginning of @p pkt to mark.
+ *
+ * @return  The headroom snip in @p pkt on success.
+ * @return  NULL, if pkt == NULL or size == 0 or size >= pkt->size or pkt->data == NULL.
+ * @return  NULL, if no space is left in the packet buffer.
+ */
+gnrc_pktsnip_t *gnrc_pktbuf_mark_headroom(gnrc_pktsnip_t *pkt, size_t size);
+
+/**
+ * @brief   Extends gnrc_pktsnip_t::data of @p pkt to the front into the
+ *          headroom of @p pkt.
+ *
+ * ~~~~~~~~~~~~~~~~~~~
+ * Before                                    After
+ * ======                                    =====
+ *
+ *  headroom->data   pkt->data                headroom->data    pkt->data
+ *  v                v                        v                 v
+ * +----------------+----------------+       +-----------+----+----------------+
+ * +----------------+----------------+       +-----------+----+----------------+
+ *                   \__pkt->size___/                     \______pkt->size_____/
+ * ~~~~~~~~~~~~~~~~~~~
+ *
+ * The content of the @p size new bytes of @p pkt is undefined. On success,
+ * @p headroom keeps only the bytes that were not taken and may end up empty.
+ * It stays in the packet and still needs to be removed or released.
+ *
+ * @param[in] pkt       A packet snip.
+ * @param[in] headroom  The headroom of @p pkt as returned by
+ *                      @ref gnrc_pktbuf_mark_headroom().
+ * @param[in] size      Number of bytes to extend @p pkt by.
+ *
+ * @return  0, on success.
+ * @return  -ENOSPC, if @p headroom is not directly in front of @p pkt, is
+ *          smaller than @p size or either snip is shared by several users.
+ * @return  -ENOTSUP, if the packet buffer implementation does not support
+ *          headroom.
+ */
+int gnrc_pktbuf_take_headroom(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *headroom,
+                              size_t size);
+
 /**
  * @brief   Increases gnrc_pktsnip_t::users of @p pkt atomically.
  *
@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_gnrc_pktbuf_slab  Size-class packet buffer
+ * @ingroup     net_gnrc_pktbuf
+ * @brief       Implementation of @ref net_gnrc_pktbuf with per-size-class
+ *              slabs
+ *
+ * This implementation of @ref net_gnrc_pktbuf divides the
+ * @ref CONFIG_GNRC_PKTBUF_SIZE bytes of the packet buffer into four slabs of
+ * equally sized blocks:
+ *
+ * - one for @ref gnrc_pktsnip_t headers (and payloads that fit into one),
+ * - one of @ref CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE blocks for small headers,
+ * - one of @ref CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE blocks for medium sized
+ *   payloads, e.g. IEEE 802.15.4 frames, and
+ * - one of @ref CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE blocks for full-MTU
+ *   packets.
+ *
+ * Each slab keeps a free list of its blocks, so allocation and release are
+ * `O(1)` and the packet buffer does not fragment under mixed-size traffic. If
+ * the slab an allocation fits best is exhausted, it is served from the next
+ * larger one.
+ *
+ * The price is internal fragmentation (space lost by rounding up to the
+ * block size of a slab). It and the high-water mark of each slab are tracked,
+ * see @ref gnrc_pktbuf_slab_get_usage(), so the share of each slab and
+ * @ref CONFIG_GNRC_PKTBUF_SIZE can be tuned from measurements.
+ *
+ * To use this implementation instead of @ref gnrc_pktbuf_static, add
+ *
+ *     USEMODULE += gnrc_pktbuf_slab
+ *
+ * to the application Makefile.
+ *
+ * @{
+ *
+ * @file
+ * @brief   Size-class packet buffer definitions
+ */
+
+#include <stddef.h>
+
+#include "net/gnrc/pktbuf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup net_gnrc_pktbuf_slab_conf GNRC size-class packet buffer
+ *           compile configurations
+ * @ingroup net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Size of a block in the small slab in bytes
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (64U)
+#endif
+
+/**
+ * @brief   Size of a block in the medium slab in bytes
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE     (256U)
+#endif
+
+/**
+ * @brief   Size of a block in the large slab in bytes
+ *
+ * This is the largest packet that can be allocated in one piece. The default
+ * fits a full Ethernet frame.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (1536U)
+#endif
+
+/**
+ * @brief   Share of @ref CONFIG_GNRC_PKTBUF_SIZE used for the
+ *          @ref gnrc_pktsnip_t slab in percent
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_SHARE
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_SHARE      (15U)
+#endif
+
+/**
+ * @brief   Share of @ref CONFIG_GNRC_PKTBUF_SIZE used for the small slab in
+ *          percent
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SHARE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SHARE     (15U)
+#endif
+
+/**
+ * @brief   Share of @ref CONFIG_GNRC_PKTBUF_SIZE used for the medium slab in
+ *          percent
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SHARE
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SHARE    (20U)
+#endif
+/** @} */
+
+/**
+ * @brief   Number of slabs
+ *
+ * The large slab gets the rest of @ref CONFIG_GNRC_PKTBUF_SIZE.
+ */
+#define GNRC_PKTBUF_SLAB_NUMOF                  (4U)
+
+/**
+ * @brief   Usage statistics of a single slab
+ */
+typedef struct {
+    size_t block_size;      /**< size of a block in bytes */
+    unsigned numof;         /**< number of blocks */
+    unsigned used;          /**< number of blocks currently in use */
+    unsigned max_used;      /**< high-water mark of gnrc_pktbuf_slab_stats_t::used */
+} gnrc_pktbuf_slab_stats_t;
+
+/**
+ * @brief   Usage statistics of the whole packet buffer
+ */
+typedef struct {
+    /**
+     * @brief   Bytes currently requested by users of the packet buffer
+     */
+    size_t requested;
+    /**
+     * @brief   Bytes of all blocks currently in use
+     *
+     * `reserved - requested` is the internal fragmentation
+     */
+    size_t reserved;
+    size_t max_reserved;    /**< high-water mark of reserved */
+    /**
+     * @brief   Number of allocations that had to use a larger slab, because
+     *          the best fitting one was exhausted
+     */
+    unsigned spills;
+    unsigned fails;         /**< Number of failed allocations */
+    /**
+     * @brief   Statistics of the single slabs, ordered by block size
+     */
+    gnrc_pktbuf_slab_stats_t slabs[GNRC_PKTBUF_SLAB_NUMOF];
+} gnrc_pktbuf_slab_usage_t;
+
+/**
+ * @brief   Gets the usage statistics of the packet buffer
+ *
+ * High-water marks and counters are reset by @ref gnrc_pktbuf_init().
+ *
+ * @param[out] usage    The usage statistics. Must not be NULL.
+ */
+void gnrc_pktbuf_slab_get_usage(gnrc_pktbuf_slab_usage_t *usage);
+
+/**
+ * @brief   Calculates the internal fragmentation from usage statistics
+ *
+ * @param[in] usage The usage statistics. Must not be NULL.
+ *
+ * @return  Part of gnrc_pktbuf_slab_usage_t::reserved not requested by users
+ *          of the packet buffer in per mille.
+ */
+static inline unsigned gnrc_pktbuf_slab_fragmentation(const gnrc_pktbuf_slab_usage_t *usage)
+{
+    if (usage->reserved == 0) {
+        return 0;
+    }
+    return ((usage->reserved - usage->requested) * 1000U) / usage->reserved;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
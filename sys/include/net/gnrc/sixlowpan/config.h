@@ -57,6 +57,28 @@ extern "C" {
 #define CONFIG_GNRC_SIXLOWPAN_MSG_QUEUE_SIZE_EXP   (3U)
 #endif
 
+/**
+ * @brief   Headroom in bytes an IEEE 802.15.4 interface reserves in front of a
+ *          received frame for IPHC decompression.
+ *
+ * With headroom, @ref net_gnrc_sixlowpan_iphc decompresses the headers of an
+ * unfragmented datagram directly in front of its payload, instead of
+ * allocating a new packet buffer entry for the IPv6 header and copying the
+ * payload behind it. The space of the link-layer header is reused as well.
+ * Decompression grows the IPv6 header by at most 38 bytes and a UDP header by
+ * at most 6 bytes, so 48 bytes cover the common datagrams. If the headroom of
+ * a frame does not suffice, the datagram is decompressed into a new buffer as
+ * without headroom.
+ *
+ * @note    0 (default) disables the headroom. The headroom only avoids
+ *          copies with `gnrc_pktbuf_static` or @ref net_gnrc_pktbuf_slab.
+ *          It is not used for fragmented datagrams, they are decompressed
+ *          into the reassembly buffer.
+ */
+#ifndef CONFIG_GNRC_SIXLOWPAN_IPHC_RX_HEADROOM
+#define CONFIG_GNRC_SIXLOWPAN_IPHC_RX_HEADROOM     (0U)
+#endif
+
 /**
  * @brief   Number of datagrams that can be fragmented simultaneously
  *
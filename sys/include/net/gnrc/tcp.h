@@ -21,6 +21,7 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
@@ -213,6 +214,9 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ *       With a send buffer (@ref CONFIG_GNRC_TCP_SND_BUF_SIZE), blocks only
+ *       until up to @p len bytes were stored in the send buffer, they are
+ *       transmitted in the background.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
@@ -287,6 +291,43 @@ void gnrc_tcp_close(gnrc_tcp_tcb_t *tcb);
  */
 void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Disable or enable the Nagle algorithm of a connection.
+ *
+ * With a send buffer, a segment smaller than the maximum segment size is held
+ * back while previously sent data is unacknowledged, so small writes are
+ * coalesced into fewer segments (Nagle algorithm). It is enabled by default.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     nodelay   Send small segments right away if true.
+ *
+ * @return   0 on success.
+ * @return   -ENOTSUP if @ref CONFIG_GNRC_TCP_SND_BUF_SIZE is zero.
+ */
+int gnrc_tcp_set_nodelay(gnrc_tcp_tcb_t *tcb, bool nodelay);
+
+/**
+ * @brief Cork or uncork a connection.
+ *
+ * While a connection is corked, only segments of the maximum segment size
+ * are sent from the send buffer, regardless of unacknowledged data. Uncorking
+ * or closing the connection sends the remaining data. This allows to build a
+ * message from several small writes without sending a segment for each.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     cork   Cork the connection if true, uncork it otherwise.
+ *
+ * @return   0 on success.
+ * @return   -ENOTSUP if @ref CONFIG_GNRC_TCP_SND_BUF_SIZE is zero.
+ */
+int gnrc_tcp_set_cork(gnrc_tcp_tcb_t *tcb, bool cork);
+
 /**
  * @brief Close connections and stop listening on TCB queue
  *
@@ -107,6 +107,76 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Size of the send buffer of a connection in bytes. Zero disables it.
+ *
+ * Without a send buffer, gnrc_tcp_send() blocks until the data it sent was
+ * acknowledged. With a send buffer, gnrc_tcp_send() returns as soon as the
+ * data is buffered, and the data of several calls is sent as the window of
+ * the peer allows. Small writes are then coalesced by the Nagle algorithm,
+ * see gnrc_tcp_set_nodelay() and gnrc_tcp_set_cork().
+ *
+ * @note Each TCB holds its own send buffer. To have more than one segment in
+ *       flight, increase @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE as well.
+ */
+#ifndef CONFIG_GNRC_TCP_SND_BUF_SIZE
+#define CONFIG_GNRC_TCP_SND_BUF_SIZE (0U)
+#endif
+
+/**
+ * @brief Number of segments in the retransmission queue, i.e. the maximum
+ *        number of unacknowledged segments in flight.
+ *
+ * @note Fast retransmit needs three duplicate acknowledgements, so at least
+ *       four segments must be in flight to recover from a loss without
+ *       waiting for the retransmission timeout.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (1U)
+#endif
+
+/**
+ * @brief Number of blocks received out of order that are kept in the receive
+ *        buffer and reported to the peer in SACK options (RFC 2018).
+ *
+ * @note A SACK option holds at most four blocks.
+ */
+#ifndef CONFIG_GNRC_TCP_SACK_BLOCKS
+#define CONFIG_GNRC_TCP_SACK_BLOCKS (3U)
+#endif
+
+/**
+ * @brief Enable window scaling (RFC 7323). Disabled by default.
+ *
+ * @note Only a receive buffer larger than 64 KiB needs a scaled window,
+ *       a connection to a peer with a large window may use it for sending.
+ */
+#ifndef CONFIG_GNRC_TCP_WND_SCALE_EN
+#define CONFIG_GNRC_TCP_WND_SCALE_EN 0
+#endif
+
+/**
+ * @brief Number of buckets of the connection table (as exponent of 2^n).
+ *
+ * Received segments are matched to their connection by a hash of the address
+ * and the port numbers of the peer and the local port number. With more
+ * connections than buckets, a lookup compares several connections.
+ */
+#ifndef CONFIG_GNRC_TCP_CONN_TABLE_SIZE_EXP
+#define CONFIG_GNRC_TCP_CONN_TABLE_SIZE_EXP (3U)
+#endif
+
+/**
+ * @brief Number of handshakes in progress per listening queue.
+ *
+ * A connection request of the SYN backlog takes only a few bytes. A TCB of
+ * the queue is used when the handshake completes. If the backlog is full,
+ * the oldest request is replaced.
+ */
+#ifndef CONFIG_GNRC_TCP_SYN_BACKLOG_SIZE
+#define CONFIG_GNRC_TCP_SYN_BACKLOG_SIZE (4U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
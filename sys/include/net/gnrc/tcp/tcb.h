@@ -19,6 +19,7 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "ringbuffer.h"
 #include "mutex.h"
@@ -37,6 +38,47 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Block of sequence numbers received out of order (SACK block).
+ */
+typedef struct {
+    uint32_t left;  /**< First sequence number of the block */
+    uint32_t right; /**< Sequence number following the block */
+} gnrc_tcp_sack_block_t;
+
+/**
+ * @brief Segment in the retransmission queue of GNRC TCP.
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt; /**< Packet of the segment */
+    uint32_t seq;        /**< Sequence number of the segment */
+    uint16_t len;        /**< Sequence number consumption of the segment */
+    bool sacked;         /**< Segment was selectively acknowledged */
+    bool retransmitted;  /**< Segment was retransmitted in the current loss recovery */
+} gnrc_tcp_rtx_seg_t;
+
+/**
+ * @brief Connection request in the SYN backlog of a listening queue.
+ *
+ * Holds the state of a passive open until the handshake completes, a TCB of
+ * the queue is only used for connections that are established.
+ */
+typedef struct {
+#ifdef MODULE_GNRC_IPV6
+    uint8_t local_addr[sizeof(ipv6_addr_t)];  /**< Local IP address */
+    uint8_t peer_addr[sizeof(ipv6_addr_t)];   /**< Peer IP address */
+    int8_t  ll_iface;                         /**< Link layer interface id to use. */
+#endif
+    uint16_t peer_port;    /**< Peer port number, unspecified if the entry is free */
+    uint16_t mss;          /**< The peers MSS */
+    uint16_t status;       /**< Options negotiated by the SYN */
+    uint8_t snd_wscale;    /**< Window scale shift count of the peer */
+    uint32_t snd_wnd;      /**< Send window */
+    uint32_t iss;          /**< Initial sequence number */
+    uint32_t irs;          /**< Initial received sequence number */
+    uint32_t time;         /**< Time the SYN was received */
+} gnrc_tcp_syn_req_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -50,18 +92,25 @@ typedef struct sock_tcp {
     uint16_t local_port;   /**< Local connections port number */
     uint16_t peer_port;    /**< Peer connections port number */
     uint8_t state;         /**< Connections state */
-    uint8_t status;        /**< A connections status flags */
+    uint16_t status;       /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
-    uint16_t snd_wnd;      /**< Send window */
+    uint32_t snd_wnd;      /**< Send window */
     uint32_t snd_wl1;      /**< SeqNo. from last window update */
     uint32_t snd_wl2;      /**< AckNo. from last window update */
     uint32_t rcv_nxt;      /**< Receive next */
-    uint16_t rcv_wnd;      /**< Receive window */
+    uint32_t rcv_wnd;      /**< Receive window */
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
+    uint8_t snd_wscale;    /**< Window scale shift count of the peer */
+    uint8_t rcv_wscale;    /**< Window scale shift count announced to the peer */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t recover;      /**< Send next when loss recovery started */
+    uint8_t dup_acks;      /**< Number of duplicate acknowledgements received */
     uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t rtt_seq;      /**< AckNo. ending rtt estimation */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
@@ -69,13 +118,27 @@ typedef struct sock_tcp {
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Segments in "retransmit queue", oldest first
+     */
+    gnrc_tcp_rtx_seg_t rtx_queue[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    uint8_t rtx_len;                      /**< Number of segments in rtx_queue */
+    /**
+     * @brief Blocks received out of order, most recent first
+     */
+    gnrc_tcp_sack_block_t sack[CONFIG_GNRC_TCP_SACK_BLOCKS];
+    uint8_t sack_len;                     /**< Number of blocks in sack */
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+    ringbuffer_t snd_buf;    /**< Send buffer data structure, holds data not sent yet */
+    char snd_buf_raw[CONFIG_GNRC_TCP_SND_BUF_SIZE]; /**< Send buffer storage */
+#endif
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
     struct sock_tcp *next;   /**< Pointer next TCB */
+    struct sock_tcp *hnext;  /**< Pointer next TCB in the same connection table bucket */
 } gnrc_tcp_tcb_t;
 
 /**
@@ -85,12 +148,17 @@ typedef struct sock_tcp_queue {
     mutex_t lock;         /**< Mutex for access synchronization */
     gnrc_tcp_tcb_t *tcbs; /**< Pointer to TCB sequence */
     size_t tcbs_len;      /**< Number of TCBs behind member tcbs */
+    /**
+     * @brief Handshakes in progress, not bound to a TCB yet
+     */
+    gnrc_tcp_syn_req_t syn_backlog[CONFIG_GNRC_TCP_SYN_BACKLOG_SIZE];
+    struct sock_tcp_queue *next; /**< Pointer next listening queue */
 } gnrc_tcp_tcb_queue_t;
 
 /**
  * @brief Static initializer for type gnrc_tcp_tcb_queue_t
  */
-#define GNRC_TCP_TCB_QUEUE_INIT   { MUTEX_INIT, NULL, 0 }
+#define GNRC_TCP_TCB_QUEUE_INIT   { .lock = MUTEX_INIT }
 
 #ifdef __cplusplus
 }
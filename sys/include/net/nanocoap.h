@@ -2183,7 +2183,8 @@ ssize_t coap_handle_req(coap_pkt_t *pkt, uint8_t *resp_buf, unsigned resp_buf_le
  * @brief   Pass a coap request to a matching handler
  *
  * This function will try to find a matching handler in @p resources and call
- * the handler.
+ * the handler. The resources are compared in turn, for many resources see
+ * @ref net_nanocoap_uri_trie.
  *
  * @param[in]   pkt             pointer to (parsed) CoAP packet
  * @param[out]  resp_buf        buffer for response
@@ -13,6 +13,14 @@
  * @ingroup     net_nanocoap
  * @brief       A cache implementation for nanocoap response messages
  *
+ * Entries are found by a hash index on their cache key and kept in a doubly
+ * linked list in least recently used order, so lookups, updates and
+ * replacements do not depend on the number of entries. The responses are
+ * stored back to back in a shared arena of
+ * @ref CONFIG_NANOCOAP_CACHE_ARENA_SIZE bytes, every entry only takes as much
+ * of it as its response needs. If the arena runs out of space, it is
+ * compacted first, then the least recently used entries are replaced.
+ *
  * @{
  *
  * @file
@@ -48,21 +56,49 @@ extern "C" {
 #endif
 
 /**
- * @brief Size of the buffer to store responses in the cache.
+ * @brief Maximum size of a single response in the cache.
  */
 #ifndef CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE
 #define CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE    (128)
 #endif
 
+/**
+ * @brief Size of the arena shared by the responses in the cache.
+ *
+ * Defaults to the space the responses took when every entry had a buffer of
+ * @ref CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE bytes.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_ARENA_SIZE
+#define CONFIG_NANOCOAP_CACHE_ARENA_SIZE \
+    (CONFIG_NANOCOAP_CACHE_ENTRIES * CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE)
+#endif
+
+/**
+ * @brief Number of hash buckets to index the cache entries by their key.
+ *
+ * Must be a power of 2, at most 256.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_HASH_BUCKETS
+#define CONFIG_NANOCOAP_CACHE_HASH_BUCKETS     (8)
+#endif
+
 /**
  * @brief   Cache container that holds a @p coap_pkt_t struct.
  */
-typedef struct {
+typedef struct nanocoap_cache_entry {
     /**
      * @brief needed for clist_t, must be the first struct member!
+     *
+     * Links the unused entries.
      */
     clist_node_t node;
 
+    struct nanocoap_cache_entry *lru_prev;      /**< previous entry in LRU
+                                                     order */
+    struct nanocoap_cache_entry *lru_next;      /**< next entry in LRU order */
+    struct nanocoap_cache_entry *next_by_key;   /**< next entry in the same
+                                                     hash bucket */
+
     /**
      * @brief the calculated cache key, see nanocoap_cache_key_generate().
      */
@@ -74,9 +110,9 @@ typedef struct {
     coap_pkt_t response_pkt;
 
     /**
-     * @brief buffer to hold the response message.
+     * @brief the response message, in the arena of the cache.
      */
-    uint8_t response_buf[CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE];
+    uint8_t *response_buf;
 
     size_t response_len; /**< length of the message in @p response */
 
@@ -92,6 +128,15 @@ typedef struct {
     uint32_t max_age;
 } nanocoap_cache_entry_t;
 
+/**
+ * @brief   Statistics of the cache
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an entry */
+    uint32_t misses;        /**< lookups that found no entry */
+    uint32_t evictions;     /**< entries replaced to make space */
+} nanocoap_cache_stats_t;
+
 /**
  * @brief Typedef for the cache replacement strategy on full cache list.
  *
@@ -136,6 +181,22 @@ size_t nanocoap_cache_used_count(void);
  */
 size_t nanocoap_cache_free_count(void);
 
+/**
+ * @brief   Returns the number of bytes of the arena used by responses.
+ *
+ * @return  Number of bytes used
+ */
+size_t nanocoap_cache_arena_used(void);
+
+/**
+ * @brief   Gets the statistics of the cache
+ *
+ * The statistics are reset by @ref nanocoap_cache_init().
+ *
+ * @param[out] stats    the statistics
+ */
+void nanocoap_cache_stats_get(nanocoap_cache_stats_t *stats);
+
 /**
  * @brief   Determines if a response is cacheable and modifies the cache
  *          as reflected in RFC7252, Section 5.9.
@@ -158,6 +219,10 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
  * @param[in] resp          The response to add to the cache
  * @param[in] resp_len      The actual length of the response message in @p resp
  *
+ * @note    Adding a response may move the responses of other entries within
+ *          the arena, so pointers into nanocoap_cache_entry_t::response_buf
+ *          must not be kept across this call.
+ *
  * @return  The previously existing or newly added cache entry on success
  * @return  NULL, if there is no space left
  */
@@ -173,6 +238,10 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_req(const coap_pkt_t *req,
  * @param[in] resp            The response to add to the cache
  * @param[in] resp_len        The actual length of the response in @p resp
  *
+ * @note    Adding a response may move the responses of other entries within
+ *          the arena, so pointers into nanocoap_cache_entry_t::response_buf
+ *          must not be kept across this call.
+ *
  * @return  The previously existing or newly added cache entry on success
  * @return  NULL, if there is no space left
  */
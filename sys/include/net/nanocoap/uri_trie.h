@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    net_nanocoap_uri_trie NanoCoAP URI-Path trie
+ * @ingroup     net_nanocoap
+ * @brief       Resource dispatch by a radix trie of the resource paths
+ *
+ * @ref coap_tree_handler() compares the URI-Path of a request to every
+ * resource in turn, so the cost of dispatching a request grows with the number
+ * of resources. This module builds a radix trie of the resource paths once,
+ * then matches the Uri-Path options of a request byte by byte against it,
+ * without assembling the path in a buffer first. The cost of a lookup only
+ * depends on the length of the path.
+ *
+ * The trie is built in memory provided by the user and does not copy the
+ * paths, so the resources must stay unchanged while the trie is used. A
+ * lookup yields the same resource @ref coap_tree_handler() would pick, i.e.
+ * the first resource in the array with a matching path and method, including
+ * @ref COAP_MATCH_SUBTREE semantics. Unlike @ref coap_tree_handler(), the
+ * length of the path is not limited by @ref CONFIG_NANOCOAP_URI_MAX.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static const coap_resource_t _resources[] = { ... };
+ * static coap_uri_trie_node_t _nodes[COAP_URI_TRIE_NODES_NUMOF(ARRAY_SIZE(_resources))];
+ * static uint16_t _next[ARRAY_SIZE(_resources)];
+ * static coap_uri_trie_t _trie = COAP_URI_TRIE_INIT(_nodes, _next);
+ *
+ * coap_uri_trie_build(&_trie, _resources, ARRAY_SIZE(_resources));
+ * ...
+ * coap_uri_trie_handler(pkt, buf, len, ctx, &_trie);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * gcoap builds the trie of a listener on registration if
+ * @ref gcoap_listener_t::uri_trie is set.
+ *
+ * @{
+ *
+ * @file
+ * @brief       NanoCoAP URI-Path trie definitions
+ */
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "container.h"
+#include "net/nanocoap.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of trie nodes needed for @p numof resources in the worst
+ *          case
+ *
+ * Every resource adds at most a leaf and the node splitting an edge for it,
+ * plus the root node.
+ */
+#define COAP_URI_TRIE_NODES_NUMOF(numof)    (2 * (numof) + 1)
+
+/**
+ * @brief   Node of a @ref coap_uri_trie_t
+ *
+ * Node indices are offsets into coap_uri_trie_t::nodes, index 0 is the root,
+ * which never is a child, so 0 marks the end of a list.
+ */
+typedef struct {
+    const char *label;      /**< label of the edge to this node, part of a
+                                 resource path */
+    uint16_t label_len;     /**< length of @ref label */
+    uint16_t child;         /**< first child node */
+    uint16_t sibling;       /**< next sibling node */
+    uint16_t resource;      /**< index + 1 of the first resource with the
+                                 path ending in this node, 0 if none */
+} coap_uri_trie_node_t;
+
+/**
+ * @brief   URI-Path trie of a resource array
+ */
+typedef struct {
+    const coap_resource_t *resources;   /**< resources of the trie */
+    coap_uri_trie_node_t *nodes;        /**< node storage */
+    uint16_t *next;                     /**< index + 1 of the next resource
+                                             with the same path, by resource */
+    uint16_t nodes_numof;               /**< size of @ref nodes */
+    uint16_t next_numof;                /**< size of @ref next */
+    uint16_t nodes_used;                /**< number of nodes in use */
+} coap_uri_trie_t;
+
+/**
+ * @brief   Static initializer for a @ref coap_uri_trie_t
+ *
+ * @param[in] node_buf  array of @ref coap_uri_trie_node_t, should hold
+ *                      @ref COAP_URI_TRIE_NODES_NUMOF() nodes
+ * @param[in] next_buf  array of uint16_t, one per resource
+ */
+#define COAP_URI_TRIE_INIT(node_buf, next_buf) {    \
+        .nodes = (node_buf),                        \
+        .next = (next_buf),                         \
+        .nodes_numof = ARRAY_SIZE(node_buf),        \
+        .next_numof = ARRAY_SIZE(next_buf),         \
+    }
+
+/**
+ * @brief   Builds the trie of the paths in @p resources
+ *
+ * @param[in,out] trie      trie with storage, see @ref COAP_URI_TRIE_INIT
+ * @param[in] resources     resources to dispatch to, must stay unchanged as
+ *                          long as @p trie is used
+ * @param[in] numof         number of elements in @p resources
+ *
+ * @return  0 on success
+ * @return  -ENOMEM if the storage of @p trie is too small
+ */
+int coap_uri_trie_build(coap_uri_trie_t *trie,
+                        const coap_resource_t *resources, size_t numof);
+
+/**
+ * @brief   Finds the resource matching the Uri-Path and method of @p pkt
+ *
+ * @param[in] trie          trie to search
+ * @param[in] pkt           request
+ * @param[out] resource     the matching resource
+ *
+ * @return  0 if a resource was found
+ * @return  -ENOENT if no resource matches the path
+ * @return  -ENOTSUP if resources match the path, but not the method
+ */
+int coap_uri_trie_lookup(const coap_uri_trie_t *trie, coap_pkt_t *pkt,
+                         const coap_resource_t **resource);
+
+/**
+ * @brief   Pass a coap request to the matching handler in @p trie
+ *
+ * Behaves like @ref coap_tree_handler() with the resources of @p trie.
+ *
+ * @param[in]   pkt             pointer to (parsed) CoAP packet
+ * @param[out]  resp_buf        buffer for response
+ * @param[in]   resp_buf_len    size of response buffer
+ * @param[in]   ctx             CoAP request context information
+ * @param[in]   trie            trie of the resources
+ *
+ * @returns     size of the reply packet on success
+ * @returns     <0 on error
+ */
+ssize_t coap_uri_trie_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                              unsigned resp_buf_len, coap_request_ctx_t *ctx,
+                              const coap_uri_trie_t *trie);
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
@@ -67,6 +67,10 @@ typedef struct {
     uint32_t tx_bytes;          /**< sent bytes */
     uint32_t rx_count;          /**< received (data) packets */
     uint32_t rx_bytes;          /**< received bytes */
+    uint32_t rx_wakeups;        /**< interrupts that received packets,
+                                     @ref rx_count per wakeup tells how
+                                     many packets were handled at once
+                                     (layer 2 only) */
 } netstats_t;
 
 /**
@@ -290,6 +290,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Maximum number of buffers a @ref sock_udp_recv_view_t lends out
+ *
+ * Datagrams scattered over more buffers of the stack are dropped by
+ * sock_udp_recv_view_aux().
+ */
+#ifndef CONFIG_SOCK_UDP_RECV_VIEW_SNIPS
+#define CONFIG_SOCK_UDP_RECV_VIEW_SNIPS     (4U)
+#endif
+
 typedef struct _sock_tl_ep sock_udp_ep_t;   /**< An end point for a UDP sock object */
 
 /**
@@ -632,6 +642,102 @@ static inline ssize_t sock_udp_recv_buf(sock_udp_t *sock,
     return sock_udp_recv_buf_aux(sock, data, buf_ctx, timeout, remote, NULL);
 }
 
+/**
+ * @brief   Zero-copy view of a received UDP datagram
+ *
+ * The buffers of the stack holding the payload of the datagram are lent out
+ * as scatter-gather list until sock_udp_recv_view_release() is called.
+ */
+typedef struct {
+    /**
+     * @brief   Payload of the datagram, the list starts at the first element
+     *
+     * Only as many elements as needed are linked by iolist_t::iol_next. For
+     * an empty payload, the first element has length 0.
+     */
+    iolist_t snips[CONFIG_SOCK_UDP_RECV_VIEW_SNIPS];
+    size_t len;                 /**< total length of the payload */
+    void *buf_ctx;              /**< stack-internal buffer context */
+} sock_udp_recv_view_t;
+
+/**
+ * @brief   Receives a UDP message without copying it out of the stack
+ *
+ * Unlike sock_udp_recv_buf_aux(), the whole payload is available after one
+ * call, even if the stack holds it in several buffers.
+ *
+ * @pre `(sock != NULL) && (view != NULL)`
+ *
+ * @note    Only available with the module `sock_udp_recv_view`, which is
+ *          provided by `gnrc_sock_udp`. Code that should work on all stacks
+ *          can check with `IS_USED(MODULE_SOCK_UDP_RECV_VIEW)` and fall back
+ *          to sock_udp_recv_aux().
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[out] view     View of the received payload. Must be passed to
+ *                      sock_udp_recv_view_release() once the payload is not
+ *                      used anymore, if the call succeeded.
+ * @param[in] timeout   Timeout for receive in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ * @param[out] remote   Remote end point of the received data.
+ *                      May be `NULL`, if it is not required by the application.
+ * @param[out] aux      Auxiliary data about the received datagram.
+ *                      May be `NULL`, if it is not required by the application.
+ *
+ * @note    Function blocks if no packet is currently waiting.
+ *
+ * @return  The number of bytes received on success, may be 0.
+ * @return  -EADDRNOTAVAIL, if local of @p sock is not given.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -EINVAL, if @p remote is invalid or @p sock is not properly
+ *          initialized (or closed while sock_udp_recv_view_aux() blocks).
+ * @return  -ENOBUFS, if the payload was scattered over more than
+ *          @ref CONFIG_SOCK_UDP_RECV_VIEW_SNIPS buffers. The datagram is
+ *          dropped.
+ * @return  -ENOMEM, if no memory was available to receive the datagram.
+ * @return  -EPROTO, if source address of received packet did not equal
+ *          the remote of @p sock.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+ssize_t sock_udp_recv_view_aux(sock_udp_t *sock, sock_udp_recv_view_t *view,
+                               uint32_t timeout, sock_udp_ep_t *remote,
+                               sock_udp_aux_rx_t *aux);
+
+/**
+ * @brief   Receives a UDP message without copying it out of the stack
+ *
+ * @see sock_udp_recv_view_aux()
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[out] view     View of the received payload.
+ * @param[in] timeout   Timeout for receive in microseconds.
+ * @param[out] remote   Remote end point of the received data.
+ *                      May be `NULL`, if it is not required by the application.
+ *
+ * @return  see sock_udp_recv_view_aux()
+ */
+static inline ssize_t sock_udp_recv_view(sock_udp_t *sock,
+                                         sock_udp_recv_view_t *view,
+                                         uint32_t timeout,
+                                         sock_udp_ep_t *remote)
+{
+    return sock_udp_recv_view_aux(sock, view, timeout, remote, NULL);
+}
+
+/**
+ * @brief   Returns the buffers lent out by a view to the stack
+ *
+ * The payload of @p view must not be accessed afterwards.
+ *
+ * @param[in] sock      The UDP sock object @p view was received with.
+ * @param[in] view      View filled by a successful call of
+ *                      sock_udp_recv_view_aux().
+ */
+void sock_udp_recv_view_release(sock_udp_t *sock, sock_udp_recv_view_t *view);
+
 /**
  * @brief   Sends a UDP message to remote end point with non-continuous payload
  *
@@ -42,6 +42,9 @@ extern "C" {
 #define TCP_OPTION_KIND_EOL (0x00)  /**< "End of List"-Option */
 #define TCP_OPTION_KIND_NOP (0x01)  /**< "No Operation"-Option */
 #define TCP_OPTION_KIND_MSS (0x02)  /**< "Maximum Segment Size"-Option */
+#define TCP_OPTION_KIND_WS  (0x03)  /**< "Window Scale"-Option */
+#define TCP_OPTION_KIND_SACK_PERM (0x04)  /**< "SACK Permitted"-Option */
+#define TCP_OPTION_KIND_SACK (0x05) /**< "SACK"-Option */
 /** @} */
 
 /**
@@ -50,8 +53,25 @@ extern "C" {
  */
 #define TCP_OPTION_LENGTH_MIN (2U)    /**< Minimum option field size in bytes */
 #define TCP_OPTION_LENGTH_MSS (0x04)  /**< MSS Option Size always 4 */
+#define TCP_OPTION_LENGTH_WS  (0x03)  /**< Window Scale Option Size always 3 */
+#define TCP_OPTION_LENGTH_SACK_PERM (0x02)  /**< SACK Permitted Option Size always 2 */
 /** @} */
 
+/**
+ * @brief Largest shift count of the "Window Scale"-Option (RFC 7323)
+ */
+#define TCP_OPTION_WS_MAX   (14U)
+
+/**
+ * @brief Size of a block in the "SACK"-Option (RFC 2018)
+ */
+#define TCP_OPTION_SACK_BLOCK_SIZE  (8U)
+
+/**
+ * @brief Maximum number of blocks in the "SACK"-Option (RFC 2018)
+ */
+#define TCP_OPTION_SACK_BLOCKS_MAX  (4U)
+
 /**
  * @brief TCP header definition
  */
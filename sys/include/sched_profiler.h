@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_sched_profiler Scheduler profiler
+ * @ingroup     sys
+ * @brief       Per-thread CPU time, context switch and wake-up latency
+ *              profiling
+ *
+ * This module hooks into the scheduler via @ref sched_register_cb and
+ * `sched_wakeup_callback()` and keeps for every thread
+ *
+ * - the CPU time it consumed,
+ * - how often it was scheduled,
+ * - how often it left the CPU voluntarily (it blocked, slept or exited),
+ * - how often it left the CPU involuntarily (it was still runnable, e.g. it
+ *   was preempted by a higher priority thread or called thread_yield()),
+ * - how many of the involuntary switches were preemptions by a thread woken
+ *   up from interrupt context, and
+ * - a histogram of the wake-up latency, i.e. the time from a thread becoming
+ *   runnable until it actually runs. Bucket 0 counts latencies of 0 µs,
+ *   bucket `i` latencies in `[2^(i - 1), 2^i)` µs, the last bucket also all
+ *   longer ones.
+ *
+ * The scheduler hooks take constant time, so the profiler can stay enabled
+ * in production builds. Its cost is a read of ZTIMER_USEC per wake-up and
+ * two per context switch, plus `sizeof(sched_profiler_stat_t)` bytes of RAM
+ * per possible thread.
+ *
+ * When used together with @ref schedstatistics, the profiler keeps the
+ * statistics of that module updated as well.
+ *
+ * The collected data is available via sched_profiler_get(), as a compact
+ * binary stream via sched_profiler_export() and via the `schedprof` shell
+ * command.
+ *
+ * Export format
+ * -------------
+ *
+ * All numbers are unsigned LEB128 varints (7 bits per byte, least significant
+ * group first, MSB set on all but the last byte). The stream starts with
+ *
+ * | field                                   | encoding          |
+ * |:--------------------------------------- |:----------------- |
+ * | magic                                   | `0x53 0x50` ("SP")|
+ * | @ref SCHED_PROFILER_EXPORT_VERSION      | byte              |
+ * | @ref CONFIG_SCHED_PROFILER_HIST_SIZE    | byte              |
+ * | time of the export in µs                | varint            |
+ *
+ * followed by a record per existing thread:
+ *
+ * | field                                   | encoding          |
+ * |:--------------------------------------- |:----------------- |
+ * | pid + 1                                 | varint            |
+ * | sched_profiler_stat_t::runtime_us       | varint            |
+ * | sched_profiler_stat_t::schedules        | varint            |
+ * | sched_profiler_stat_t::voluntary        | varint            |
+ * | sched_profiler_stat_t::involuntary      | varint            |
+ * | sched_profiler_stat_t::preempted_by_isr | varint            |
+ * | sched_profiler_stat_t::latency_max      | varint            |
+ * | sched_profiler_stat_t::latency_hist     | varint per bucket |
+ *
+ * and ends with a single `0` byte. When the idle time is tracked with
+ * KERNEL_PID_UNDEF (no `core_idle_thread`), it is exported with pid 0.
+ *
+ * @note        If auto_init is disabled, `sched_profiler_init()` needs to be
+ *              called after ztimer was initialized.
+ * @{
+ *
+ * @file
+ * @brief       Scheduler profiler interface
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_sched_profiler_config Scheduler profiler compile time configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of buckets of the wake-up latency histogram
+ *
+ * With the default of 16, the last bucket counts latencies of 16.384 ms and
+ * more.
+ */
+#ifndef CONFIG_SCHED_PROFILER_HIST_SIZE
+#define CONFIG_SCHED_PROFILER_HIST_SIZE     (16U)
+#endif
+/** @} */
+
+/**
+ * @brief   Version of the export format
+ */
+#define SCHED_PROFILER_EXPORT_VERSION       (1U)
+
+/**
+ * @brief   Profile of a thread
+ */
+typedef struct {
+    uint64_t runtime_us;        /**< CPU time consumed in µs */
+    uint32_t laststart;         /**< time the thread was last scheduled */
+    uint32_t woken_at;          /**< time the thread last became runnable */
+    uint32_t schedules;         /**< number of times the thread was scheduled */
+    uint32_t voluntary;         /**< number of voluntary switches */
+    uint32_t involuntary;       /**< number of involuntary switches */
+    uint32_t preempted_by_isr;  /**< number of involuntary switches to a
+                                     thread woken from interrupt context */
+    uint32_t latency_max;       /**< longest wake-up latency in µs */
+    /**
+     * @brief   Histogram of the wake-up latency, see @ref sys_sched_profiler
+     */
+    uint32_t latency_hist[CONFIG_SCHED_PROFILER_HIST_SIZE];
+    uint8_t flags;              /**< internal state of the profiler */
+} sched_profiler_stat_t;
+
+/**
+ * @brief   Output function for sched_profiler_export()
+ *
+ * @param[in]   data    chunk of the stream
+ * @param[in]   len     length of @p data in bytes
+ * @param[in]   arg     argument passed to sched_profiler_export()
+ */
+typedef void (*sched_profiler_write_t)(const void *data, size_t len, void *arg);
+
+/**
+ * @brief   Registers the scheduler callback and starts profiling
+ */
+void sched_profiler_init(void);
+
+/**
+ * @brief   Clears the profiles of all threads
+ */
+void sched_profiler_reset(void);
+
+/**
+ * @brief   Gets a consistent copy of the profile of a thread
+ *
+ * @param[in]   pid     thread to get the profile of, or KERNEL_PID_UNDEF for
+ *                      the idle time without `core_idle_thread`
+ * @param[out]  stat    copy of the profile
+ *
+ * @return  0 on success
+ * @return  -EINVAL, if @p pid is out of range
+ */
+int sched_profiler_get(kernel_pid_t pid, sched_profiler_stat_t *stat);
+
+/**
+ * @brief   Gets the lower bound of a bucket of the wake-up latency histogram
+ *
+ * @param[in]   bucket  index of the bucket
+ *
+ * @return  shortest latency in µs counted in @p bucket
+ */
+static inline uint32_t sched_profiler_bucket_min(unsigned bucket)
+{
+    return bucket ? (1LU << (bucket - 1)) : 0;
+}
+
+/**
+ * @brief   Writes the profiles of all threads as binary stream
+ *
+ * The format is described in @ref sys_sched_profiler. @p write is called
+ * once for the header, once per thread and once for the end marker. The
+ * profile of each thread is copied with interrupts disabled, but the profiles
+ * of different threads may be taken at slightly different times.
+ *
+ * @param[in]   write   function to output the stream
+ * @param[in]   arg     argument to pass to @p write
+ *
+ * @return  number of bytes written
+ */
+size_t sched_profiler_export(sched_profiler_write_t write, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
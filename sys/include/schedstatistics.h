@@ -30,6 +30,8 @@
 
 #include <stdint.h>
 
+#include "sched.h"
+
 #ifdef __cplusplus
  extern "C" {
 #endif
@@ -55,6 +57,17 @@ extern schedstat_t sched_pidlist[KERNEL_PID_LAST + 1];
  */
 void init_schedstatistics(void);
 
+/**
+ *  @brief  The sched statistics callback
+ *
+ *  Other users of @ref sched_register_cb can call this from their own
+ *  callback to keep the statistics updated.
+ *
+ *  @param[in]  active_thread   Pid of the thread leaving the CPU
+ *  @param[in]  next_thread     Pid of the thread being scheduled
+ */
+void sched_statistics_cb(kernel_pid_t active_thread, kernel_pid_t next_thread);
+
 #ifdef __cplusplus
 }
 #endif
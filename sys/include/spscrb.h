@@ -0,0 +1,361 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup    sys_spscrb Lock-free single-producer/single-consumer ringbuffer
+ * @ingroup     sys
+ * @brief       Lock-free ringbuffers for bytes and fixed-size objects
+ *
+ * Unlike @ref sys_tsrb, these ringbuffers never disable interrupts while
+ * copying data. The producer only ever writes spscrb_t::writes, the consumer
+ * only ever writes spscrb_t::reads, so one producer and one consumer (e.g. an
+ * ISR and a thread) can use a ringbuffer concurrently without a lock.
+ * Multiple producers or multiple consumers need to synchronize on their own.
+ *
+ * Both sides can access the ringbuffer memory directly: spscrb_reserve()
+ * returns the contiguous free space at the write position, which is made
+ * visible to the consumer by spscrb_commit(). spscrb_peek() returns the
+ * contiguous data at the read position, which is freed by spscrb_release().
+ * spscrb_write() and spscrb_read() build on that and copy data with at most
+ * two calls to `memcpy()`.
+ *
+ * The object variant @ref spscrb_obj_t works the same, but counts in
+ * objects of a fixed size instead of bytes.
+ *
+ * To switch @ref sys_tsrb, and with it @ref isr_pipe, to these ringbuffers, use
+ * the module `tsrb_spscrb`. Only do so if every tsrb of the application has a
+ * single producer and a single consumer.
+ *
+ * @{
+ *
+ * @attention   The number of bytes or objects a ringbuffer holds must be a
+ *              power of two.
+ *
+ * @file
+ * @brief       Lock-free single-producer/single-consumer ringbuffer interface
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "atomic_utils.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Lock-free byte ringbuffer
+ */
+typedef struct {
+    uint8_t *buf;               /**< Buffer to operate on */
+    unsigned size;              /**< Size of buffer, must be power of 2 */
+    unsigned reads;             /**< total number of reads, consumer only */
+    unsigned writes;            /**< total number of writes, producer only */
+} spscrb_t;
+
+/**
+ * @brief   Lock-free ringbuffer of fixed-size objects
+ */
+typedef struct {
+    void *buf;                  /**< Buffer to operate on */
+    unsigned size;              /**< Number of objects, must be power of 2 */
+    unsigned reads;             /**< total number of reads, consumer only */
+    unsigned writes;            /**< total number of writes, producer only */
+    size_t obj_size;            /**< Size of an object in bytes */
+} spscrb_obj_t;
+
+/**
+ * @brief   Static initializer of a byte ringbuffer
+ *
+ * @note The size of the buffer (`sizeof(@p BUF)`) must be a power of two.
+ *
+ * @param[in] BUF       Buffer to use
+ */
+#define SPSCRB_INIT(BUF) { (BUF), sizeof(BUF), 0, 0 }
+
+/**
+ * @brief   Static initializer of an object ringbuffer
+ *
+ * @note The number of elements of @p ARRAY must be a power of two.
+ *
+ * @param[in] ARRAY     Array of objects to use
+ */
+#define SPSCRB_OBJ_INIT(ARRAY) \
+    { (ARRAY), sizeof(ARRAY) / sizeof((ARRAY)[0]), 0, 0, sizeof((ARRAY)[0]) }
+
+/**
+ * @brief   Initialize a byte ringbuffer
+ *
+ * @note The size of the buffer (@p bufsize) must be a power of two.
+ *
+ * @param[out]  rb          Datum to initialize
+ * @param[in]   buffer      Buffer to use
+ * @param[in]   bufsize     Size of @p buffer
+ */
+static inline void spscrb_init(spscrb_t *rb, uint8_t *buffer, unsigned bufsize)
+{
+    assert((bufsize != 0) && ((bufsize & (bufsize - 1)) == 0));
+
+    rb->buf = buffer;
+    rb->size = bufsize;
+    rb->reads = 0;
+    rb->writes = 0;
+}
+
+/**
+ * @brief   Get number of bytes available for reading
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return  number of available bytes
+ */
+static inline unsigned spscrb_avail(const spscrb_t *rb)
+{
+    return atomic_load_unsigned(&rb->writes) - atomic_load_unsigned(&rb->reads);
+}
+
+/**
+ * @brief   Get free space in ringbuffer
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return  number of bytes that can be written
+ */
+static inline unsigned spscrb_free(const spscrb_t *rb)
+{
+    return rb->size - spscrb_avail(rb);
+}
+
+/**
+ * @brief   Test if the ringbuffer is empty
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return  true, if no bytes are available for reading
+ */
+static inline bool spscrb_empty(const spscrb_t *rb)
+{
+    return spscrb_avail(rb) == 0;
+}
+
+/**
+ * @brief   Test if the ringbuffer is full
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return  true, if no bytes can be written
+ */
+static inline bool spscrb_full(const spscrb_t *rb)
+{
+    return spscrb_avail(rb) == rb->size;
+}
+
+/**
+ * @brief   Get the contiguous free space at the write position (producer)
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    Start of the free space
+ *
+ * @return  number of bytes that can be written to @p data. If this is less
+ *          than spscrb_free(), more free space is available at the start of
+ *          the buffer after committing.
+ */
+unsigned spscrb_reserve(spscrb_t *rb, uint8_t **data);
+
+/**
+ * @brief   Make bytes written to reserved space available (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   number of bytes written, at most the return value of the
+ *                  preceding call to spscrb_reserve()
+ */
+static inline void spscrb_commit(spscrb_t *rb, unsigned n)
+{
+    assert(n <= spscrb_free(rb));
+    atomic_store_unsigned(&rb->writes, rb->writes + n);
+}
+
+/**
+ * @brief   Get the contiguous data at the read position (consumer)
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  data    Start of the data
+ *
+ * @return  number of bytes that can be read from @p data. If this is less
+ *          than spscrb_avail(), more data is available at the start of the
+ *          buffer after releasing.
+ */
+unsigned spscrb_peek(spscrb_t *rb, const uint8_t **data);
+
+/**
+ * @brief   Free bytes that have been read (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   number of bytes to free, at most spscrb_avail()
+ */
+static inline void spscrb_release(spscrb_t *rb, unsigned n)
+{
+    assert(n <= spscrb_avail(rb));
+    atomic_store_unsigned(&rb->reads, rb->reads + n);
+}
+
+/**
+ * @brief   Add bytes to ringbuffer (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   src buffer to read from
+ * @param[in]   n   max number of bytes to read from @p src
+ *
+ * @return  number of bytes read from @p src
+ */
+size_t spscrb_write(spscrb_t *rb, const uint8_t *src, size_t n);
+
+/**
+ * @brief   Get bytes from ringbuffer (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst buffer to write to, may be NULL to only drop the bytes
+ * @param[in]   n   max number of bytes to write to @p dst
+ *
+ * @return  number of bytes written to @p dst
+ */
+size_t spscrb_read(spscrb_t *rb, uint8_t *dst, size_t n);
+
+/**
+ * @brief   Get bytes from ringbuffer, without removing them (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst buffer to write to
+ * @param[in]   n   max number of bytes to write to @p dst
+ *
+ * @return  number of bytes written to @p dst
+ */
+size_t spscrb_copy(const spscrb_t *rb, uint8_t *dst, size_t n);
+
+/**
+ * @brief   Initialize an object ringbuffer
+ *
+ * @note The number of objects (@p num) must be a power of two.
+ *
+ * @param[out]  rb          Datum to initialize
+ * @param[in]   buffer      Buffer for @p num objects
+ * @param[in]   obj_size    Size of an object in bytes
+ * @param[in]   num         Number of objects @p buffer can hold
+ */
+static inline void spscrb_obj_init(spscrb_obj_t *rb, void *buffer,
+                                   size_t obj_size, unsigned num)
+{
+    assert((num != 0) && ((num & (num - 1)) == 0));
+
+    rb->buf = buffer;
+    rb->size = num;
+    rb->reads = 0;
+    rb->writes = 0;
+    rb->obj_size = obj_size;
+}
+
+/**
+ * @brief   Get number of objects available for reading
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return  number of available objects
+ */
+static inline unsigned spscrb_obj_avail(const spscrb_obj_t *rb)
+{
+    return atomic_load_unsigned(&rb->writes) - atomic_load_unsigned(&rb->reads);
+}
+
+/**
+ * @brief   Get number of objects that can be written
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ *
+ * @return  number of free slots
+ */
+static inline unsigned spscrb_obj_free(const spscrb_obj_t *rb)
+{
+    return rb->size - spscrb_obj_avail(rb);
+}
+
+/**
+ * @brief   Get the contiguous free slots at the write position (producer)
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  slots   First free slot
+ *
+ * @return  number of objects that can be written to @p slots
+ */
+unsigned spscrb_obj_reserve(spscrb_obj_t *rb, void **slots);
+
+/**
+ * @brief   Make objects written to reserved slots available (producer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   number of objects written
+ */
+static inline void spscrb_obj_commit(spscrb_obj_t *rb, unsigned n)
+{
+    assert(n <= spscrb_obj_free(rb));
+    atomic_store_unsigned(&rb->writes, rb->writes + n);
+}
+
+/**
+ * @brief   Get the contiguous objects at the read position (consumer)
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  objs    First object
+ *
+ * @return  number of objects that can be read from @p objs
+ */
+unsigned spscrb_obj_peek(spscrb_obj_t *rb, void **objs);
+
+/**
+ * @brief   Free objects that have been read (consumer)
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   number of objects to free
+ */
+static inline void spscrb_obj_release(spscrb_obj_t *rb, unsigned n)
+{
+    assert(n <= spscrb_obj_avail(rb));
+    atomic_store_unsigned(&rb->reads, rb->reads + n);
+}
+
+/**
+ * @brief   Add objects to ringbuffer (producer)
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[in]   objs    objects to add
+ * @param[in]   n       max number of objects to add
+ *
+ * @return  number of objects added
+ */
+unsigned spscrb_obj_write(spscrb_obj_t *rb, const void *objs, unsigned n);
+
+/**
+ * @brief   Get objects from ringbuffer (consumer)
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  objs    buffer for at least @p n objects
+ * @param[in]   n       max number of objects to get
+ *
+ * @return  number of objects written to @p objs
+ */
+unsigned spscrb_obj_read(spscrb_obj_t *rb, void *objs, unsigned n);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -11,6 +11,7 @@
 #pragma once
 
 /**
+ * @defgroup    sys_trace Trace
  * @ingroup     sys
  * @brief       Trace program flows
  *
@@ -21,18 +22,58 @@
  * Calling the function is safe from anywhere (user code, ISR, ...) and safely
  * logs the function call time and user value in a trace buffer.
  *
- * At any point, `trace_dump()` can be used to print the trace buffer.
+ * `trace_event()` records typed events (see @ref trace_event_id_t) with two
+ * arguments the same way. With the module `tracepoints`, the static
+ * tracepoints of the kernel, GNRC netapi and ztimer record their events as
+ * well (see @ref core_util_tracepoint).
  *
- * The buffer has a default size of 512 entries, which can be overridden by
+ * Every event is stored with its type, the time in µs (ZTIMER_USEC), the pid
+ * of the thread it was recorded in (or @ref TRACE_CTX_ISR) and its arguments.
+ *
+ * At any point, `trace_dump()` can be used to print the trace buffer, and
+ * `trace_read()` to take events out of it.
+ *
+ * The buffer has a default size of 256 entries, which can be overridden by
  * defining CONFIG_TRACE_BUFSIZE. It can be cleared using `trace_reset()`.
  * The trace buffer works like a ring-buffer. If it is full, it will start
  * overwriting from the beginning.
  *
- * Tracing is made thread safe by disabling interrupts for critical sections.
+ * Tracing is made thread safe by disabling interrupts for the few
+ * instructions it takes to store an event.
  *
  * It does incur some overhead (at least a function call, getting the current
  * time, a pair of enable/disable interrupts and a couple of memory accesses).
  *
+ * Streaming
+ * ---------
+ *
+ * With the module `trace_stream`, a low priority thread continuously takes
+ * the events out of the trace buffer and writes them as binary stream to
+ * stdio. With `trace_stream_vfs`, the stream goes to the file
+ * @ref CONFIG_TRACE_STREAM_VFS_PATH instead, e.g. to a host directory on the
+ * `native` board. The thread is the only consumer of the trace buffer, so it
+ * takes the events out without disabling interrupts. If the buffer is full,
+ * new events are dropped and a @ref TRACE_EVENT_DROPPED event in the stream
+ * tells how many. Events recorded by the stream thread itself are ignored.
+ *
+ * The stream is a [CTF](https://diamon.org/ctf/v1.8.3/) 1.8 data stream. It
+ * starts with the 32 bit magic number `0xc1fc1fc1`, followed by records of
+ * @ref TRACE_STREAM_RECORD_SIZE bytes, all little endian:
+ *
+ * | offset | size | field                                      |
+ * |:------:|:----:|:------------------------------------------ |
+ * |      0 |    4 | time in µs                                 |
+ * |      4 |    2 | event type (@ref trace_event_id_t)         |
+ * |      6 |    2 | pid or @ref TRACE_CTX_ISR                  |
+ * |      8 |    4 | arg0                                       |
+ * |     12 |    4 | arg1                                       |
+ *
+ * Copying `dist/tools/trace/metadata` next to a recorded stream file makes
+ * that directory a CTF trace for tools like babeltrace2 or Trace Compass.
+ * `dist/tools/trace/trace2perfetto.py` converts a stream to the JSON trace
+ * event format loadable by Perfetto UI, with a track per thread showing when
+ * it was running.
+ *
  * Example:
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
@@ -52,12 +93,83 @@
  *
  */
 
+#include <stddef.h>
 #include <stdint.h>
 
+#include "tracepoint.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @defgroup    sys_trace_config Trace compile time configuration
+ * @ingroup     config
+ * @{
+ */
+/**
+ * @brief   Number of events the trace buffer holds, must be a power of 2
+ */
+#ifndef CONFIG_TRACE_BUFSIZE
+#define CONFIG_TRACE_BUFSIZE                (256U)
+#endif
+
+/**
+ * @brief   Interval in ms in which the stream thread checks for new events
+ */
+#ifndef CONFIG_TRACE_STREAM_INTERVAL_MS
+#define CONFIG_TRACE_STREAM_INTERVAL_MS     (10U)
+#endif
+
+/**
+ * @brief   Stack size of the stream thread
+ */
+#ifndef CONFIG_TRACE_STREAM_STACKSIZE
+#define CONFIG_TRACE_STREAM_STACKSIZE       (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   File the stream is written to with `trace_stream_vfs`
+ */
+#ifndef CONFIG_TRACE_STREAM_VFS_PATH
+#define CONFIG_TRACE_STREAM_VFS_PATH        "/nvm0/trace.ctf"
+#endif
+/** @} */
+
+/**
+ * @brief   Context of an event recorded in interrupt context
+ */
+#define TRACE_CTX_ISR                       (0x8000U)
+
+/**
+ * @brief   Magic number at the start of a trace stream
+ */
+#define TRACE_STREAM_MAGIC                  (0xc1fc1fc1UL)
+
+/**
+ * @brief   Size of an event in a trace stream
+ */
+#define TRACE_STREAM_RECORD_SIZE            (16U)
+
+/**
+ * @brief   Recorded event
+ */
+typedef struct {
+    uint32_t time;      /**< time the event was recorded in µs */
+    uint16_t id;        /**< event type, see @ref trace_event_id_t */
+    uint16_t ctx;       /**< pid of the recording thread or
+                             @ref TRACE_CTX_ISR */
+    uint32_t arg0;      /**< first argument */
+    uint32_t arg1;      /**< second argument */
+} trace_event_t;
+
+/**
+ * @brief   Starts recording events, and the stream thread with `trace_stream`
+ *
+ * Called by auto_init. Events recorded before are ignored.
+ */
+void trace_init(void);
+
 /**
  * @brief   Add entry to trace buffer
  *
@@ -70,14 +182,18 @@ extern "C" {
  *
  * @param[in]   val     user defined value
  */
-void trace(uint32_t val);
+static inline void trace(uint32_t val)
+{
+    trace_event(TRACE_EVENT_USER, val, 0);
+}
 
 /**
  * @brief   Print the current trace buffer
  *
  * Will print the number of the trace log entry, the timestamp (first entry) or
  * relative time since last entry, and the value supplied to the `trace()` call
- * of each entry.
+ * of each entry. Other events are printed with their name, their arguments
+ * and the context they were recorded in.
  *
  * Example output (after adding two traces, 3us apart, with values 0 and 1):
  *
@@ -88,9 +204,44 @@ void trace_dump(void);
 
 /**
  * @brief   Empty the trace buffer
+ *
+ * Has no effect with `trace_stream`, which empties the buffer continuously.
  */
 void trace_reset(void);
 
+/**
+ * @brief   Take the oldest events out of the trace buffer
+ *
+ * If events were dropped since the last call, the first event returned is a
+ * @ref TRACE_EVENT_DROPPED event.
+ *
+ * @note    With `trace_stream`, the stream thread is the only one allowed to
+ *          call this.
+ *
+ * @param[out]  events  buffer for at least @p num events
+ * @param[in]   num     maximum number of events to take
+ *
+ * @return  number of events written to @p events
+ */
+size_t trace_read(trace_event_t *events, size_t num);
+
+/**
+ * @brief   Serialize an event for a trace stream
+ *
+ * @param[out]  buf     buffer of @ref TRACE_STREAM_RECORD_SIZE bytes
+ * @param[in]   event   event to serialize
+ */
+void trace_stream_record(uint8_t *buf, const trace_event_t *event);
+
+/**
+ * @brief   Get the name of an event type
+ *
+ * @param[in]   id      event type
+ *
+ * @return  name of @p id, or "app" for types of the application
+ */
+const char *trace_event_name(uint16_t id);
+
 #ifdef __cplusplus
 }
 #endif
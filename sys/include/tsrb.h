@@ -16,6 +16,12 @@
  *
  * @attention   Buffer size must be a power of two!
  *
+ * With the module `tsrb_spscrb`, the tsrb functions are implemented on top of
+ * the lock-free @ref sys_spscrb and copy data with `memcpy()` instead of one
+ * byte at a time with interrupts disabled. In that case, every tsrb must only
+ * have a single producer and a single consumer, and tsrb_clear() must only be
+ * called by the consumer.
+ *
  * @file
  * @brief       Thread-safe ringbuffer interface definition
  *
@@ -27,11 +33,17 @@
 #include <stdint.h>
 
 #include "irq.h"
+#if MODULE_TSRB_SPSCRB
+#include "spscrb.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#if MODULE_TSRB_SPSCRB && !DOXYGEN
+typedef spscrb_t tsrb_t;
+#else
 /**
  * @brief     thread-safe ringbuffer struct
  */
@@ -41,6 +53,7 @@ typedef struct tsrb {
     unsigned reads;             /**< total number of reads */
     unsigned writes;            /**< total number of writes */
 } tsrb_t;
+#endif
 
 /**
  * @brief Static initializer
@@ -79,9 +92,13 @@ static inline void tsrb_init(tsrb_t *rb, uint8_t *buffer, unsigned bufsize)
  */
 static inline void tsrb_clear(tsrb_t *rb)
 {
+#if MODULE_TSRB_SPSCRB
+    spscrb_release(rb, spscrb_avail(rb));
+#else
     unsigned irq_state = irq_disable();
     rb->reads = rb->writes;
     irq_restore(irq_state);
+#endif
 }
 
 /**
@@ -92,10 +109,14 @@ static inline void tsrb_clear(tsrb_t *rb)
  */
 static inline int tsrb_empty(const tsrb_t *rb)
 {
+#if MODULE_TSRB_SPSCRB
+    return spscrb_empty(rb);
+#else
     unsigned irq_state = irq_disable();
     int retval = (rb->reads == rb->writes);
     irq_restore(irq_state);
     return retval;
+#endif
 }
 
 /**
@@ -105,10 +126,14 @@ static inline int tsrb_empty(const tsrb_t *rb)
  */
 static inline unsigned int tsrb_avail(const tsrb_t *rb)
 {
+#if MODULE_TSRB_SPSCRB
+    return spscrb_avail(rb);
+#else
     unsigned irq_state = irq_disable();
     int retval = (rb->writes - rb->reads);
     irq_restore(irq_state);
     return retval;
+#endif
 }
 
 /**
@@ -119,10 +144,14 @@ static inline unsigned int tsrb_avail(const tsrb_t *rb)
  */
 static inline int tsrb_full(const tsrb_t *rb)
 {
+#if MODULE_TSRB_SPSCRB
+    return spscrb_full(rb);
+#else
     unsigned irq_state = irq_disable();
     int retval = (rb->writes - rb->reads) == rb->size;
     irq_restore(irq_state);
     return retval;
+#endif
 }
 
 /**
@@ -132,10 +161,14 @@ static inline int tsrb_full(const tsrb_t *rb)
  */
 static inline unsigned int tsrb_free(const tsrb_t *rb)
 {
+#if MODULE_TSRB_SPSCRB
+    return spscrb_free(rb);
+#else
     unsigned irq_state = irq_disable();
     int retval = (rb->size - rb->writes + rb->reads);
     irq_restore(irq_state);
     return retval;
+#endif
 }
 
 /**
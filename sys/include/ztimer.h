@@ -289,6 +289,11 @@ typedef struct ztimer_base ztimer_base_t;
  */
 typedef struct ztimer_clock ztimer_clock_t;
 
+/**
+ * @brief ztimer_wheel_t forward declaration, see @ref sys_ztimer_wheel
+ */
+typedef struct ztimer_wheel ztimer_wheel_t;
+
 /**
  * @brief Type of callbacks in @ref ztimer_t "timers"
  */
@@ -300,6 +305,10 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_base_t **pprev;      /**< link to this timer in a timer wheel slot,
+                                     NULL if not in a timer wheel */
+#endif
 };
 
 /**
@@ -390,6 +399,10 @@ struct ztimer_clock {
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
 #endif
+#if MODULE_ZTIMER_WHEEL || DOXYGEN
+    ztimer_wheel_t *wheel;          /**< timer wheel for far away timers,
+                                         see @ref sys_ztimer_wheel          */
+#endif
 };
 
 /**
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+#pragma once
+
+/**
+ * @defgroup  sys_ztimer_wheel ztimer hierarchical timer wheel
+ * @ingroup   sys_ztimer
+ * @brief     O(1) timer storage for clocks with many pending timers
+ *
+ * By default, every ztimer clock keeps its timers in a sorted list, so
+ * ztimer_set() and ztimer_remove() take O(n) with interrupts disabled.
+ * A clock that got a timer wheel attached via ztimer_wheel_init() keeps only
+ * the timers due within the current wheel slot in that list. All later timers
+ * go into a hierarchical timer wheel of @ref CONFIG_ZTIMER_WHEEL_LEVELS
+ * levels with @ref ZTIMER_WHEEL_SLOTS slots each, where they are inserted and
+ * removed in O(1). The slots of level 0 span `2^shift` ticks, the slots of
+ * each further level @ref ZTIMER_WHEEL_SLOTS times the span of the previous
+ * one. When the clock reaches a slot, its timers are moved down one level
+ * (or into the list), so every timer is touched at most once per level.
+ *
+ * Timers further away than the span of the whole wheel are parked in its last
+ * slot and re-inserted whenever that slot is reached.
+ *
+ * To attach a timer wheel to ZTIMER_USEC, ZTIMER_MSEC or ZTIMER_SEC, add
+ * `ztimer_wheel_usec`, `ztimer_wheel_msec` or `ztimer_wheel_sec` to
+ * `USEMODULE`. Other clocks can use ztimer_wheel_init() directly when the
+ * `ztimer_wheel` module is used.
+ *
+ * The wheel pays off with more than a few dozen timers pending on a clock. Its
+ * cost are `CONFIG_ZTIMER_WHEEL_LEVELS * ZTIMER_WHEEL_SLOTS` pointers of RAM
+ * per clock, an additional pointer per @ref ztimer_t, and an interrupt each
+ * time a slot holding timers is reached.
+ *
+ * @{
+ * @file
+ * @brief   ztimer_wheel interface definitions
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ztimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup    sys_ztimer_wheel_config  ztimer_wheel compile time configuration
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ */
+/**
+ * @brief   Number of levels of a timer wheel
+ *
+ * `CONFIG_ZTIMER_WHEEL_LEVELS * 4 + shift` must not exceed 32.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_LEVELS
+#define CONFIG_ZTIMER_WHEEL_LEVELS      (5U)
+#endif
+
+/**
+ * @brief   Span of a level 0 slot of the ZTIMER_USEC timer wheel as power of 2
+ *
+ * The default of 128 µs slots makes the wheel span ~134 s.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_USEC_SHIFT
+#define CONFIG_ZTIMER_WHEEL_USEC_SHIFT  (7U)
+#endif
+
+/**
+ * @brief   Span of a level 0 slot of the ZTIMER_MSEC timer wheel as power of 2
+ *
+ * The default of 8 ms slots makes the wheel span ~2.3 h.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_MSEC_SHIFT
+#define CONFIG_ZTIMER_WHEEL_MSEC_SHIFT  (3U)
+#endif
+
+/**
+ * @brief   Span of a level 0 slot of the ZTIMER_SEC timer wheel as power of 2
+ *
+ * The default of 1 s slots makes the wheel span ~12 days.
+ */
+#ifndef CONFIG_ZTIMER_WHEEL_SEC_SHIFT
+#define CONFIG_ZTIMER_WHEEL_SEC_SHIFT   (0U)
+#endif
+/** @} */
+
+/**
+ * @brief   Number of slots per level as power of 2
+ */
+#define ZTIMER_WHEEL_SLOT_BITS          (4U)
+
+/**
+ * @brief   Number of slots per level
+ */
+#define ZTIMER_WHEEL_SLOTS              (1U << ZTIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @brief   Timer wheel
+ *
+ * All timers of the attached clock due at or after
+ * ztimer_wheel_t::horizon are kept in here, all earlier ones in the list of
+ * the clock.
+ */
+struct ztimer_wheel {
+    /**
+     * @brief   Slots of the levels, each a list of timers linked by
+     *          ztimer_base_t::next
+     */
+    ztimer_base_t *slots[CONFIG_ZTIMER_WHEEL_LEVELS][ZTIMER_WHEEL_SLOTS];
+    uint16_t occupied[CONFIG_ZTIMER_WHEEL_LEVELS];  /**< bitmap of non-empty slots */
+    uint32_t horizon;       /**< start of the current level 0 slot */
+    uint32_t pos;           /**< number of the current level 0 slot */
+    uint32_t next;          /**< when the next non-empty slot is reached */
+    uint8_t shift;          /**< span of a level 0 slot as power of 2 */
+};
+
+/**
+ * @brief   Attaches a timer wheel to a clock
+ *
+ * Must be called before any timer is set on @p clock.
+ *
+ * @param[in]   clock   clock to attach @p wheel to
+ * @param[out]  wheel   timer wheel to initialize
+ * @param[in]   shift   span of a level 0 slot in ticks of @p clock as
+ *                      power of 2
+ */
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel,
+                       unsigned shift);
+
+/**
+ * @brief   Checks if a timer wheel holds no timers
+ *
+ * @param[in]   wheel   timer wheel
+ *
+ * @return  true, if @p wheel is empty
+ */
+static inline bool ztimer_wheel_is_empty(const ztimer_wheel_t *wheel)
+{
+    for (unsigned i = 0; i < CONFIG_ZTIMER_WHEEL_LEVELS; i++) {
+        if (wheel->occupied[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief   Adds a timer to a timer wheel (internal)
+ *
+ * @param[in]   wheel   timer wheel
+ * @param[in]   entry   timer to add, ztimer_base_t::offset relative to @p now
+ * @param[in]   now     current time of the clock
+ *
+ * @return  true, if @p entry was added to @p wheel
+ * @return  false, if @p entry is due before the horizon of @p wheel and needs
+ *          to go into the list of the clock. @p entry is unchanged.
+ */
+bool ztimer_wheel_add(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                      uint32_t now);
+
+/**
+ * @brief   Removes a timer from a timer wheel (internal)
+ *
+ * @param[in]   wheel   timer wheel
+ * @param[in]   entry   timer to remove, must be in @p wheel
+ */
+void ztimer_wheel_del(ztimer_wheel_t *wheel, ztimer_base_t *entry);
+
+/**
+ * @brief   Takes all timers out of a timer wheel that have become due for the
+ *          list of the clock (internal)
+ *
+ * @param[in]   wheel   timer wheel
+ * @param[in]   now     current time of the clock
+ *
+ * @return  The taken timers linked by ztimer_base_t::next, with
+ *          ztimer_base_t::offset set to their absolute target time
+ */
+ztimer_base_t *ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
@@ -19,6 +19,7 @@
 
 #include "event.h"
 #include "kernel_defines.h"
+#include "mutex.h"
 #include "net/gcoap.h"
 #include "net/gcoap/forward_proxy.h"
 #include "uri_parser.h"
@@ -41,8 +42,9 @@ extern kernel_pid_t forward_proxy_pid;
 extern uint16_t gcoap_next_msg_id(void);
 extern void gcoap_forward_proxy_post_event(void *arg);
 
-static uint8_t proxy_req_buf[CONFIG_GCOAP_PDU_BUF_SIZE];
-static client_ep_t _client_eps[CONFIG_GCOAP_REQ_WAITING_MAX];
+static client_ep_t _client_eps[CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX];
+/* requests may be handled by several gcoap workers concurrently */
+static mutex_t _client_eps_lock = MUTEX_INIT;
 
 static int _request_matcher_forward_proxy(gcoap_listener_t *listener,
                                           const coap_resource_t **resource,
@@ -69,12 +71,10 @@ const coap_resource_t forward_proxy_resources[] = {
 };
 
 gcoap_listener_t forward_proxy_listener = {
-    &forward_proxy_resources[0],
-    ARRAY_SIZE(forward_proxy_resources),
-    GCOAP_SOCKET_TYPE_UDP,
-    NULL,
-    NULL,
-    _request_matcher_forward_proxy
+    .resources = &forward_proxy_resources[0],
+    .resources_len = ARRAY_SIZE(forward_proxy_resources),
+    .tl_type = GCOAP_SOCKET_TYPE_UDP,
+    .request_matcher = _request_matcher_forward_proxy,
 };
 
 static void _cep_set_timeout(client_ep_t *cep, ztimer_t *timer, uint32_t timeout_ms,
@@ -98,17 +98,20 @@ void gcoap_forward_proxy_init(void)
 static client_ep_t *_allocate_client_ep(const sock_udp_ep_t *ep)
 {
     client_ep_t *cep;
+    mutex_lock(&_client_eps_lock);
     for (cep = _client_eps;
-         cep < (_client_eps + CONFIG_GCOAP_REQ_WAITING_MAX);
+         cep < (_client_eps + ARRAY_SIZE(_client_eps));
          cep++) {
         if (!_cep_in_use(cep)) {
             _cep_set_in_use(cep);
+            mutex_unlock(&_client_eps_lock);
             _cep_set_req_etag(cep, NULL, 0);
             memcpy(&cep->ep, ep, sizeof(*ep));
             DEBUG("Client_ep is allocated %p\n", (void *)cep);
             return cep;
         }
     }
+    mutex_unlock(&_client_eps_lock);
     return NULL;
 }
 
@@ -455,7 +458,7 @@ static int _gcoap_forward_proxy_via_coap(coap_pkt_t *client_pkt,
 
     unsigned token_len = coap_get_token_len(client_pkt);
 
-    coap_pkt_init(&client_ep->pdu, proxy_req_buf, CONFIG_GCOAP_PDU_BUF_SIZE,
+    coap_pkt_init(&client_ep->pdu, client_ep->buf, sizeof(client_ep->buf),
                   sizeof(coap_hdr_t) + token_len);
 
     client_ep->pdu.hdr->ver_t_tkl = client_pkt->hdr->ver_t_tkl;
@@ -496,10 +499,10 @@ int gcoap_forward_proxy_request_process(coap_pkt_t *pkt,
     ssize_t optlen = 0;
 
     client_ep_t *cep = _allocate_client_ep(client);
-    cep->proxy_ep = local ? *local : (sock_udp_ep_t){ 0 };
     if (!cep) {
         return -ENOMEM;
     }
+    cep->proxy_ep = local ? *local : (sock_udp_ep_t){ 0 };
 
     cep->mid = pkt->hdr->id;
     _cep_set_response_type(
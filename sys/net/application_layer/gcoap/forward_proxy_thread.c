@@ -16,6 +16,8 @@
  * @}
  */
 
+#include <assert.h>
+
 #include "msg.h"
 #include "net/gcoap.h"
 #include "net/gcoap/forward_proxy.h"
@@ -26,6 +28,11 @@
 #define ENABLE_DEBUG    0
 #include "debug.h"
 
+/* the queue holds a message for each client endpoint */
+static_assert(!(CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX &
+                (CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX - 1)),
+              "CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX must be a power of 2");
+
 static char _forward_proxy_thread[GCOAP_PROXY_STACK_SIZE];
 kernel_pid_t forward_proxy_pid = KERNEL_PID_UNDEF;
 
@@ -33,7 +40,7 @@ static void *_forward_proxy_thread_start(void *arg)
 {
     (void)arg;
 
-    msg_t _forward_proxy_msg_queue[CONFIG_GCOAP_REQ_WAITING_MAX];
+    msg_t _forward_proxy_msg_queue[CONFIG_GCOAP_FORWARD_PROXY_CLIENTS_MAX];
     msg_init_queue(_forward_proxy_msg_queue, ARRAY_SIZE(_forward_proxy_msg_queue));
 
     msg_t msg;
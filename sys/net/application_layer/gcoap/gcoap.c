@@ -38,6 +38,7 @@
 #include "mutex.h"
 #include "random.h"
 #include "thread.h"
+#include "utlist.h"
 #include "ztimer.h"
 
 #if IS_USED(MODULE_GCOAP_DTLS)
@@ -46,6 +47,10 @@
 #include "net/dsm.h"
 #endif
 
+#if IS_USED(MODULE_GCOAP_WORKERS)
+#include "workers_internal.h"
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -103,6 +108,12 @@ static int _request_matcher_default(gcoap_listener_t *listener,
                                     const coap_resource_t **resource,
                                     coap_pkt_t *pdu);
 
+#if IS_USED(MODULE_GCOAP_WORKERS)
+static bool _dispatch_req(gcoap_socket_t *sock, coap_pkt_t *pdu, size_t len,
+                          sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                          ssize_t *pdu_len);
+#endif
+
 #if IS_USED(MODULE_GCOAP_DTLS)
 static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *arg);
 static void _dtls_free_up_session(void *arg);
@@ -116,22 +127,30 @@ const coap_resource_t _default_resources[] = {
 };
 
 static gcoap_listener_t _default_listener = {
-    &_default_resources[0],
-    ARRAY_SIZE(_default_resources),
-    GCOAP_SOCKET_TYPE_UNDEF,
-    NULL,
-    NULL,
-    _request_matcher_default
+    .resources = &_default_resources[0],
+    .resources_len = ARRAY_SIZE(_default_resources),
+    .request_matcher = _request_matcher_default,
 };
 
+static_assert((CONFIG_GCOAP_MEMO_HASH_BUCKETS &
+               (CONFIG_GCOAP_MEMO_HASH_BUCKETS - 1)) == 0,
+              "CONFIG_GCOAP_MEMO_HASH_BUCKETS must be a power of 2");
+
+/* Built-in pool of request memos */
+static gcoap_request_memo_t _open_reqs[CONFIG_GCOAP_REQ_WAITING_MAX];
+
 /* Container for the state of gcoap itself */
 typedef struct {
     mutex_t lock;                       /* Shares state attributes safely */
     gcoap_listener_t *listeners;        /* List of registered listeners */
-    gcoap_request_memo_t open_reqs[CONFIG_GCOAP_REQ_WAITING_MAX];
-                                        /* Storage for open requests; if first
+    gcoap_request_memo_t *open_reqs;    /* Storage for open requests; if first
                                            byte of an entry is zero, the entry
                                            is available */
+    size_t open_reqs_numof;             /* Number of entries in open_reqs */
+    gcoap_request_memo_t *reqs_by_token[CONFIG_GCOAP_MEMO_HASH_BUCKETS];
+                                        /* Open requests hashed by token */
+    gcoap_request_memo_t *reqs_by_mid[CONFIG_GCOAP_MEMO_HASH_BUCKETS];
+                                        /* Open requests hashed by message ID */
     atomic_uint next_message_id;        /* Next message ID to use */
     sock_udp_ep_t observers[CONFIG_GCOAP_OBS_CLIENTS_MAX];
                                         /* Observe clients; allows reuse for
@@ -142,6 +161,8 @@ typedef struct {
     sock_udp_ep_t notifiers[CONFIG_GCOAP_OBS_NOTIFIERS_MAX];
     gcoap_observe_memo_t observe_memos[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
                                         /* Observed resource registrations */
+    gcoap_observe_memo_t *obs_by_resource[CONFIG_GCOAP_MEMO_HASH_BUCKETS];
+                                        /* Registrations hashed by resource */
     uint8_t resend_bufs[CONFIG_GCOAP_RESEND_BUFS_MAX][CONFIG_GCOAP_PDU_BUF_SIZE];
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
@@ -150,6 +171,8 @@ typedef struct {
 
 static gcoap_state_t _coap_state = {
     .listeners   = &_default_listener,
+    .open_reqs   = _open_reqs,
+    .open_reqs_numof = ARRAY_SIZE(_open_reqs),
 };
 
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
@@ -280,7 +303,7 @@ static void _on_sock_dtls_evt(sock_dtls_t *sock, sock_async_flags_t type, void *
         sock_dtls_session_get_udp_ep(&socket.ctx_dtls_session, &ep);
 
         /* Remove all memos of the concerned session. TODO: oberservable memos! */
-        for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        for (size_t i = 0; i < _coap_state.open_reqs_numof; i++) {
             if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
                 continue;
             }
@@ -322,6 +345,23 @@ static void _dtls_free_up_session(void *arg) {
 }
 #endif /* MODULE_GCOAP_DTLS */
 
+/* Copies received data to _listen_buf at cursor, returns the new cursor and
+ * sets *truncated if it did not fit */
+static size_t _gather(size_t cursor, const iolist_t *snips, bool *truncated)
+{
+    for (; snips; snips = snips->iol_next) {
+        size_t len = snips->iol_len;
+
+        if (cursor + len > sizeof(_listen_buf)) {
+            len = sizeof(_listen_buf) - cursor;
+            *truncated = true;
+        }
+        memcpy(&_listen_buf[cursor], snips->iol_base, len);
+        cursor += len;
+    }
+    return cursor;
+}
+
 /* Handles UDP socket events from the event queue. */
 static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *arg)
 {
@@ -329,24 +369,46 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
     sock_udp_ep_t remote;
 
     if (type & SOCK_ASYNC_MSG_RECV) {
-        void *stackbuf;
-        void *buf_ctx = NULL;
+        uint8_t *buf = _listen_buf;
         bool truncated = false;
-        size_t cursor = 0;
+        size_t len;
         sock_udp_aux_rx_t aux_in = {
             .flags = SOCK_AUX_GET_LOCAL,
         };
 
-        /* The zero-copy _buf API is not used to its full potential here -- we
-         * still copy out data in what is a manual version of sock_udp_recv,
-         * but this gives the direly needed overflow information.
-         *
-         * A version that actually doesn't copy would vastly change the way
-         * gcoap passes the buffer to be read from and written into to the
-         * handler. Also, given that neither nanocoap nor the handler expects
-         * to gather scattered data, it'd need to rely on the data coming in a
-         * single slice (but that may be a realistic assumption).
-         */
+#if IS_USED(MODULE_SOCK_UDP_RECV_VIEW)
+        sock_udp_recv_view_t view;
+        ssize_t res = sock_udp_recv_view_aux(sock, &view, 0, &remote, &aux_in);
+
+        if (res < 0) {
+            DEBUG("gcoap: udp recv failure: %" PRIdSIZE "\n", res);
+            return;
+        }
+        const uint8_t *data = view.snips[0].iol_base;
+
+        /* Requests are parsed right in the buffer of the stack, as the
+         * response is written to _listen_buf anyway. Responses are copied,
+         * the response handling (e.g. of the cache) relies on _listen_buf. */
+        if ((view.snips[0].iol_next == NULL) &&
+            (view.len >= sizeof(coap_hdr_t)) &&
+            ((data[1] >> 5) == COAP_CLASS_REQ)) {
+            buf = view.snips[0].iol_base;
+            len = view.len;
+        }
+        else {
+            len = _gather(0, view.snips, &truncated);
+            sock_udp_recv_view_release(sock, &view);
+        }
+#else
+        void *stackbuf;
+        void *buf_ctx = NULL;
+        iolist_t snip = { 0 };
+
+        len = 0;
+        /* The zero-copy _buf API is not used to its full potential here --
+         * we still copy out data in what is a manual version of
+         * sock_udp_recv, but this gives the direly needed overflow
+         * information. */
         while (true) {
             ssize_t res = sock_udp_recv_buf_aux(sock, &stackbuf, &buf_ctx, 0, &remote, &aux_in);
             if (res < 0) {
@@ -356,13 +418,11 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             if (res == 0) {
                 break;
             }
-            if (cursor + res > sizeof(_listen_buf)) {
-                res = sizeof(_listen_buf) - cursor;
-                truncated = true;
-            }
-            memcpy(&_listen_buf[cursor], stackbuf, res);
-            cursor += res;
+            snip.iol_base = stackbuf;
+            snip.iol_len = res;
+            len = _gather(len, &snip, &truncated);
         }
+#endif
 
         /* make sure we reply with the same address that the request was
          * destined for -- except in the multicast case */
@@ -384,8 +444,94 @@ static void _on_sock_udp_evt(sock_udp_t *sock, sock_async_flags_t type, void *ar
             .socket.udp = sock,
          };
 
-        _process_coap_pdu(&socket, &remote, aux_out_ptr, _listen_buf, cursor, truncated);
+        _process_coap_pdu(&socket, &remote, aux_out_ptr, buf, len, truncated);
+
+#if IS_USED(MODULE_SOCK_UDP_RECV_VIEW)
+        if (buf != _listen_buf) {
+            sock_udp_recv_view_release(sock, &view);
+        }
+#endif
+    }
+}
+
+/*
+ * Hash indexes of the request and observe memos
+ *
+ * Buckets are singly linked lists of the memos with the same hash. They are
+ * modified with _coap_state.lock held only. A memo removed from a bucket keeps
+ * its link, so a concurrent lookup walking the bucket is not derailed.
+ */
+
+static unsigned _hash_token(const uint8_t *token, size_t tkl)
+{
+    unsigned hash = 0;
+
+    for (size_t i = 0; i < tkl; i++) {
+        hash = (hash * 31) + token[i];
     }
+    return (hash ^ (hash >> 8)) & (CONFIG_GCOAP_MEMO_HASH_BUCKETS - 1);
+}
+
+static unsigned _hash_mid(uint16_t mid)
+{
+    return (mid ^ (mid >> 8)) & (CONFIG_GCOAP_MEMO_HASH_BUCKETS - 1);
+}
+
+static unsigned _hash_resource(const coap_resource_t *resource)
+{
+    uintptr_t hash = (uintptr_t)resource / sizeof(*resource);
+
+    return (hash ^ (hash >> 8)) & (CONFIG_GCOAP_MEMO_HASH_BUCKETS - 1);
+}
+
+/* Adds an open request to the indexes, caller must hold the lock */
+static void _memo_index(gcoap_request_memo_t *memo)
+{
+    coap_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+    unsigned token_bucket = _hash_token(coap_hdr_get_token(hdr),
+                                        coap_hdr_get_token_len(hdr));
+
+    LL_PREPEND2(_coap_state.reqs_by_token[token_bucket], memo, next_by_token);
+    LL_PREPEND2(_coap_state.reqs_by_mid[_hash_mid(hdr->id)], memo, next_by_mid);
+}
+
+/* Removes an open request from the indexes, caller must hold the lock */
+static void _memo_unindex(gcoap_request_memo_t *memo)
+{
+    coap_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
+    unsigned token_bucket = _hash_token(coap_hdr_get_token(hdr),
+                                        coap_hdr_get_token_len(hdr));
+
+    LL_DELETE2(_coap_state.reqs_by_token[token_bucket], memo, next_by_token);
+    LL_DELETE2(_coap_state.reqs_by_mid[_hash_mid(hdr->id)], memo, next_by_mid);
+}
+
+/* Frees an indexed request memo */
+static void _memo_free(gcoap_request_memo_t *memo)
+{
+    mutex_lock(&_coap_state.lock);
+    _memo_unindex(memo);
+    /* setting the state to unused frees (drops) the memo entry */
+    memo->state = GCOAP_MEMO_UNUSED;
+    mutex_unlock(&_coap_state.lock);
+}
+
+/* Adds an observe registration to the resource index */
+static void _obs_memo_index(gcoap_observe_memo_t *memo)
+{
+    mutex_lock(&_coap_state.lock);
+    LL_PREPEND2(_coap_state.obs_by_resource[_hash_resource(memo->resource)],
+                memo, next_by_resource);
+    mutex_unlock(&_coap_state.lock);
+}
+
+/* Removes an observe registration from the resource index */
+static void _obs_memo_unindex(gcoap_observe_memo_t *memo)
+{
+    mutex_lock(&_coap_state.lock);
+    LL_DELETE2(_coap_state.obs_by_resource[_hash_resource(memo->resource)],
+               memo, next_by_resource);
+    mutex_unlock(&_coap_state.lock);
 }
 
 static void _memo_clear_resend_buffer(gcoap_request_memo_t *memo)
@@ -472,13 +618,19 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
         /* normal request */
         else if (coap_get_type(&pdu) == COAP_TYPE_NON
                 || coap_get_type(&pdu) == COAP_TYPE_CON) {
-            size_t pdu_len;
+            ssize_t pdu_len;
 
             if (truncated) {
                 /* TBD: Set a Size1 */
                 pdu_len = gcoap_response(&pdu, _listen_buf, sizeof(_listen_buf),
                                          COAP_CODE_REQUEST_ENTITY_TOO_LARGE);
-            } else {
+            }
+#if IS_USED(MODULE_GCOAP_WORKERS)
+            else if (_dispatch_req(sock, &pdu, len, remote, aux, &pdu_len)) {
+                /* handled by a worker, or rejected */
+            }
+#endif
+            else {
                 pdu_len = _handle_req(sock, &pdu, _listen_buf,
                                       sizeof(_listen_buf), remote, aux);
             }
@@ -551,8 +703,7 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
                  * Non-2.xx notifications indicate that the associated observe entry
                  * was removed on the server side. Then also free the memo here. */
                 if (!observe_notification || (code_class != COAP_CLASS_SUCCESS)) {
-                    /* setting the state to unused frees (drops) the memo entry */
-                    memo->state = GCOAP_MEMO_UNUSED;
+                    _memo_free(memo);
                 }
 
                 break;
@@ -584,6 +735,11 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
     }
 
     if (messagelayer_emptyresponse_type != NO_IMMEDIATE_REPLY) {
+        /* buf may be lent by the stack, build the reply in _listen_buf */
+        if (buf != _listen_buf) {
+            memcpy(_listen_buf, buf, sizeof(coap_hdr_t));
+            pdu.hdr = (coap_hdr_t *)_listen_buf;
+        }
         coap_hdr_set_type(pdu.hdr, (uint8_t)messagelayer_emptyresponse_type);
         coap_pkt_set_code(&pdu, COAP_CODE_EMPTY);
         /* Set the token length to 0, preserving the CoAP version as it was and
@@ -593,7 +749,7 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
          * */
         pdu.hdr->ver_t_tkl &= 0xf0;
 
-        ssize_t bytes = _tl_send(sock, buf, sizeof(coap_hdr_t), remote, aux);
+        ssize_t bytes = _tl_send(sock, pdu.hdr, sizeof(coap_hdr_t), remote, aux);
         if (bytes <= 0) {
             DEBUG("gcoap: empty response failed: %" PRIdSIZE "\n", bytes);
         }
@@ -676,8 +832,15 @@ static void _cease_retransmission(gcoap_request_memo_t *memo) {
  *
  * return length of response pdu, or < 0 if can't handle
  */
-static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
-                          size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+/*
+ * Looks up the resource for a request and maintains the Observe registration.
+ *
+ * return   0 if the handler of *resource_ptr is to be called, else the length
+ *          of the (error) response written to buf, or -1 to not respond
+ */
+static ssize_t _prepare_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
+                            size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                            const coap_resource_t **resource_ptr)
 {
     const coap_resource_t *resource     = NULL;
     gcoap_listener_t *listener          = NULL;
@@ -748,6 +911,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
                     memo = &_coap_state.observe_memos[empty_slot];
                     memo->notifier = notifier;
                     memo->observer = observer;
+                    memo->resource = NULL;
                 }
             }
             if (memo == NULL) {
@@ -758,7 +922,13 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         /* finish registration */
         if (memo != NULL) {
             /* resource may be assigned here if it is not already registered */
-            memo->resource = resource;
+            if (memo->resource != resource) {
+                if (memo->resource) {
+                    _obs_memo_unindex(memo);
+                }
+                memo->resource = resource;
+                _obs_memo_index(memo);
+            }
             memo->token_len = coap_get_token_len(pdu);
             memo->socket = *sock;
             if (memo->token_len) {
@@ -772,6 +942,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
+            _obs_memo_unindex(memo);
             memo->observer = NULL;
             gcoap_observe_memo_t *other_memo = NULL;
             _find_obs_memo(&other_memo, remote, NULL, NULL);
@@ -796,6 +967,16 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         return -1;
     }
 
+    *resource_ptr = resource;
+    return 0;
+}
+
+/* Calls the handler of the resource and returns the length of the response */
+static ssize_t _call_handler(const coap_resource_t *resource,
+                             gcoap_socket_t *sock, coap_pkt_t *pdu,
+                             uint8_t *buf, size_t len, sock_udp_ep_t *remote,
+                             sock_udp_aux_tx_t *aux)
+{
     ssize_t pdu_len;
 
     coap_request_ctx_t ctx = {
@@ -813,6 +994,89 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
     return pdu_len;
 }
 
+static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
+                          size_t len, sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    const coap_resource_t *resource = NULL;
+    ssize_t res = _prepare_req(sock, pdu, buf, len, remote, aux, &resource);
+
+    if (res != 0) {
+        return res;
+    }
+    return _call_handler(resource, sock, pdu, buf, len, remote, aux);
+}
+
+#if IS_USED(MODULE_GCOAP_WORKERS)
+/*
+ * Hands a request over to a worker thread. The resource is looked up and the
+ * Observe registration is maintained here, so that state is only touched by
+ * the gcoap thread.
+ *
+ * return   true if the request was taken care of, *pdu_len is then the length
+ *          of a response to send from _listen_buf, if any
+ */
+static bool _dispatch_req(gcoap_socket_t *sock, coap_pkt_t *pdu, size_t len,
+                          sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux,
+                          ssize_t *pdu_len)
+{
+    /* the DTLS sock is not meant to be used by several threads */
+    if (sock->type != GCOAP_SOCKET_TYPE_UDP) {
+        return false;
+    }
+
+    gcoap_worker_job_t *job = gcoap_workers_job_get();
+    if (job == NULL) {
+        *pdu_len = gcoap_response(pdu, _listen_buf, sizeof(_listen_buf),
+                                  COAP_CODE_SERVICE_UNAVAILABLE);
+        return true;
+    }
+    if (len > sizeof(job->buf)) {
+        gcoap_workers_job_cancel(job);
+        *pdu_len = gcoap_response(pdu, _listen_buf, sizeof(_listen_buf),
+                                  COAP_CODE_REQUEST_ENTITY_TOO_LARGE);
+        return true;
+    }
+
+    *pdu_len = _prepare_req(sock, pdu, _listen_buf, sizeof(_listen_buf),
+                            remote, aux, &job->resource);
+    if (*pdu_len != 0) {
+        gcoap_workers_job_cancel(job);
+        return true;
+    }
+
+    /* move the parsed request to the buffer of the job */
+    uint8_t *hdr = (uint8_t *)pdu->hdr;
+    memcpy(job->buf, hdr, len);
+    job->pdu = *pdu;
+    job->pdu.hdr = (coap_hdr_t *)job->buf;
+    job->pdu.payload = job->buf + (pdu->payload - hdr);
+    job->socket = *sock;
+    job->remote = *remote;
+    job->has_aux = (aux != NULL);
+    if (aux) {
+        job->aux = *aux;
+    }
+    gcoap_workers_job_post(job);
+    return true;
+}
+
+ssize_t gcoap_worker_job_handle(gcoap_worker_job_t *job)
+{
+    return _call_handler(job->resource, &job->socket, &job->pdu, job->buf,
+                         sizeof(job->buf), &job->remote,
+                         job->has_aux ? &job->aux : NULL);
+}
+
+void gcoap_worker_job_respond(gcoap_worker_job_t *job, size_t pdu_len)
+{
+    ssize_t bytes = _tl_send(&job->socket, job->buf, pdu_len, &job->remote,
+                             job->has_aux ? &job->aux : NULL);
+    if (bytes <= 0) {
+        DEBUG("gcoap: send response failed: %" PRIdSIZE "\n", bytes);
+    }
+}
+#endif
+
 static const coap_resource_t *_match_resource_path_iterator(const gcoap_listener_t *listener,
                                                             const coap_resource_t *last,
                                                             const uint8_t *uri_path)
@@ -839,6 +1103,19 @@ static int _request_matcher_default(gcoap_listener_t *listener,
                                     const coap_resource_t **resource,
                                     coap_pkt_t *pdu)
 {
+#if IS_USED(MODULE_NANOCOAP_URI_TRIE)
+    if (listener->uri_trie) {
+        switch (coap_uri_trie_lookup(listener->uri_trie, pdu, resource)) {
+        case 0:
+            return GCOAP_RESOURCE_FOUND;
+        case -ENOTSUP:
+            return GCOAP_RESOURCE_WRONG_METHOD;
+        default:
+            return GCOAP_RESOURCE_NO_PATH;
+        }
+    }
+#endif
+
     uint8_t uri[CONFIG_NANOCOAP_URI_MAX];
     int ret = GCOAP_RESOURCE_NO_PATH;
 
@@ -933,8 +1210,8 @@ static int _find_resource(gcoap_socket_type_t tl_type,
 }
 
 /*
- * Finds the memo for an outstanding request within the _coap_state.open_reqs
- * array. Matches on remote endpoint and token.
+ * Finds the memo for an outstanding request in the bucket of its token.
+ * Matches on remote endpoint and token.
  *
  * remote[in]     Remote endpoint to match
  * token[in]      Token to match
@@ -945,12 +1222,14 @@ static int _find_resource(gcoap_socket_type_t tl_type,
 static gcoap_request_memo_t* _find_req_memo_by_token(const sock_udp_ep_t *remote,
                                                      const uint8_t *token, size_t tkl)
 {
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
+    gcoap_request_memo_t *memo;
+
+    LL_FOREACH2(_coap_state.reqs_by_token[_hash_token(token, tkl)], memo,
+                next_by_token) {
+        if (memo->state == GCOAP_MEMO_UNUSED) {
             continue;
         }
 
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
         coap_hdr_t *hdr = gcoap_request_memo_get_hdr(memo);
 
         /* verbose debug to catch bugs with request/response matching */
@@ -1022,8 +1301,8 @@ static gcoap_request_memo_t* _find_req_memo_by_pdu_token(
 }
 
 /*
- * Finds the memo for an outstanding request within the _coap_state.open_reqs
- * array. Matches on remote endpoint and message ID.
+ * Finds the memo for an outstanding request in the bucket of its message
+ * ID. Matches on remote endpoint and message ID.
  *
  * remote[in]     Remote endpoint to match
  * mid[in]        Message ID to match
@@ -1032,13 +1311,13 @@ static gcoap_request_memo_t* _find_req_memo_by_pdu_token(
  */
 static gcoap_request_memo_t* _find_req_memo_by_mid(const sock_udp_ep_t *remote, uint16_t mid)
 {
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
-        if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
+    gcoap_request_memo_t *memo;
+
+    LL_FOREACH2(_coap_state.reqs_by_mid[_hash_mid(mid)], memo, next_by_mid) {
+        if (memo->state == GCOAP_MEMO_UNUSED) {
             continue;
         }
 
-        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
-
         if ((mid == gcoap_request_memo_get_hdr(memo)->id) &&
             sock_udp_ep_equal(&memo->remote_ep, remote)) {
             return memo;
@@ -1063,7 +1342,7 @@ static void _expire_request(gcoap_request_memo_t *memo)
             memo->resp_handler(memo, &req, NULL);
         }
         _memo_clear_resend_buffer(memo);
-        memo->state = GCOAP_MEMO_UNUSED;
+        _memo_free(memo);
     }
     else {
         /* Response already handled; timeout must have fired while response */
@@ -1213,6 +1492,7 @@ static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
         }
 
         if (stale_obs_memo) {
+            _obs_memo_unindex(stale_obs_memo);
             stale_obs_memo->observer = NULL; /* clear memo */
              /* check if no other memo is referencing the same local endpoint ...  */
             gcoap_observe_memo_t *other_memo = NULL;
@@ -1244,11 +1524,13 @@ static void _check_and_expire_obs_memo_last_mid(sock_udp_ep_t *remote,
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource)
 {
+    gcoap_observe_memo_t *entry;
+
     *memo = NULL;
-    for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
-        if (_coap_state.observe_memos[i].observer != NULL
-                && _coap_state.observe_memos[i].resource == resource) {
-            *memo = &_coap_state.observe_memos[i];
+    LL_FOREACH2(_coap_state.obs_by_resource[_hash_resource(resource)], entry,
+                next_by_resource) {
+        if (entry->observer != NULL && entry->resource == resource) {
+            *memo = entry;
             break;
         }
     }
@@ -1475,7 +1757,7 @@ static void _receive_from_cache_cb(void *ctx)
                 memo->state = (ce->truncated) ? GCOAP_MEMO_RESP_TRUNC : GCOAP_MEMO_RESP;
                 memo->resp_handler(memo, &pdu, &memo->remote_ep);
                 _memo_clear_resend_buffer(memo);
-                memo->state = GCOAP_MEMO_UNUSED;
+                _memo_free(memo);
             }
         }
     }
@@ -1616,7 +1898,8 @@ kernel_pid_t gcoap_init(void)
 
     mutex_init(&_coap_state.lock);
     /* Blank lists so we know if an entry is available. */
-    memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
+    memset(_coap_state.open_reqs, 0,
+           _coap_state.open_reqs_numof * sizeof(*_coap_state.open_reqs));
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
@@ -1626,6 +1909,9 @@ kernel_pid_t gcoap_init(void)
     if (IS_USED(MODULE_NANOCOAP_CACHE)) {
         nanocoap_cache_init();
     }
+#if IS_USED(MODULE_GCOAP_WORKERS)
+    gcoap_workers_init();
+#endif
     /* initialize the forward proxy operation, if compiled */
     if (IS_ACTIVE(MODULE_GCOAP_FORWARD_PROXY)) {
         gcoap_forward_proxy_init();
@@ -1666,6 +1952,16 @@ void gcoap_register_listener(gcoap_listener_t *listener)
     if (!listener->request_matcher) {
         listener->request_matcher = _request_matcher_default;
     }
+
+#if IS_USED(MODULE_NANOCOAP_URI_TRIE)
+    if (listener->uri_trie &&
+        (coap_uri_trie_build(listener->uri_trie, listener->resources,
+                             listener->resources_len) < 0)) {
+        /* fall back to matching every resource */
+        DEBUG("gcoap: URI trie of listener too small\n");
+        listener->uri_trie = NULL;
+    }
+#endif
 }
 
 const coap_resource_t *gcoap_get_resource_by_path_iterator(const gcoap_listener_t **last_listener,
@@ -1738,6 +2034,7 @@ int gcoap_obs_req_forget(const sock_udp_ep_t *remote, const uint8_t *token,
     obs_req_memo = _find_req_memo_by_token(remote, token, tokenlen);
     if (obs_req_memo) {
         /* forget the existing observe memo. */
+        _memo_unindex(obs_req_memo);
         obs_req_memo->state = GCOAP_MEMO_UNUSED;
         res = 0;
     }
@@ -1769,7 +2066,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
     if ((resp_handler != NULL) || (msg_type == COAP_TYPE_CON)) {
         mutex_lock(&_coap_state.lock);
         /* Find empty slot in list of open requests. */
-        for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+        for (size_t i = 0; i < _coap_state.open_reqs_numof; i++) {
             if (_coap_state.open_reqs[i].state == GCOAP_MEMO_UNUSED) {
                 memo = &_coap_state.open_reqs[i];
                 memo->state = GCOAP_MEMO_WAIT;
@@ -1845,6 +2142,9 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             DEBUG("gcoap: illegal msg type %u\n", msg_type);
             break;
         }
+        if (memo->state != GCOAP_MEMO_UNUSED) {
+            _memo_index(memo);
+        }
         mutex_unlock(&_coap_state.lock);
         if (memo->state == GCOAP_MEMO_UNUSED) {
             return 0;
@@ -1902,7 +2202,7 @@ ssize_t gcoap_req_send(const uint8_t *buf, size_t len,
             if (timeout > 0) {
                 event_timeout_clear(&memo->resp_evt_tmout);
             }
-            memo->state = GCOAP_MEMO_UNUSED;
+            _memo_free(memo);
     }
         DEBUG("gcoap: sock send failed: %" PRIdSIZE "\n", res);
     }
@@ -1926,6 +2226,8 @@ int gcoap_resp_init(coap_pkt_t *pdu, uint8_t *buf, size_t len, unsigned code)
         return -1;
     }
 
+    /* the request may be in a different buffer than the response */
+    pdu->hdr         = (coap_hdr_t *)buf;
     pdu->options_len = 0;
     pdu->payload     = buf + header_len;
     pdu->payload_len = len - header_len;
@@ -1991,10 +2293,10 @@ size_t gcoap_obs_send(const uint8_t *buf, size_t len,
     return ret <= 0 ? 0 : (size_t)ret;
 }
 
-uint8_t gcoap_op_state(void)
+static size_t _open_reqs_count(void)
 {
-    uint8_t count = 0;
-    for (int i = 0; i < CONFIG_GCOAP_REQ_WAITING_MAX; i++) {
+    size_t count = 0;
+    for (size_t i = 0; i < _coap_state.open_reqs_numof; i++) {
         if (_coap_state.open_reqs[i].state != GCOAP_MEMO_UNUSED) {
             count++;
         }
@@ -2002,6 +2304,43 @@ uint8_t gcoap_op_state(void)
     return count;
 }
 
+int gcoap_req_memo_pool_set(gcoap_request_memo_t *memos, size_t numof)
+{
+    if (memos == NULL) {
+        memos = _open_reqs;
+        numof = ARRAY_SIZE(_open_reqs);
+    }
+
+    mutex_lock(&_coap_state.lock);
+    if (_open_reqs_count() > 0) {
+        mutex_unlock(&_coap_state.lock);
+        return -EBUSY;
+    }
+    /* unused memos may still have their response timeout pending, e.g. if
+     * released by gcoap_obs_req_forget(), which must not outlive the pool */
+    for (size_t i = 0; i < _coap_state.open_reqs_numof; i++) {
+        gcoap_request_memo_t *memo = &_coap_state.open_reqs[i];
+
+        if (memo->resp_evt_tmout.clock) {
+            event_timeout_clear(&memo->resp_evt_tmout);
+            event_cancel(&_queue, &memo->resp_tmout_cb.super);
+        }
+    }
+    memset(memos, 0, numof * sizeof(*memos));
+    memset(_coap_state.reqs_by_token, 0, sizeof(_coap_state.reqs_by_token));
+    memset(_coap_state.reqs_by_mid, 0, sizeof(_coap_state.reqs_by_mid));
+    _coap_state.open_reqs = memos;
+    _coap_state.open_reqs_numof = numof;
+    mutex_unlock(&_coap_state.lock);
+    return 0;
+}
+
+uint8_t gcoap_op_state(void)
+{
+    size_t count = _open_reqs_count();
+    return (count > UINT8_MAX) ? UINT8_MAX : count;
+}
+
 int gcoap_get_resource_list(void *buf, size_t maxlen, uint8_t cf,
                                gcoap_socket_type_t tl_type)
 {
@@ -2095,7 +2434,10 @@ void gcoap_forward_proxy_find_req_memo(gcoap_request_memo_t **memo_ptr,
                                        coap_pkt_t *src_pdu,
                                        const sock_udp_ep_t *remote)
 {
+    /* the forward proxy may run in a gcoap worker */
+    mutex_lock(&_coap_state.lock);
     *memo_ptr = _find_req_memo_by_pdu_token(src_pdu, remote);
+    mutex_unlock(&_coap_state.lock);
 }
 
 void gcoap_forward_proxy_post_event(void *arg)
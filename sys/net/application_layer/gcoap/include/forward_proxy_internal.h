@@ -37,6 +37,7 @@ extern "C" {
  */
 typedef struct {
     coap_pkt_t pdu;                         /**< forward CoAP PDU */
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE]; /**< buffer of the forward PDU */
     sock_udp_ep_t server_ep;                /**< forward Server endpoint */
     sock_udp_ep_t ep;                       /**< client endpoint */
     sock_udp_ep_t proxy_ep;                 /**< proxy endpoint */
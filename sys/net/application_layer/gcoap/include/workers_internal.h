@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for
+ * more details.
+ */
+
+#pragma once
+
+/**
+ * @ingroup     net_gcoap
+ *
+ * @{
+ *
+ * @file
+ * @brief       Definitions for handing requests over to the gcoap workers
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "event.h"
+#include "net/gcoap.h"
+#include "net/sock/udp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Request handed over to a worker
+ */
+typedef struct {
+    event_t super;                          /**< event posted to the worker */
+    coap_pkt_t pdu;                         /**< request, parsed in @ref buf */
+    const coap_resource_t *resource;        /**< resource to handle it */
+    gcoap_socket_t socket;                  /**< socket to respond via */
+    sock_udp_ep_t remote;                   /**< remote endpoint */
+    sock_udp_aux_tx_t aux;                  /**< auxiliary data to respond */
+    bool has_aux;                           /**< @ref aux is used */
+    uint8_t worker;                         /**< index of the worker */
+    uint8_t used;                           /**< job is reserved */
+    uint32_t dispatched;                    /**< time of dispatch in µs */
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE]; /**< request, then response */
+} gcoap_worker_job_t;
+
+/**
+ * @brief   Starts the worker threads
+ */
+void gcoap_workers_init(void);
+
+/**
+ * @brief   Reserves a job for the least busy worker
+ *
+ * @return  the job, to be passed to @ref gcoap_workers_job_post() or
+ *          @ref gcoap_workers_job_cancel()
+ * @return  NULL if the queues of all workers are full, counted as rejected
+ *          request
+ */
+gcoap_worker_job_t *gcoap_workers_job_get(void);
+
+/**
+ * @brief   Hands a job over to its worker
+ *
+ * @param[in] job   job from @ref gcoap_workers_job_get(), filled in
+ */
+void gcoap_workers_job_post(gcoap_worker_job_t *job);
+
+/**
+ * @brief   Releases a reserved job without handling it
+ *
+ * @param[in] job   job from @ref gcoap_workers_job_get()
+ */
+void gcoap_workers_job_cancel(gcoap_worker_job_t *job);
+
+/**
+ * @brief   Runs the handler of a request
+ *
+ * Implemented by gcoap, called in the worker thread.
+ *
+ * @param[in] job   job to handle
+ *
+ * @return  length of the response in the buffer of @p job, <= 0 for none
+ */
+ssize_t gcoap_worker_job_handle(gcoap_worker_job_t *job);
+
+/**
+ * @brief   Sends the response to a request
+ *
+ * Implemented by gcoap, called in the worker thread.
+ *
+ * @param[in] job       job handled
+ * @param[in] pdu_len   length of the response in the buffer of @p job
+ */
+void gcoap_worker_job_respond(gcoap_worker_job_t *job, size_t pdu_len);
+
+#ifdef __cplusplus
+}
+#endif
+/** @} */
@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gcoap
+ * @{
+ *
+ * @file
+ * @brief       Worker threads running the request handlers of gcoap
+ *
+ * Every worker has its own event queue, holding up to
+ * CONFIG_GCOAP_WORKER_QUEUE_LEN jobs. Jobs are reserved and posted by the
+ * gcoap thread, and released by the worker once the response is sent. A
+ * worker counts as done with a job before sending the response, as the
+ * network stack preempts it while sending: otherwise the next request of the
+ * client may arrive before the worker is idle again. Hence, there is one job
+ * more per worker than it may have queued.
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include "assert.h"
+#include "atomic_utils.h"
+#include "container.h"
+#include "event.h"
+#include "irq.h"
+#include "net/gcoap.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#include "workers_internal.h"
+
+#define ENABLE_DEBUG    0
+#include "debug.h"
+
+typedef struct {
+    event_queue_t queue;
+    gcoap_worker_stats_t stats;
+    uint8_t pending;                    /* jobs posted, not yet handled */
+    char stack[GCOAP_WORKER_STACK_SIZE];
+} _worker_t;
+
+static _worker_t _workers[CONFIG_GCOAP_WORKERS_NUMOF];
+static gcoap_worker_job_t _jobs[CONFIG_GCOAP_WORKERS_NUMOF *
+                                (CONFIG_GCOAP_WORKER_QUEUE_LEN + 1)];
+static uint32_t _rejected;
+
+static void _on_job(event_t *event)
+{
+    gcoap_worker_job_t *job = container_of(event, gcoap_worker_job_t, super);
+    _worker_t *worker = &_workers[job->worker];
+
+    ssize_t pdu_len = gcoap_worker_job_handle(job);
+
+    atomic_fetch_sub_u8(&worker->pending, 1);
+    if (pdu_len > 0) {
+        gcoap_worker_job_respond(job, pdu_len);
+    }
+
+    uint32_t latency = ztimer_now(ZTIMER_USEC) - job->dispatched;
+    unsigned state = irq_disable();
+    worker->stats.requests++;
+    worker->stats.latency_sum += latency;
+    if (latency > worker->stats.latency_max) {
+        worker->stats.latency_max = latency;
+    }
+    irq_restore(state);
+
+    atomic_store_u8(&job->used, 0);
+    /* let the other workers of the same priority take turns */
+    thread_yield();
+}
+
+static void *_worker_thread(void *arg)
+{
+    _worker_t *worker = arg;
+
+    event_queue_claim(&worker->queue);
+    event_loop(&worker->queue);
+    return NULL;
+}
+
+void gcoap_workers_init(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_jobs); i++) {
+        _jobs[i].super.handler = _on_job;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_workers); i++) {
+        _worker_t *worker = &_workers[i];
+
+        /* jobs may be posted before the worker runs */
+        event_queue_init_detached(&worker->queue);
+        kernel_pid_t pid = thread_create(worker->stack, sizeof(worker->stack),
+                                         GCOAP_WORKER_PRIO, 0, _worker_thread,
+                                         worker, "gcoap worker");
+        if (pid <= KERNEL_PID_UNDEF) {
+            DEBUG("gcoap: can't create worker %u\n", i);
+            /* never pick it */
+            worker->pending = CONFIG_GCOAP_WORKER_QUEUE_LEN;
+        }
+    }
+}
+
+gcoap_worker_job_t *gcoap_workers_job_get(void)
+{
+    unsigned best = 0;
+    uint8_t best_pending = UINT8_MAX;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_workers); i++) {
+        uint8_t pending = atomic_load_u8(&_workers[i].pending);
+
+        if (pending < best_pending) {
+            best = i;
+            best_pending = pending;
+        }
+    }
+    if (best_pending >= CONFIG_GCOAP_WORKER_QUEUE_LEN) {
+        _rejected++;
+        DEBUG("gcoap: all workers busy\n");
+        return NULL;
+    }
+
+    /* with at most CONFIG_GCOAP_WORKER_QUEUE_LEN jobs per worker pending,
+     * plus one being sent, there always is a free one */
+    for (unsigned i = 0; i < ARRAY_SIZE(_jobs); i++) {
+        if (!atomic_load_u8(&_jobs[i].used)) {
+            _jobs[i].used = 1;
+            _jobs[i].worker = best;
+            atomic_fetch_add_u8(&_workers[best].pending, 1);
+            return &_jobs[i];
+        }
+    }
+    assert(0);
+    return NULL;
+}
+
+void gcoap_workers_job_post(gcoap_worker_job_t *job)
+{
+    job->dispatched = ztimer_now(ZTIMER_USEC);
+    event_post(&_workers[job->worker].queue, &job->super);
+}
+
+void gcoap_workers_job_cancel(gcoap_worker_job_t *job)
+{
+    atomic_store_u8(&job->used, 0);
+    atomic_fetch_sub_u8(&_workers[job->worker].pending, 1);
+}
+
+int gcoap_worker_stats_get(unsigned worker, gcoap_worker_stats_t *stats)
+{
+    if (worker >= ARRAY_SIZE(_workers)) {
+        return -ENOENT;
+    }
+
+    unsigned state = irq_disable();
+    *stats = _workers[worker].stats;
+    irq_restore(state);
+    return 0;
+}
+
+uint32_t gcoap_workers_rejected(void)
+{
+    return _rejected;
+}
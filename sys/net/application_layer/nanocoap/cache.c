@@ -18,55 +18,141 @@
  * @}
  */
 
+#include <assert.h>
 #include <string.h>
 
 #include "kernel_defines.h"
 #include "net/nanocoap/cache.h"
 #include "hashes/sha256.h"
+#include "utlist.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static_assert(((CONFIG_NANOCOAP_CACHE_HASH_BUCKETS &
+                (CONFIG_NANOCOAP_CACHE_HASH_BUCKETS - 1)) == 0) &&
+              (CONFIG_NANOCOAP_CACHE_HASH_BUCKETS <= 256),
+              "CONFIG_NANOCOAP_CACHE_HASH_BUCKETS must be a power of 2 <= 256");
+static_assert(CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE <= CONFIG_NANOCOAP_CACHE_ARENA_SIZE,
+              "CONFIG_NANOCOAP_CACHE_ARENA_SIZE can't hold a single response");
+
 static int _cache_replacement_lru(void);
 static int _cache_update_lru(clist_node_t *node);
 
-static clist_node_t _cache_list_head = { NULL };
+/* least recently used entry first */
+static nanocoap_cache_entry_t *_lru_head;
 static clist_node_t _empty_list_head = { NULL };
+static nanocoap_cache_entry_t *_buckets[CONFIG_NANOCOAP_CACHE_HASH_BUCKETS];
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
 
+static uint8_t _arena[CONFIG_NANOCOAP_CACHE_ARENA_SIZE];
+static size_t _arena_end;   /* end of the last response in the arena */
+static size_t _arena_used;  /* sum of the lengths of all responses */
+
+static nanocoap_cache_stats_t _stats;
+
 static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
 static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
 
-static int _cache_replacement_lru(void)
+static unsigned _hash_key(const uint8_t *cache_key)
 {
-    clist_node_t *lru_node = clist_lpeek(&_cache_list_head);
+    /* cache keys are SHA-256 digests, so any byte of them is well spread */
+    return cache_key[0] & (CONFIG_NANOCOAP_CACHE_HASH_BUCKETS - 1);
+}
 
+static int _cache_replacement_lru(void)
+{
     /* no element in the list */
-    if (!lru_node) {
+    if (!_lru_head) {
         return -1;
     }
 
-    nanocoap_cache_entry_t *lru_ce = container_of(lru_node, nanocoap_cache_entry_t, node);
-    return nanocoap_cache_del(lru_ce);
+    _stats.evictions++;
+    return nanocoap_cache_del(_lru_head);
 }
 
 static int _cache_update_lru(clist_node_t *node)
 {
-    if (clist_remove(&_cache_list_head, node)) {
-        /* Move an accessed node to the end of the list. Least
-         * recently used nodes are at the beginning of this list */
-        clist_rpush(&_cache_list_head, node);
-        return 0;
+    nanocoap_cache_entry_t *ce = container_of(node, nanocoap_cache_entry_t, node);
+
+    /* Move an accessed entry to the end of the list. Least
+     * recently used entries are at the beginning of this list */
+    DL_DELETE2(_lru_head, ce, lru_prev, lru_next);
+    DL_APPEND2(_lru_head, ce, lru_prev, lru_next);
+    return 0;
+}
+
+static void _arena_compact(void)
+{
+    size_t end = 0;
+
+    /* move the responses to the start of the arena, keeping their order */
+    while (1) {
+        nanocoap_cache_entry_t *next = NULL;
+
+        for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+            nanocoap_cache_entry_t *ce = &_cache_entries[i];
+
+            if (ce->response_buf && (ce->response_buf >= &_arena[end]) &&
+                (!next || (ce->response_buf < next->response_buf))) {
+                next = ce;
+            }
+        }
+        if (!next) {
+            break;
+        }
+
+        uint8_t *buf = &_arena[end];
+        memmove(buf, next->response_buf, next->response_len);
+        next->response_pkt.hdr = (coap_hdr_t *)buf;
+        next->response_pkt.payload = buf + (next->response_pkt.payload -
+                                            next->response_buf);
+        next->response_buf = buf;
+        end += next->response_len;
+    }
+    _arena_end = end;
+}
+
+static uint8_t *_arena_alloc(size_t len)
+{
+    while ((CONFIG_NANOCOAP_CACHE_ARENA_SIZE - _arena_used) < len) {
+        /* could not remove any entry */
+        if (_replacement_strategy()) {
+            return NULL;
+        }
+    }
+    if ((CONFIG_NANOCOAP_CACHE_ARENA_SIZE - _arena_end) < len) {
+        _arena_compact();
+    }
+
+    uint8_t *buf = &_arena[_arena_end];
+    _arena_end += len;
+    _arena_used += len;
+    return buf;
+}
+
+static void _arena_free(const nanocoap_cache_entry_t *ce)
+{
+    _arena_used -= ce->response_len;
+    if (!_arena_used) {
+        _arena_end = 0;
+    }
+    else if ((ce->response_buf + ce->response_len) == &_arena[_arena_end]) {
+        /* the last response can be given back without compaction */
+        _arena_end -= ce->response_len;
     }
-    return -1;
 }
 
 void nanocoap_cache_init(void)
 {
-    _cache_list_head.next = NULL;
+    _lru_head = NULL;
     _empty_list_head.next = NULL;
+    memset(_buckets, 0, sizeof(_buckets));
     memset(_cache_entries, 0, sizeof(_cache_entries));
+    _arena_end = 0;
+    _arena_used = 0;
+    memset(&_stats, 0, sizeof(_stats));
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
         clist_rpush(&_empty_list_head, &_cache_entries[i].node);
@@ -75,7 +161,7 @@ void nanocoap_cache_init(void)
 
 size_t nanocoap_cache_used_count(void)
 {
-    return clist_count(&_cache_list_head);
+    return CONFIG_NANOCOAP_CACHE_ENTRIES - nanocoap_cache_free_count();
 }
 
 size_t nanocoap_cache_free_count(void)
@@ -83,6 +169,16 @@ size_t nanocoap_cache_free_count(void)
     return clist_count(&_empty_list_head);
 }
 
+size_t nanocoap_cache_arena_used(void)
+{
+    return _arena_used;
+}
+
+void nanocoap_cache_stats_get(nanocoap_cache_stats_t *stats)
+{
+    *stats = _stats;
+}
+
 static void _cache_key_digest_opts(const coap_pkt_t *req, sha256_context_t *ctx,
         bool include_etag,
         bool include_blockwise)
@@ -154,31 +250,30 @@ ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
+static nanocoap_cache_entry_t *_lookup(const uint8_t *cache_key)
 {
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
+    nanocoap_cache_entry_t *ce;
 
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
+    LL_FOREACH2(_buckets[_hash_key(cache_key)], ce, next_by_key) {
+        if (!memcmp(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+            _update_strategy(&ce->node);
+            return ce;
+        }
     }
-    return 0;
+    return NULL;
 }
 
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
+nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *cache_key)
 {
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
-}
-
-nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
-{
-    clist_node_t *node = _nanocoap_cache_foreach(key);
+    nanocoap_cache_entry_t *ce = _lookup(cache_key);
 
-    if (node) {
-        _update_strategy(node);
+    if (ce) {
+        _stats.hits++;
     }
-
-    return container_of(node, nanocoap_cache_entry_t, node);
+    else {
+        _stats.misses++;
+    }
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -199,7 +294,7 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
                                                const coap_pkt_t *resp, size_t resp_len)
 {
     nanocoap_cache_entry_t *ce;
-    ce = nanocoap_cache_key_lookup(cache_key);
+    ce = _lookup(cache_key);
 
     /* This response is not cacheable. */
     if (resp->hdr->code == COAP_CODE_CREATED) {
@@ -277,39 +372,49 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
                                                   const coap_pkt_t *resp,
                                                   size_t resp_len)
 {
-    nanocoap_cache_entry_t *ce = nanocoap_cache_key_lookup(cache_key);
-    bool add_to_cache = false;
+    nanocoap_cache_entry_t *ce = _lookup(cache_key);
 
-    if (resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE) {
-        DEBUG("nanocoap_cache: response too large to cache (%" PRIuSIZE "> %d)\n",
+    if ((resp_len == 0) || (resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE)) {
+        DEBUG("nanocoap_cache: can't cache response of %" PRIuSIZE " bytes (max %d)\n",
               resp_len, CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE);
         return NULL;
     }
 
-    if (!ce) {
-        /* did not find .. get an empty cache container */
-        ce = _nanocoap_cache_pop();
-        add_to_cache = true;
+    if (ce && (ce->response_len != resp_len)) {
+        /* the response needs a different amount of space, add it anew */
+        nanocoap_cache_del(ce);
+        ce = NULL;
     }
 
-    /* no space left */
     if (!ce) {
-        /* could not remove any entry */
-        if (_replacement_strategy()) {
-            return NULL;
-        }
-        /* could remove an entry */
+        /* did not find .. get an empty cache container */
         ce = _nanocoap_cache_pop();
-        add_to_cache = true;
+        /* no space left */
         if (!ce) {
-            /* still no free space ? stop trying now */
+            /* could not remove any entry */
+            if (_replacement_strategy()) {
+                return NULL;
+            }
+            /* could remove an entry */
+            ce = _nanocoap_cache_pop();
+            if (!ce) {
+                /* still no free space ? stop trying now */
+                return NULL;
+            }
+        }
+        /* not in any list, so neither compacted nor replaced meanwhile */
+        ce->response_buf = _arena_alloc(resp_len);
+        if (!ce->response_buf) {
+            clist_rpush(&_empty_list_head, &ce->node);
             return NULL;
         }
+        memcpy(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
+        LL_PREPEND2(_buckets[_hash_key(cache_key)], ce, next_by_key);
+        DL_APPEND2(_lru_head, ce, lru_prev, lru_next);
     }
 
-    memcpy(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
     memcpy(&ce->response_pkt, resp, sizeof(coap_pkt_t));
-    memcpy(&ce->response_buf, resp->hdr, resp_len);
+    memcpy(ce->response_buf, resp->hdr, resp_len);
     ce->response_pkt.hdr = (coap_hdr_t *) ce->response_buf;
     ce->response_pkt.payload = ce->response_buf + (resp->payload - ((uint8_t *)resp->hdr));
     ce->response_len = resp_len;
@@ -320,10 +425,6 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     coap_opt_get_uint((coap_pkt_t *)resp, COAP_OPT_MAX_AGE, &max_age);
     ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
 
-    if (add_to_cache) {
-        clist_rpush(&_cache_list_head, &ce->node);
-    }
-
     return ce;
 }
 
@@ -344,14 +445,19 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_req(const coap_pkt_t *req,
 
 int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *entry = clist_find(&_cache_list_head, &ce->node);
-
-    if (entry) {
-        clist_remove(&_cache_list_head, entry);
-        memset(entry, 0, sizeof(nanocoap_cache_entry_t));
-        clist_rpush(&_empty_list_head, entry);
-        return 0;
+    /* only entries in the cache have a response */
+    if ((ce < _cache_entries) ||
+        (ce >= &_cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES]) ||
+        !ce->response_buf) {
+        return -1;
     }
 
-    return -1;
+    nanocoap_cache_entry_t *entry = &_cache_entries[ce - _cache_entries];
+
+    DL_DELETE2(_lru_head, entry, lru_prev, lru_next);
+    LL_DELETE2(_buckets[_hash_key(entry->cache_key)], entry, next_by_key);
+    _arena_free(entry);
+    memset(entry, 0, sizeof(nanocoap_cache_entry_t));
+    clist_rpush(&_empty_list_head, &entry->node);
+    return 0;
 }
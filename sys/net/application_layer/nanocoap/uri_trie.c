@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_nanocoap_uri_trie
+ * @{
+ *
+ * @file
+ * @brief       NanoCoAP URI-Path trie implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "net/nanocoap/uri_trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* state of matching a path against the trie */
+typedef struct {
+    const coap_uri_trie_t *trie;
+    coap_method_flags_t method_flag;
+    uint16_t node;                      /* node reached so far */
+    uint16_t offset;                    /* matched length of its label */
+    bool failed;                        /* path left the trie */
+    bool path_found;                    /* a resource matched the path */
+    unsigned best;                      /* index + 1 of the resource found */
+} _walk_t;
+
+static unsigned _new_node(coap_uri_trie_t *trie, const char *label,
+                          size_t label_len)
+{
+    if (trie->nodes_used == trie->nodes_numof) {
+        return 0;
+    }
+    unsigned idx = trie->nodes_used++;
+
+    trie->nodes[idx] = (coap_uri_trie_node_t){
+        .label = label,
+        .label_len = label_len,
+    };
+    return idx;
+}
+
+static unsigned _find_child(const coap_uri_trie_t *trie, unsigned node, char c)
+{
+    unsigned child = trie->nodes[node].child;
+
+    while (child && (trie->nodes[child].label[0] != c)) {
+        child = trie->nodes[child].sibling;
+    }
+    return child;
+}
+
+static int _insert(coap_uri_trie_t *trie, unsigned idx)
+{
+    coap_uri_trie_node_t *nodes = trie->nodes;
+    const char *key = trie->resources[idx].path;
+    size_t key_len = strlen(key);
+    unsigned node = 0;
+
+    if (key_len > UINT16_MAX) {
+        return -ENOMEM;
+    }
+    while (key_len) {
+        unsigned child = _find_child(trie, node, *key);
+
+        if (child == 0) {
+            if ((child = _new_node(trie, key, key_len)) == 0) {
+                return -ENOMEM;
+            }
+            nodes[child].sibling = nodes[node].child;
+            nodes[node].child = child;
+            node = child;
+            break;
+        }
+
+        size_t common = 1;
+        while ((common < nodes[child].label_len) && (common < key_len) &&
+               (nodes[child].label[common] == key[common])) {
+            common++;
+        }
+        if (common < nodes[child].label_len) {
+            /* split the edge, the child keeps its place in the list of its
+             * parent and becomes the common prefix */
+            unsigned rest = _new_node(trie, nodes[child].label + common,
+                                      nodes[child].label_len - common);
+            if (rest == 0) {
+                return -ENOMEM;
+            }
+            nodes[rest].child = nodes[child].child;
+            nodes[rest].resource = nodes[child].resource;
+            nodes[child].label_len = common;
+            nodes[child].child = rest;
+            nodes[child].resource = 0;
+        }
+        node = child;
+        key += common;
+        key_len -= common;
+    }
+
+    /* keep resources with the same path in the order of the array */
+    uint16_t *link = &nodes[node].resource;
+    while (*link) {
+        link = &trie->next[*link - 1];
+    }
+    *link = idx + 1;
+    trie->next[idx] = 0;
+    return 0;
+}
+
+int coap_uri_trie_build(coap_uri_trie_t *trie,
+                        const coap_resource_t *resources, size_t numof)
+{
+    assert(trie && trie->nodes && trie->next && (resources || !numof));
+
+    if ((numof > trie->next_numof) || (trie->nodes_numof == 0)) {
+        return -ENOMEM;
+    }
+    trie->resources = resources;
+    trie->nodes_used = 0;
+    _new_node(trie, NULL, 0);
+
+    for (unsigned i = 0; i < numof; i++) {
+        int res = _insert(trie, i);
+        if (res < 0) {
+            DEBUG("nanocoap: uri_trie out of nodes at resource %u\n", i);
+            return res;
+        }
+    }
+    DEBUG("nanocoap: uri_trie of %u resources uses %u nodes\n",
+          (unsigned)numof, trie->nodes_used);
+    return 0;
+}
+
+/* checks the resources with the path matched so far, if the path does not
+ * end here, only resources matching a subtree are eligible */
+static void _check_resources(_walk_t *walk, bool path_end)
+{
+    const coap_uri_trie_t *trie = walk->trie;
+
+    for (unsigned idx = trie->nodes[walk->node].resource; idx;
+         idx = trie->next[idx - 1]) {
+        const coap_resource_t *resource = &trie->resources[idx - 1];
+
+        if (!path_end && !(resource->methods & COAP_MATCH_SUBTREE)) {
+            continue;
+        }
+        walk->path_found = true;
+        if ((resource->methods & walk->method_flag) &&
+            ((walk->best == 0) || (idx < walk->best))) {
+            walk->best = idx;
+        }
+    }
+}
+
+static void _feed(_walk_t *walk, const uint8_t *part, size_t len)
+{
+    const coap_uri_trie_node_t *nodes = walk->trie->nodes;
+
+    while (len && !walk->failed) {
+        if (walk->offset == nodes[walk->node].label_len) {
+            _check_resources(walk, false);
+            unsigned child = _find_child(walk->trie, walk->node, *part);
+            if (child == 0) {
+                walk->failed = true;
+                return;
+            }
+            walk->node = child;
+            walk->offset = 0;
+        }
+
+        const coap_uri_trie_node_t *node = &nodes[walk->node];
+        size_t n = node->label_len - walk->offset;
+
+        if (n > len) {
+            n = len;
+        }
+        if (memcmp(node->label + walk->offset, part, n) != 0) {
+            walk->failed = true;
+            return;
+        }
+        walk->offset += n;
+        part += n;
+        len -= n;
+    }
+}
+
+int coap_uri_trie_lookup(const coap_uri_trie_t *trie, coap_pkt_t *pkt,
+                         const coap_resource_t **resource)
+{
+    assert(trie && trie->nodes_used && pkt && resource);
+
+    _walk_t walk = {
+        .trie = trie,
+        .method_flag = coap_method2flag(coap_get_code_detail(pkt)),
+    };
+    uint8_t *opt_pos = NULL;
+    uint8_t *part;
+    int part_len;
+
+    /* same path as coap_get_uri_path() assembles, i.e. "/" without Uri-Path */
+    while (!walk.failed &&
+           (part = coap_iterate_option(pkt, COAP_OPT_URI_PATH, &opt_pos,
+                                       &part_len))) {
+        _feed(&walk, (const uint8_t *)"/", 1);
+        _feed(&walk, part, part_len);
+    }
+    if (opt_pos == NULL) {
+        _feed(&walk, (const uint8_t *)"/", 1);
+    }
+    if (!walk.failed &&
+        (walk.offset == trie->nodes[walk.node].label_len)) {
+        _check_resources(&walk, true);
+    }
+
+    if (walk.best) {
+        *resource = &trie->resources[walk.best - 1];
+        return 0;
+    }
+    return walk.path_found ? -ENOTSUP : -ENOENT;
+}
+
+ssize_t coap_uri_trie_handler(coap_pkt_t *pkt, uint8_t *resp_buf,
+                              unsigned resp_buf_len, coap_request_ctx_t *ctx,
+                              const coap_uri_trie_t *trie)
+{
+    const coap_resource_t *resource;
+
+    if (coap_uri_trie_lookup(trie, pkt, &resource) < 0) {
+        return coap_build_reply(pkt, COAP_CODE_404, resp_buf, resp_buf_len, 0);
+    }
+    ctx->resource = resource;
+    return resource->handler(pkt, resp_buf, resp_buf_len, ctx);
+}
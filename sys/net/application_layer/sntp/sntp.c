@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <errno.h>
 #include <string.h>
 #include "net/sntp.h"
 #include "net/ntp_packet.h"
@@ -34,6 +35,15 @@ static int64_t _sntp_offset = 0;
 static mutex_t _sntp_mutex = MUTEX_INIT;
 static ntp_packet_t _sntp_packet;
 
+static void _set_offset(const ntp_packet_t *reply)
+{
+    mutex_lock(&_sntp_mutex);
+    _sntp_offset = (((int64_t)byteorder_ntohl(reply->transmit.seconds)) * US_PER_SEC) +
+                   ((((int64_t)byteorder_ntohl(reply->transmit.fraction)) * 232)
+                   / 1000000) - xtimer_now_usec64();
+    mutex_unlock(&_sntp_mutex);
+}
+
 int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
 {
     int result;
@@ -57,6 +67,35 @@ int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
         sock_udp_close(&_sntp_sock);
         return result;
     }
+#if IS_USED(MODULE_SOCK_UDP_RECV_VIEW)
+    sock_udp_recv_view_t view;
+    const ntp_packet_t *reply = &_sntp_packet;
+
+    if ((result = (int)sock_udp_recv_view(&_sntp_sock, &view, timeout,
+                                          NULL)) < 0) {
+        DEBUG("Error receiving message\n");
+        sock_udp_close(&_sntp_sock);
+        return result;
+    }
+    if (view.len < sizeof(ntp_packet_t)) {
+        DEBUG("Reply too short\n");
+        result = -EBADMSG;
+    }
+    else if (view.snips[0].iol_next == NULL) {
+        /* read the reply where the stack received it */
+        reply = view.snips[0].iol_base;
+    }
+    else {
+        result = iolist_to_buffer(view.snips, &_sntp_packet,
+                                  sizeof(_sntp_packet));
+    }
+    if (result >= 0) {
+        _set_offset(reply);
+    }
+    sock_udp_recv_view_release(&_sntp_sock, &view);
+    sock_udp_close(&_sntp_sock);
+    return (result < 0) ? result : 0;
+#else
     if ((result = (int)sock_udp_recv(&_sntp_sock,
                                      &_sntp_packet,
                                      sizeof(_sntp_packet),
@@ -67,12 +106,9 @@ int sntp_sync(sock_udp_ep_t *server, uint32_t timeout)
         return result;
     }
     sock_udp_close(&_sntp_sock);
-    mutex_lock(&_sntp_mutex);
-    _sntp_offset = (((int64_t)byteorder_ntohl(_sntp_packet.transmit.seconds)) * US_PER_SEC) +
-                   ((((int64_t)byteorder_ntohl(_sntp_packet.transmit.fraction)) * 232)
-                   / 1000000) - xtimer_now_usec64();
-    mutex_unlock(&_sntp_mutex);
+    _set_offset(&_sntp_packet);
     return 0;
+#endif
 }
 
 int64_t sntp_get_offset(void)
@@ -70,6 +70,21 @@ void auto_init_sock_dns(void)
 }
 #endif /* MODULE_AUTO_INIT_SOCK_DNS */
 
+static int _parse_reply(const uint8_t *buf, size_t len, int family,
+                        void *addr_out, uint32_t *ttl)
+{
+    int res;
+
+    if (len < DNS_MIN_REPLY_LEN) {
+        DEBUG("sock_dns: reply too small (%d byte)\n", (int)len);
+        return -EBADMSG;
+    }
+    if ((res = dns_msg_parse_reply(buf, len, family, addr_out, ttl)) <= 0) {
+        DEBUG("sock_dns: can't parse response\n");
+    }
+    return res;
+}
+
 int sock_dns_query(const char *domain_name, void *addr_out, int family)
 {
     ssize_t res;
@@ -103,24 +118,35 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
             DEBUG("sock_dns: can't send: %s\n", strerror(-res));
             continue;
         }
+        uint32_t ttl;
+#if IS_USED(MODULE_SOCK_UDP_RECV_VIEW)
+        sock_udp_recv_view_t view;
+
+        res = sock_udp_recv_view(&sock_dns, &view, 1000000LU, NULL);
+        if (res >= 0) {
+            if (view.snips[0].iol_next == NULL) {
+                /* parse the reply where the stack received it */
+                res = _parse_reply(view.snips[0].iol_base, res, family,
+                                   addr_out, &ttl);
+            }
+            else if ((res = iolist_to_buffer(view.snips, dns_buf,
+                                             sizeof(dns_buf))) >= 0) {
+                res = _parse_reply(dns_buf, res, family, addr_out, &ttl);
+            }
+            sock_udp_recv_view_release(&sock_dns, &view);
+        }
+#else
         res = sock_udp_recv(&sock_dns, dns_buf, sizeof(dns_buf), 1000000LU, NULL);
-        if (res < 0) {
-            DEBUG("sock_dns: can't receive: %s\n", strerror(-res));
-            continue;
+        if (res >= 0) {
+            res = _parse_reply(dns_buf, res, family, addr_out, &ttl);
         }
-        if (res < (int)DNS_MIN_REPLY_LEN) {
-            DEBUG("sock_dns: reply too small (%d byte)\n", (int)res);
-            res = -EBADMSG;
-            continue;
+#endif
+        else {
+            DEBUG("sock_dns: can't receive: %s\n", strerror(-res));
         }
-
-        uint32_t ttl;
-        if ((res = dns_msg_parse_reply(dns_buf, res, family,
-                                       addr_out, &ttl)) > 0) {
+        if (res > 0) {
             dns_cache_add(domain_name, addr_out, res, ttl);
             break;
-        } else {
-            DEBUG("sock_dns: can't parse response\n");
         }
     }
 
@@ -13,15 +13,131 @@
  */
 
 #include <inttypes.h>
+#include <limits.h>
 #include <stdio.h>
+#include <string.h>
 
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
+#if defined(CPU_NATIVE) && defined(__SSE2__)
+#include <emmintrin.h>
+#define INET_CSUM_SIMD_SIZE     (16U)
+#elif defined(CPU_NATIVE) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define INET_CSUM_SIMD_SIZE     (16U)
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* As len of inet_csum_slice() is at most UINT16_MAX, adding up all of its
+ * words in an accumulator twice their width can't overflow */
+#if UINT_MAX > UINT16_MAX
+typedef uint32_t __attribute__((may_alias)) _word_t;
+typedef uint64_t _acc_t;
+#else
+typedef uint16_t __attribute__((may_alias)) _word_t;
+typedef uint32_t _acc_t;
+#endif
+typedef uint16_t __attribute__((may_alias)) _u16_t;
+
+static uint16_t _fold(_acc_t acc)
+{
+    while (acc >> 16) {
+        acc = (acc & 0xffff) + (acc >> 16);
+    }
+    return acc;
+}
+
+#ifdef INET_CSUM_SIMD_SIZE
+/* sum of the 16-bit words in buf, len must be a multiple of
+ * INET_CSUM_SIMD_SIZE. The 32-bit lanes can't overflow for len <= UINT16_MAX */
+static _acc_t _sum_simd(const uint8_t *buf, size_t len)
+{
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    uint32_t lanes[4];
+
+    for (; len; buf += INET_CSUM_SIMD_SIZE, len -= INET_CSUM_SIMD_SIZE) {
+        __m128i v = _mm_loadu_si128((const __m128i *)buf);
+
+        acc = _mm_add_epi32(acc, _mm_unpacklo_epi16(v, zero));
+        acc = _mm_add_epi32(acc, _mm_unpackhi_epi16(v, zero));
+    }
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    return (_acc_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#else /* __ARM_NEON */
+    uint32x4_t acc = vdupq_n_u32(0);
+
+    for (; len; buf += INET_CSUM_SIMD_SIZE, len -= INET_CSUM_SIMD_SIZE) {
+        acc = vpadalq_u16(acc, vld1q_u16((const uint16_t *)buf));
+    }
+    uint64x2_t sum = vpaddlq_u32(acc);
+    return vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1);
+#endif
+}
+#endif
+
+/* one's complement sum of buf read as 16-bit words in host byte order, a
+ * trailing odd byte is padded with a zero byte */
+static uint16_t _sum_host(const uint8_t *buf, size_t len)
+{
+    _acc_t acc = 0;
+
+    if ((len > 0) && ((uintptr_t)buf & 1)) {
+        /* Summing up from the next byte yields the byte swapped sum of the
+         * words starting at buf, save for the first byte */
+        uint16_t first = 0;
+
+        memcpy(&first, buf, 1);
+        return _fold((_acc_t)byteorder_swaps(_sum_host(buf + 1, len - 1)) +
+                     first);
+    }
+    if ((sizeof(_word_t) > 2) && (len >= 2) &&
+        ((uintptr_t)buf & (sizeof(_word_t) - 1))) {
+        acc += *(const _u16_t *)buf;
+        buf += 2;
+        len -= 2;
+    }
+
+#ifdef INET_CSUM_SIMD_SIZE
+    size_t simd_len = len & ~(INET_CSUM_SIMD_SIZE - 1);
+
+    acc += _sum_simd(buf, simd_len);
+    buf += simd_len;
+    len -= simd_len;
+#endif
+
+    const _word_t *words = (const _word_t *)buf;
+
+    for (; len >= (4 * sizeof(_word_t)); len -= 4 * sizeof(_word_t)) {
+        acc += (_acc_t)words[0] + words[1] + words[2] + words[3];
+        words += 4;
+    }
+    for (; len >= sizeof(_word_t); len -= sizeof(_word_t)) {
+        acc += *words++;
+    }
+
+    buf = (const uint8_t *)words;
+    if ((sizeof(_word_t) > 2) && (len >= 2)) {
+        acc += *(const _u16_t *)buf;
+        buf += 2;
+        len -= 2;
+    }
+    if (len) {
+        uint16_t last = 0;
+
+        memcpy(&last, buf, 1);
+        acc += last;
+    }
+
+    return _fold(acc);
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -44,21 +160,12 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
-
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
-    }
+    /* the words are summed up in host byte order, the sum in network byte order
+     * is the same with the bytes swapped on little endian platforms */
+    csum += byteorder_htons(_sum_host(buf, len)).u16;
+    csum = _fold(csum);
 
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
@@ -21,11 +21,14 @@
 #include <assert.h>
 #include <errno.h>
 
+#include "container.h"
+#include "macros/utils.h"
 #include "mbox.h"
 #include "msg.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netapi.h"
+#include "tracepoint.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -57,6 +60,7 @@ int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
     /* set the outgoing message's fields */
     msg.type = type;
     msg.content.ptr = (void *)pkt;
+    TRACEPOINT(TRACE_EVENT_NETAPI_SEND, pid, type);
     /* send message */
     int ret = msg_try_send(&msg, pid);
     if (ret < 1) {
@@ -66,6 +70,38 @@ int _gnrc_netapi_send_recv(kernel_pid_t pid, gnrc_pktsnip_t *pkt, uint16_t type)
     return ret;
 }
 
+int _gnrc_netapi_send_recv_bulk(kernel_pid_t pid, gnrc_pktsnip_t **pkts,
+                                unsigned num, uint16_t type)
+{
+    msg_t msgs[CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE];
+    unsigned sent = 0;
+
+    while (sent < num) {
+        unsigned batch = MIN(num - sent, ARRAY_SIZE(msgs));
+
+        /* set the outgoing messages' fields */
+        for (unsigned i = 0; i < batch; i++) {
+            msgs[i].type = type;
+            msgs[i].content.ptr = (void *)pkts[sent + i];
+            TRACEPOINT(TRACE_EVENT_NETAPI_SEND, pid, type);
+        }
+        /* send messages */
+        int ret = msg_try_send_bulk(msgs, batch, pid);
+        if (ret < 0) {
+            DEBUG("gnrc_netapi: dropped messages to %" PRIkernel_pid
+                  " (invalid receiver)\n", pid);
+            return ret;
+        }
+        sent += ret;
+        if ((unsigned)ret < batch) {
+            DEBUG("gnrc_netapi: dropped %u messages to %" PRIkernel_pid
+                  " (receiver queue is full)\n", num - sent, pid);
+            break;
+        }
+    }
+    return sent;
+}
+
 #ifdef MODULE_GNRC_NETAPI_MBOX
 static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt)
 {
@@ -85,6 +121,7 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
+    TRACEPOINT(TRACE_EVENT_NETAPI_DISPATCH, type, demux_ctx);
     gnrc_netreg_acquire_shared();
 
     int numof = gnrc_netreg_num(type, demux_ctx);
@@ -1691,7 +1691,16 @@ static void _send(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt, bool push_back);
 static void _event_handler_isr(event_t *evp)
 {
     gnrc_netif_t *netif = container_of(evp, gnrc_netif_t, event_isr);
+#ifdef MODULE_NETSTATS_L2
+    uint32_t rx_count = netif->stats.rx_count;
+#endif
+
     netif->dev->driver->isr(netif->dev);
+#ifdef MODULE_NETSTATS_L2
+    if (netif->stats.rx_count != rx_count) {
+        netif->stats.rx_wakeups++;
+    }
+#endif
 }
 
 static void _process_receive_stats(gnrc_netif_t *netdev, gnrc_pktsnip_t *pkt)
@@ -21,6 +21,15 @@
 #include "net/ipv6/hdr.h"
 #endif
 
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_IPHC)
+#include "net/gnrc/sixlowpan/config.h"
+
+/* headroom in front of received frames for in-place IPHC decompression */
+#define RX_HEADROOM     (CONFIG_GNRC_SIXLOWPAN_IPHC_RX_HEADROOM)
+#else
+#define RX_HEADROOM     (0U)
+#endif
+
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
@@ -98,16 +107,21 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
     int bytes_expected = dev->driver->recv(dev, NULL, 0, NULL);
 
     if (bytes_expected >= (int)IEEE802154_MIN_FRAME_LEN) {
+        /* raw mode passes the frame as is, so no headroom in front of it */
+        size_t headroom = (netif->flags & GNRC_NETIF_FLAGS_RAWMODE) ? 0 : RX_HEADROOM;
+        uint8_t *frame;
         int nread;
 
-        pkt = gnrc_pktbuf_add(NULL, NULL, bytes_expected, GNRC_NETTYPE_UNDEF);
+        pkt = gnrc_pktbuf_add(NULL, NULL, headroom + bytes_expected,
+                              GNRC_NETTYPE_UNDEF);
         if (pkt == NULL) {
             DEBUG("_recv_ieee802154: cannot allocate pktsnip.\n");
             /* Discard packet on netdev device */
             dev->driver->recv(dev, NULL, bytes_expected, NULL);
             return NULL;
         }
-        nread = dev->driver->recv(dev, pkt->data, bytes_expected, &rx_info);
+        frame = (uint8_t *)pkt->data + headroom;
+        nread = dev->driver->recv(dev, frame, bytes_expected, &rx_info);
         if (nread <= 0) {
             gnrc_pktbuf_release(pkt);
             return NULL;
@@ -141,8 +155,9 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
             /* Normal mode, try to parse the frame according to IEEE 802.15.4 */
             gnrc_pktsnip_t *ieee802154_hdr, *netif_hdr;
             gnrc_netif_hdr_t *hdr;
-            size_t mhr_len = ieee802154_get_frame_hdr_len(pkt->data);
-            uint8_t *mhr = pkt->data;
+            size_t mhr_len = ieee802154_get_frame_hdr_len(frame);
+            uint8_t *mhr = frame;
+            bool keep_headroom = false;
             /* nread was checked for <= 0 before so we can safely cast it to
              * unsigned */
             if ((mhr_len == 0) || ((size_t)nread < mhr_len)) {
@@ -222,19 +237,33 @@ static gnrc_pktsnip_t *_recv(gnrc_netif_t *netif)
                                             src_str),
                     nread);
                 if (IS_USED(MODULE_OD)) {
-                    od_hex_dump(pkt->data, nread, OD_WIDTH_DEFAULT);
+                    od_hex_dump(frame, nread, OD_WIDTH_DEFAULT);
                 }
             }
-            /* mark IEEE 802.15.4 header */
-            ieee802154_hdr = gnrc_pktbuf_mark(pkt, mhr_len, GNRC_NETTYPE_UNDEF);
+#ifdef MODULE_GNRC_SIXLOWPAN
+            /* only 6LoWPAN makes use of the headroom */
+            keep_headroom = (headroom > 0) && (pkt->type == GNRC_NETTYPE_SIXLOWPAN) &&
+                            ((size_t)nread > mhr_len);
+#endif
+            /* mark IEEE 802.15.4 header, with headroom it is kept in front of
+             * the payload to be reused for IPHC decompression */
+            if (keep_headroom) {
+                ieee802154_hdr = gnrc_pktbuf_mark_headroom(pkt, headroom + mhr_len);
+            }
+            else {
+                ieee802154_hdr = gnrc_pktbuf_mark(pkt, headroom + mhr_len,
+                                                  GNRC_NETTYPE_UNDEF);
+            }
             if (ieee802154_hdr == NULL) {
                 DEBUG("_recv_ieee802154: no space left in packet buffer\n");
                 gnrc_pktbuf_release(pkt);
                 gnrc_pktbuf_release(netif_hdr);
                 return NULL;
             }
-            nread -= ieee802154_hdr->size;
-            gnrc_pktbuf_remove_snip(pkt, ieee802154_hdr);
+            nread -= mhr_len;
+            if (!keep_headroom) {
+                gnrc_pktbuf_remove_snip(pkt, ieee802154_hdr);
+            }
             pkt = gnrc_pkt_append(pkt, netif_hdr);
         }
 
@@ -31,8 +31,16 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
-/* The registry as lookup table by gnrc_nettype_t */
-static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
+static_assert((CONFIG_GNRC_NETREG_DEMUX_BUCKETS &
+               (CONFIG_GNRC_NETREG_DEMUX_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_NETREG_DEMUX_BUCKETS must be a power of 2");
+
+/* The registry as lookup table by gnrc_nettype_t, hashed by demux_ctx.
+ * All entries with the same demux_ctx are in the same list, so
+ * gnrc_netreg_getnext() only needs to follow the list of the given entry. */
+static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF][CONFIG_GNRC_NETREG_DEMUX_BUCKETS];
+/* Entries with GNRC_NETREG_DEMUX_CTX_ALL, by gnrc_nettype_t */
+static gnrc_netreg_entry_t *netreg_all[GNRC_NETTYPE_NUMOF];
 
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
@@ -63,7 +71,25 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
+    memset(netreg_all, 0, sizeof(netreg_all));
+}
+
+/**
+ * @brief   Get the list holding the entries of @p type with @p demux_ctx
+ */
+static gnrc_netreg_entry_t **_list(gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    if (demux_ctx == GNRC_NETREG_DEMUX_CTX_ALL) {
+        return &netreg_all[type];
+    }
+
+    /* fold all bits in, demux contexts are mostly small numbers like ports
+     * or next header numbers */
+    uint32_t hash = demux_ctx ^ (demux_ctx >> 16);
+    hash ^= hash >> 8;
+
+    return &netreg[type][hash & (CONFIG_GNRC_NETREG_DEMUX_BUCKETS - 1)];
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -153,13 +179,15 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
 
     _gnrc_netreg_acquire_exclusive();
 
+    gnrc_netreg_entry_t **list = _list(type, entry->demux_ctx);
+
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*list, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*list, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +200,12 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    gnrc_netreg_entry_t **list = _list(type, entry->demux_ctx);
+    /* LL_DELETE() can't cope with an empty list, which is what an entry that
+     * was never registered may map to */
+    if (*list != NULL) {
+        LL_DELETE(*list, entry);
+    }
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -214,7 +247,7 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     gnrc_netreg_entry_t *res = NULL;
 
     if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
+        gnrc_netreg_entry_t *head = (from) ? from->next : *_list(type, demux_ctx);
         LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
     }
 
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc_ipv6_fwd_cache
+ * @{
+ *
+ * @file
+ * @brief       IPv6 forwarding cache
+ *
+ * Entries are only written by the IPv6 thread. The NIB invalidates them from
+ * any thread by advancing the generation of the cache, entries of an older
+ * generation are free.
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "atomic_utils.h"
+#include "irq.h"
+#include "macros/utils.h"
+#include "net/gnrc/ipv6/fwd_cache.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+static gnrc_ipv6_fwd_cache_entry_t _entries[CONFIG_GNRC_IPV6_FWD_CACHE_SIZE];
+static gnrc_ipv6_fwd_cache_stats_t _stats;
+/* starts at 1 so the zeroed entries are free */
+static volatile uint32_t _generation = 1;
+static uint32_t _uses;
+
+static inline bool _is_valid(const gnrc_ipv6_fwd_cache_entry_t *entry,
+                             uint32_t generation)
+{
+    return (entry->generation == generation) &&
+           (entry->in_iface != KERNEL_PID_UNDEF);
+}
+
+const gnrc_ipv6_fwd_cache_entry_t *gnrc_ipv6_fwd_cache_get(const ipv6_addr_t *dst,
+                                                           kernel_pid_t in_iface)
+{
+    uint32_t generation = atomic_load_u32(&_generation);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_entries); i++) {
+        gnrc_ipv6_fwd_cache_entry_t *entry = &_entries[i];
+
+        if (_is_valid(entry, generation) && (entry->in_iface == in_iface) &&
+            ipv6_addr_equal(&entry->dst, dst)) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+void gnrc_ipv6_fwd_cache_hit(const gnrc_ipv6_fwd_cache_entry_t *entry)
+{
+    _entries[entry - _entries].last_use = ++_uses;
+    _stats.hits++;
+}
+
+uint32_t gnrc_ipv6_fwd_cache_generation(void)
+{
+    return atomic_load_u32(&_generation);
+}
+
+void gnrc_ipv6_fwd_cache_add(const ipv6_addr_t *dst, kernel_pid_t in_iface,
+                             const gnrc_ipv6_nib_nc_t *nce, uint32_t generation)
+{
+    _stats.misses++;
+    switch (gnrc_ipv6_nib_nc_get_nud_state(nce)) {
+    case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE:
+    case GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED:
+        break;
+    default:
+        /* the NIB still has to confirm this next hop */
+        return;
+    }
+    if (generation != atomic_load_u32(&_generation)) {
+        DEBUG("ipv6_fwd_cache: NIB changed while resolving the next hop\n");
+        return;
+    }
+
+    /* replace the same flow, a free entry or the least recently used one */
+    gnrc_ipv6_fwd_cache_entry_t *entry = &_entries[0];
+    for (unsigned i = 0; i < ARRAY_SIZE(_entries); i++) {
+        gnrc_ipv6_fwd_cache_entry_t *tmp = &_entries[i];
+
+        if (!_is_valid(tmp, generation)) {
+            entry = tmp;
+            continue;
+        }
+        if ((tmp->in_iface == in_iface) && ipv6_addr_equal(&tmp->dst, dst)) {
+            entry = tmp;
+            break;
+        }
+        if (_is_valid(entry, generation) && (tmp->last_use < entry->last_use)) {
+            entry = tmp;
+        }
+    }
+
+    entry->dst = *dst;
+    entry->generation = generation;
+    entry->last_use = ++_uses;
+    entry->in_iface = in_iface;
+    entry->iface = gnrc_ipv6_nib_nc_get_iface(nce);
+    entry->l2addr_len = nce->l2addr_len;
+    memcpy(entry->l2addr, nce->l2addr, nce->l2addr_len);
+}
+
+void gnrc_ipv6_fwd_cache_invalidate(void)
+{
+    atomic_fetch_add_u32(&_generation, 1);
+    _stats.invalidations++;
+}
+
+void gnrc_ipv6_fwd_cache_stats_get(gnrc_ipv6_fwd_cache_stats_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = _stats;
+    irq_restore(state);
+}
@@ -18,6 +18,7 @@
 #include <stdbool.h>
 
 #include "byteorder.h"
+#include "container.h"
 #include "cpu_conf.h"
 #include "sched.h"
 #include "net/gnrc.h"
@@ -28,6 +29,7 @@
 #include "thread.h"
 #include "utlist.h"
 
+#include "net/gnrc/ipv6/fwd_cache.h"
 #include "net/gnrc/ipv6/nib.h"
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/ipv6/whitelist.h"
@@ -72,8 +74,10 @@ kernel_pid_t gnrc_ipv6_pid = KERNEL_PID_UNDEF;
 static void _receive(gnrc_pktsnip_t *pkt);
 /* Sends packet over the appropriate interface(s).
  * prep_hdr: prepare header for sending (call to _fill_ipv6_hdr()), otherwise
- * assume it is already prepared */
-static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr);
+ * assume it is already prepared
+ * fwd_iface: interface a forwarded packet was received on, KERNEL_PID_UNDEF
+ * otherwise */
+static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr, kernel_pid_t fwd_iface);
 
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt);
@@ -171,9 +175,72 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
     }
 }
 
+static void _handle_msg(msg_t *msg, msg_t *reply)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+            _receive(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+            _send(msg->content.ptr, true, KERNEL_PID_UNDEF);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_GET:
+        case GNRC_NETAPI_MSG_TYPE_SET:
+            DEBUG("ipv6: reply to unsupported get/set\n");
+            reply->content.value = -ENOTSUP;
+            msg_reply(msg, reply);
+            break;
+
+#ifdef MODULE_GNRC_IPV6_EXT_FRAG
+        case GNRC_IPV6_EXT_FRAG_RBUF_GC:
+            gnrc_ipv6_ext_frag_rbuf_gc();
+            break;
+        case GNRC_IPV6_EXT_FRAG_CONTINUE:
+            DEBUG("ipv6: continue fragmenting packet\n");
+            gnrc_ipv6_ext_frag_send(msg->content.ptr);
+            break;
+        case GNRC_IPV6_EXT_FRAG_SEND:
+            DEBUG("ipv6: send fragment\n");
+            _send_by_netif_hdr(msg->content.ptr);
+            break;
+#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
+        case GNRC_IPV6_NIB_SND_UC_NS:
+        case GNRC_IPV6_NIB_SND_MC_NS:
+        case GNRC_IPV6_NIB_SND_NA:
+        case GNRC_IPV6_NIB_SEARCH_RTR:
+        case GNRC_IPV6_NIB_REPLY_RS:
+        case GNRC_IPV6_NIB_SND_MC_RA:
+        case GNRC_IPV6_NIB_REACH_TIMEOUT:
+        case GNRC_IPV6_NIB_DELAY_TIMEOUT:
+        case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
+        case GNRC_IPV6_NIB_ABR_TIMEOUT:
+        case GNRC_IPV6_NIB_PFX_TIMEOUT:
+        case GNRC_IPV6_NIB_RTR_TIMEOUT:
+        case GNRC_IPV6_NIB_RECALC_REACH_TIME:
+        case GNRC_IPV6_NIB_REREG_ADDRESS:
+        case GNRC_IPV6_NIB_DAD:
+        case GNRC_IPV6_NIB_VALID_ADDR:
+            DEBUG("ipv6: NIB timer event received\n");
+            gnrc_ipv6_nib_handle_timer_event(msg->content.ptr, msg->type);
+            break;
+        case GNRC_IPV6_NIB_IFACE_UP:
+            gnrc_ipv6_nib_iface_up(msg->content.ptr);
+            break;
+        case GNRC_IPV6_NIB_IFACE_DOWN:
+            gnrc_ipv6_nib_iface_down(msg->content.ptr, false);
+            break;
+        default:
+            break;
+    }
+}
+
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply;
+    msg_t msgs[CONFIG_GNRC_NETAPI_MSG_BATCH_SIZE], reply;
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             thread_getpid());
 
@@ -193,66 +260,10 @@ static void *_event_loop(void *args)
     /* start event loop */
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
-        msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr, true);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("ipv6: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
+        int num = msg_receive_bulk(msgs, ARRAY_SIZE(msgs));
 
-#ifdef MODULE_GNRC_IPV6_EXT_FRAG
-            case GNRC_IPV6_EXT_FRAG_RBUF_GC:
-                gnrc_ipv6_ext_frag_rbuf_gc();
-                break;
-            case GNRC_IPV6_EXT_FRAG_CONTINUE:
-                DEBUG("ipv6: continue fragmenting packet\n");
-                gnrc_ipv6_ext_frag_send(msg.content.ptr);
-                break;
-            case GNRC_IPV6_EXT_FRAG_SEND:
-                DEBUG("ipv6: send fragment\n");
-                _send_by_netif_hdr(msg.content.ptr);
-                break;
-#endif  /* MODULE_GNRC_IPV6_EXT_FRAG */
-            case GNRC_IPV6_NIB_SND_UC_NS:
-            case GNRC_IPV6_NIB_SND_MC_NS:
-            case GNRC_IPV6_NIB_SND_NA:
-            case GNRC_IPV6_NIB_SEARCH_RTR:
-            case GNRC_IPV6_NIB_REPLY_RS:
-            case GNRC_IPV6_NIB_SND_MC_RA:
-            case GNRC_IPV6_NIB_REACH_TIMEOUT:
-            case GNRC_IPV6_NIB_DELAY_TIMEOUT:
-            case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
-            case GNRC_IPV6_NIB_ABR_TIMEOUT:
-            case GNRC_IPV6_NIB_PFX_TIMEOUT:
-            case GNRC_IPV6_NIB_RTR_TIMEOUT:
-            case GNRC_IPV6_NIB_RECALC_REACH_TIME:
-            case GNRC_IPV6_NIB_REREG_ADDRESS:
-            case GNRC_IPV6_NIB_DAD:
-            case GNRC_IPV6_NIB_VALID_ADDR:
-                DEBUG("ipv6: NIB timer event received\n");
-                gnrc_ipv6_nib_handle_timer_event(msg.content.ptr, msg.type);
-                break;
-            case GNRC_IPV6_NIB_IFACE_UP:
-                gnrc_ipv6_nib_iface_up(msg.content.ptr);
-                break;
-            case GNRC_IPV6_NIB_IFACE_DOWN:
-                gnrc_ipv6_nib_iface_down(msg.content.ptr, false);
-                break;
-            default:
-                break;
+        for (int i = 0; i < num; i++) {
+            _handle_msg(&msgs[i], &reply);
         }
     }
 
@@ -492,11 +503,14 @@ static void _send_by_netif_hdr(gnrc_pktsnip_t *pkt)
 
 static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
                           gnrc_netif_t *netif, ipv6_hdr_t *ipv6_hdr,
-                          uint8_t netif_hdr_flags)
+                          uint8_t netif_hdr_flags, kernel_pid_t fwd_iface)
 {
     gnrc_ipv6_nib_nc_t nce;
 
     DEBUG("ipv6: send unicast\n");
+#ifdef MODULE_GNRC_IPV6_FWD_CACHE
+    uint32_t generation = gnrc_ipv6_fwd_cache_generation();
+#endif
     if (gnrc_ipv6_nib_get_next_hop_l2addr(&ipv6_hdr->dst, netif, pkt,
                                           &nce) < 0) {
         /* packet is released by NIB */
@@ -504,6 +518,13 @@ static void _send_unicast(gnrc_pktsnip_t *pkt, bool prep_hdr,
               ipv6_addr_to_str(addr_str, &ipv6_hdr->dst, sizeof(addr_str)));
         return;
     }
+#ifdef MODULE_GNRC_IPV6_FWD_CACHE
+    if (fwd_iface != KERNEL_PID_UNDEF) {
+        gnrc_ipv6_fwd_cache_add(&ipv6_hdr->dst, fwd_iface, &nce, generation);
+    }
+#else
+    (void)fwd_iface;
+#endif
     netif = gnrc_netif_get_by_pid(gnrc_ipv6_nib_nc_get_iface(&nce));
     assert(netif != NULL);
     if (_safe_fill_ipv6_hdr(netif, pkt, prep_hdr)) {
@@ -656,7 +677,7 @@ static void _send_to_self(gnrc_pktsnip_t *pkt, bool prep_hdr,
     }
 }
 
-static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
+static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr, kernel_pid_t fwd_iface)
 {
     gnrc_netif_t *netif = NULL;
     gnrc_pktsnip_t *tmp_pkt;
@@ -729,7 +750,8 @@ static void _send(gnrc_pktsnip_t *pkt, bool prep_hdr)
             _send_to_self(pkt, prep_hdr, tmp_netif);
         }
         else {
-            _send_unicast(pkt, prep_hdr, netif, ipv6_hdr, netif_hdr_flags);
+            _send_unicast(pkt, prep_hdr, netif, ipv6_hdr, netif_hdr_flags,
+                          fwd_iface);
         }
     }
 }
@@ -750,6 +772,88 @@ static inline bool _pkt_not_for_me(gnrc_netif_t **netif, ipv6_hdr_t *hdr)
     }
 }
 
+#ifdef MODULE_GNRC_IPV6_ROUTER
+#ifdef MODULE_GNRC_IPV6_FWD_CACHE
+/* sends pkt in receive order to the cached next hop of its flow, reusing the
+ * interface header it was received with */
+static bool _forward_cached(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *netif_hdr,
+                            const ipv6_hdr_t *hdr, kernel_pid_t in_iface)
+{
+    const gnrc_ipv6_fwd_cache_entry_t *entry;
+    gnrc_netif_t *netif;
+
+    if (ipv6_addr_is_multicast(&hdr->dst) ||
+        ((entry = gnrc_ipv6_fwd_cache_get(&hdr->dst, in_iface)) == NULL) ||
+        ((netif = gnrc_netif_get_by_pid(entry->iface)) == NULL)) {
+        return false;
+    }
+    /* received interface header has the source address, if any, too */
+    size_t size = sizeof(gnrc_netif_hdr_t) + entry->l2addr_len;
+    if ((netif_hdr->users > 1) || (netif_hdr->size < size) ||
+        (gnrc_pktbuf_realloc_data(netif_hdr, size) != 0)) {
+        DEBUG("ipv6: can't reuse interface header of forwarded packet\n");
+        return false;
+    }
+
+    pkt = gnrc_pkt_delete(pkt, netif_hdr);
+    netif_hdr->next = NULL;
+    if ((pkt = gnrc_pktbuf_reverse_snips(pkt)) == NULL) {
+        DEBUG("ipv6: unable to reverse pkt from receive order to send "
+              "order; dropping it\n");
+        gnrc_pktbuf_release(netif_hdr);
+        return true;
+    }
+
+    gnrc_netif_hdr_t *netif_hdr_data = netif_hdr->data;
+    gnrc_netif_hdr_init(netif_hdr_data, 0, entry->l2addr_len);
+    gnrc_netif_hdr_set_dst_addr(netif_hdr_data, entry->l2addr,
+                                entry->l2addr_len);
+    pkt = gnrc_pkt_prepend(pkt, netif_hdr);
+
+    DEBUG("ipv6: forward over interface %" PRIkernel_pid " by cache\n",
+          netif->pid);
+#ifdef MODULE_NETSTATS_IPV6
+    /* This is read from the netif thread. To prevent data corruptions, we
+     * have to guarantee mutually exclusive access */
+    unsigned irq_state = irq_disable();
+    netif->ipv6.stats.tx_unicast_count++;
+    irq_restore(irq_state);
+#endif
+    gnrc_ipv6_fwd_cache_hit(entry);
+    _send_to_iface(netif, pkt);
+    return true;
+}
+#endif  /* MODULE_GNRC_IPV6_FWD_CACHE */
+
+/* forwards pkt in receive order */
+static void _forward(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *netif_hdr,
+                     const ipv6_hdr_t *hdr)
+{
+    kernel_pid_t in_iface = KERNEL_PID_UNDEF;
+
+    /* remove L2 headers around IPV6 */
+    if (netif_hdr != NULL) {
+        in_iface = ((gnrc_netif_hdr_t *)netif_hdr->data)->if_pid;
+#ifdef MODULE_GNRC_IPV6_FWD_CACHE
+        if (_forward_cached(pkt, netif_hdr, hdr, in_iface)) {
+            return;
+        }
+#else
+        (void)hdr;
+#endif
+        gnrc_pktbuf_remove_snip(pkt, netif_hdr);
+    }
+    pkt = gnrc_pktbuf_reverse_snips(pkt);
+    if (pkt != NULL) {
+        _send(pkt, false, in_iface);
+    }
+    else {
+        DEBUG("ipv6: unable to reverse pkt from receive order to send "
+              "order; dropping it\n");
+    }
+}
+#endif  /* MODULE_GNRC_IPV6_ROUTER */
+
 static void _receive(gnrc_pktsnip_t *pkt)
 {
     gnrc_netif_t *netif = NULL;
@@ -894,19 +998,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
         /* TODO: check if receiving interface is router */
         else if (--(hdr->hl) > 0) {  /* drop packets that *reach* Hop Limit 0 */
             DEBUG("ipv6: forward packet to next hop\n");
-
-            /* remove L2 headers around IPV6 */
-            if (netif_hdr != NULL) {
-                gnrc_pktbuf_remove_snip(pkt, netif_hdr);
-            }
-            pkt = gnrc_pktbuf_reverse_snips(pkt);
-            if (pkt != NULL) {
-                _send(pkt, false);
-            }
-            else {
-                DEBUG("ipv6: unable to reverse pkt from receive order to send "
-                      "order; dropping it\n");
-            }
+            _forward(pkt, netif_hdr, hdr);
             return;
         }
         else {
@@ -51,6 +51,48 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 evtimer_msg_t _nib_evtimer;
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+static_assert((CONFIG_GNRC_IPV6_NIB_INDEX_BUCKETS &
+               (CONFIG_GNRC_IPV6_NIB_INDEX_BUCKETS - 1)) == 0,
+              "CONFIG_GNRC_IPV6_NIB_INDEX_BUCKETS must be a power of 2");
+static_assert(CONFIG_GNRC_IPV6_NIB_NUMOF < UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_NUMOF too large for index");
+static_assert((2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) < UINT16_MAX,
+              "CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF too large for index");
+
+/**
+ * @brief   Node of the off-link entry prefix trie
+ *
+ * Every node but the root either references at least one off-link entry or
+ * has two children, so 2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF nodes always
+ * suffice.
+ */
+typedef struct {
+    ipv6_addr_t pfx;        /**< prefix of the node (bits beyond pfx_len unset) */
+    uint16_t child[2];      /**< index + 1 of the children in _offl_trie */
+    uint16_t dsts;          /**< index + 1 of first entry in _dsts with pfx */
+    uint8_t pfx_len;        /**< length of pfx, 0 marks unused (non-root) nodes */
+} _offl_trie_node_t;
+
+/* All indices below are stored off-by-one so 0 marks the end of a chain and
+ * zero-initialized memory is a valid, empty index. */
+static uint16_t _onl_buckets[CONFIG_GNRC_IPV6_NIB_INDEX_BUCKETS];
+static uint16_t _onl_chain[CONFIG_GNRC_IPV6_NIB_NUMOF];
+static uint16_t _offl_chain[CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+/* _offl_trie[0] is the root representing ::/0 */
+static _offl_trie_node_t _offl_trie[2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+
+static void _onl_index_add(const _nib_onl_entry_t *node);
+static void _offl_index_add(const _nib_offl_entry_t *dst);
+static void _offl_index_remove(const _nib_offl_entry_t *dst);
+static _nib_onl_entry_t *_onl_index_get(const ipv6_addr_t *addr,
+                                        unsigned iface, bool exact);
+#else   /* CONFIG_GNRC_IPV6_NIB_INDEX */
+#define _onl_index_add(node)        (void)node
+#define _offl_index_add(dst)        (void)dst
+#define _offl_index_remove(dst)     (void)dst
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
+
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node);
 static inline bool _node_unreachable(_nib_onl_entry_t *node);
@@ -66,6 +108,12 @@ void _nib_init(void)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+    memset(_onl_buckets, 0, sizeof(_onl_buckets));
+    memset(_onl_chain, 0, sizeof(_onl_chain));
+    memset(_offl_chain, 0, sizeof(_offl_chain));
+    memset(_offl_trie, 0, sizeof(_offl_trie));
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
@@ -98,10 +146,18 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+    if ((node = _onl_index_get(addr, iface, true)) != NULL) {
+        /* exact match */
+        DEBUG("  %p is an exact match\n", (void *)node);
+        return node;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
-        if ((_nib_onl_get_if(tmp) == iface) && _addr_equals(addr, tmp)) {
+        if (!IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX) &&
+            (_nib_onl_get_if(tmp) == iface) && _addr_equals(addr, tmp)) {
             /* exact match */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             node = tmp;
@@ -110,6 +166,10 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
         if ((node == NULL) && (tmp->mode == _EMPTY)) {
             DEBUG("  using %p\n", (void *)node);
             node = tmp;
+            if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+                /* exact matches were already ruled out by the index */
+                break;
+            }
         }
     }
     if (node != NULL) {
@@ -190,6 +250,7 @@ _nib_onl_entry_t *_nib_nc_add(const ipv6_addr_t *addr, unsigned iface,
     DEBUG("nib: Adding to neighbor cache (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
     if (!(node->mode & _NC)) {
+        _nib_changed();
         node->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
         /* masked above already */
         node->info |= cstate;
@@ -223,6 +284,14 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+    _nib_onl_entry_t *node = _onl_index_get(addr, iface, false);
+
+    if (node != NULL) {
+        DEBUG("  Found %p\n", (void *)node);
+        return node;
+    }
+#else   /* CONFIG_GNRC_IPV6_NIB_INDEX */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -236,6 +305,7 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
             return node;
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
     DEBUG("  No suitable entry found\n");
     return NULL;
 }
@@ -245,6 +315,7 @@ void _nib_nc_set_reachable(_nib_onl_entry_t *node)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
     gnrc_netif_t *netif = gnrc_netif_get_by_pid(_nib_onl_get_if(node));
 
+    _nib_changed();
     node->info &= ~GNRC_IPV6_NIB_NC_INFO_NUD_STATE_MASK;
     node->info |= GNRC_IPV6_NIB_NC_INFO_NUD_STATE_REACHABLE;
 #ifdef TEST_SUITES
@@ -334,6 +405,7 @@ _nib_dr_entry_t *_nib_drl_add(const ipv6_addr_t *router_addr, unsigned iface)
 {
     _nib_dr_entry_t *def_router = NULL;
 
+    _nib_changed();
     DEBUG("nib: Allocating default router list entry "
           "(router_addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, router_addr, sizeof(addr_str)), iface);
@@ -480,6 +552,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
 {
     _nib_offl_entry_t *dst = NULL;
 
+    _nib_changed();
     assert((pfx != NULL) && (!ipv6_addr_is_unspecified(pfx)) &&
            (pfx_len > 0) && (pfx_len <= 128));
     DEBUG("nib: Allocating off-link-entry entry "
@@ -510,7 +583,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
                 DEBUG("  %p is an exact match\n", (void *)tmp);
                 if (next_hop != NULL) {
                     /* sets next_hop if it was previously unspecified */
+                    _nib_onl_index_remove(tmp_node);
                     memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                    _onl_index_add(tmp_node);
                 }
                 /*mark that this NCE is used by an offl_entry*/
                 tmp->next_hop->mode |= _DST;
@@ -526,8 +601,10 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         }
         _override_node(next_hop, iface, dst->next_hop);
         dst->next_hop->mode |= _DST;
+        _offl_index_remove(dst);
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _offl_index_add(dst);
     }
     return dst;
 }
@@ -537,12 +614,12 @@ static inline bool _in_dsts(const _nib_offl_entry_t *dst)
     return (dst < (_dsts + CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF));
 }
 
-#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static inline unsigned _idx_dsts(const _nib_offl_entry_t *dst)
 {
     return (dst - _dsts);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static inline bool _in_abrs(const _nib_abr_entry_t *abr)
 {
     return (abr < (_abrs + CONFIG_GNRC_IPV6_NIB_ABR_NUMOF));
@@ -551,6 +628,8 @@ static inline bool _in_abrs(const _nib_abr_entry_t *abr)
 
 void _nib_offl_clear(_nib_offl_entry_t *dst)
 {
+    /* the mode of dst changed */
+    _nib_changed();
     if (dst->mode == _EMPTY) {
         if (dst->next_hop != NULL) {
             _nib_offl_entry_t *ptr;
@@ -566,6 +645,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
                 _nib_onl_clear(dst->next_hop);
             }
         }
+        _offl_index_remove(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
     else {
@@ -601,6 +681,11 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+    (void)best_match;
+    res = _nib_offl_index_get_match(dst);
+    DEBUG("nib: best match %p\n", (void *)res);
+#else   /* CONFIG_GNRC_IPV6_NIB_INDEX */
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -620,6 +705,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
             }
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
     return res;
 }
 
@@ -878,11 +964,14 @@ _nib_offl_entry_t *_nib_pl_add(unsigned iface,
 static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
+    /* node might not be cleared below, but its key changes in any case */
+    _nib_onl_index_remove(node);
     _nib_onl_clear(node);
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+    _onl_index_add(node);
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
@@ -897,6 +986,234 @@ static inline bool _node_unreachable(_nib_onl_entry_t *node)
     }
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+static unsigned _onl_bucket(const ipv6_addr_t *addr)
+{
+    /* the interface is not part of the key, since lookups may use 0 as a
+     * wildcard */
+    uint32_t h = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                 addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    /* mix, so (mostly sequential) interface identifiers spread evenly */
+    h ^= h >> 16;
+    h *= 0x45d9f3bU;
+    h ^= h >> 16;
+    return h & (CONFIG_GNRC_IPV6_NIB_INDEX_BUCKETS - 1);
+}
+
+static void _onl_index_add(const _nib_onl_entry_t *node)
+{
+    unsigned idx = node - _nodes;
+    unsigned bucket = _onl_bucket(&node->ipv6);
+
+    _onl_chain[idx] = _onl_buckets[bucket];
+    _onl_buckets[bucket] = idx + 1;
+}
+
+void _nib_onl_index_remove(const _nib_onl_entry_t *node)
+{
+    unsigned idx = node - _nodes;
+    uint16_t *link = &_onl_buckets[_onl_bucket(&node->ipv6)];
+
+    while (*link != 0) {
+        if ((unsigned)(*link - 1) == idx) {
+            *link = _onl_chain[idx];
+            _onl_chain[idx] = 0;
+            return;
+        }
+        link = &_onl_chain[*link - 1];
+    }
+}
+
+static _nib_onl_entry_t *_onl_index_get(const ipv6_addr_t *addr,
+                                        unsigned iface, bool exact)
+{
+    const ipv6_addr_t *key = (addr == NULL) ? &ipv6_addr_unspecified : addr;
+    _nib_onl_entry_t *res = NULL;
+
+    for (uint16_t i = _onl_buckets[_onl_bucket(key)]; i != 0;
+         i = _onl_chain[i - 1]) {
+        _nib_onl_entry_t *node = &_nodes[i - 1];
+        unsigned node_iface = _nib_onl_get_if(node);
+
+        /* keep lowest array position to behave like a linear search */
+        if (((res != NULL) && (node > res)) ||
+            !ipv6_addr_equal(key, &node->ipv6)) {
+            continue;
+        }
+        if (exact) {
+            if (node_iface == iface) {
+                res = node;
+            }
+        }
+        else if ((node->mode != _EMPTY) &&
+                 /* either requested or current interface undefined or
+                  * interfaces equal */
+                 ((node_iface == 0) || (iface == 0) || (node_iface == iface))) {
+            res = node;
+        }
+    }
+    return res;
+}
+
+static inline unsigned _pfx_bit(const ipv6_addr_t *pfx, unsigned pos)
+{
+    return (pfx->u8[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+static uint16_t _offl_trie_alloc(const ipv6_addr_t *pfx, unsigned pfx_len)
+{
+    assert(pfx_len > 0);
+    /* skip root */
+    for (unsigned i = 1; i < ARRAY_SIZE(_offl_trie); i++) {
+        _offl_trie_node_t *node = &_offl_trie[i];
+
+        if (node->pfx_len == 0) {
+            memset(node, 0, sizeof(*node));
+            ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+            node->pfx_len = pfx_len;
+            return i + 1;
+        }
+    }
+    /* can't happen, see _offl_trie_node_t */
+    assert(false);
+    return 0;
+}
+
+static void _offl_index_add(const _nib_offl_entry_t *dst)
+{
+    _offl_trie_node_t *node = &_offl_trie[0];
+    const ipv6_addr_t *pfx = &dst->pfx;
+    unsigned pfx_len = dst->pfx_len;
+
+    assert(pfx_len > 0);
+    while (node->pfx_len < pfx_len) {
+        uint16_t *link = &node->child[_pfx_bit(pfx, node->pfx_len)];
+        _offl_trie_node_t *child;
+        unsigned common;
+
+        if (*link == 0) {
+            *link = _offl_trie_alloc(pfx, pfx_len);
+            node = &_offl_trie[*link - 1];
+            break;
+        }
+        child = &_offl_trie[*link - 1];
+        common = ipv6_addr_match_prefix(&child->pfx, pfx);
+        common = (common > child->pfx_len) ? child->pfx_len : common;
+        common = (common > pfx_len) ? pfx_len : common;
+        if (common == child->pfx_len) {
+            node = child;
+            continue;
+        }
+        /* pfx diverges from or is a prefix of child->pfx => insert node that
+         * branches at the first differing bit */
+        uint16_t split = _offl_trie_alloc(pfx, common);
+
+        _offl_trie[split - 1].child[_pfx_bit(&child->pfx, common)] = *link;
+        *link = split;
+        node = &_offl_trie[split - 1];
+        if (common < pfx_len) {
+            link = &node->child[_pfx_bit(pfx, common)];
+            *link = _offl_trie_alloc(pfx, pfx_len);
+            node = &_offl_trie[*link - 1];
+        }
+        break;
+    }
+    _offl_chain[_idx_dsts(dst)] = node->dsts;
+    node->dsts = _idx_dsts(dst) + 1;
+}
+
+static void _offl_index_remove(const _nib_offl_entry_t *dst)
+{
+    unsigned idx = _idx_dsts(dst);
+    uint16_t *parent_link = NULL, *link = NULL;
+    _offl_trie_node_t *parent = NULL, *node = &_offl_trie[0];
+
+    if (dst->pfx_len == 0) {
+        /* was never indexed */
+        return;
+    }
+    while (node->pfx_len < dst->pfx_len) {
+        parent_link = link;
+        parent = node;
+        link = &node->child[_pfx_bit(&dst->pfx, node->pfx_len)];
+        if ((*link == 0) ||
+            (ipv6_addr_match_prefix(&_offl_trie[*link - 1].pfx,
+                                    &dst->pfx) <
+             _offl_trie[*link - 1].pfx_len)) {
+            return;
+        }
+        node = &_offl_trie[*link - 1];
+    }
+    if (node->pfx_len != dst->pfx_len) {
+        return;
+    }
+    for (uint16_t *entry = &node->dsts; *entry != 0;
+         entry = &_offl_chain[*entry - 1]) {
+        if ((unsigned)(*entry - 1) == idx) {
+            *entry = _offl_chain[idx];
+            _offl_chain[idx] = 0;
+            break;
+        }
+    }
+    /* node is not the root, since dst->pfx_len > 0 */
+    if (node->dsts != 0) {
+        return;
+    }
+    if ((node->child[0] != 0) && (node->child[1] != 0)) {
+        /* still needed for branching */
+        return;
+    }
+    /* replace node by its only child (if any) */
+    *link = node->child[0] | node->child[1];
+    node->pfx_len = 0;
+    if ((parent_link != NULL) && (parent->dsts == 0) &&
+        ((parent->child[0] == 0) || (parent->child[1] == 0))) {
+        /* parent was only needed for branching to node */
+        *parent_link = parent->child[0] | parent->child[1];
+        parent->pfx_len = 0;
+    }
+}
+
+_nib_offl_entry_t *_nib_offl_index_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    const _offl_trie_node_t *node = &_offl_trie[0];
+
+    assert(dst != NULL);
+    while (node->pfx_len < IPV6_ADDR_BIT_LEN) {
+        uint16_t link = node->child[_pfx_bit(dst, node->pfx_len)];
+        _nib_offl_entry_t *match = NULL;
+
+        if (link == 0) {
+            break;
+        }
+        node = &_offl_trie[link - 1];
+        if (ipv6_addr_match_prefix(&node->pfx, dst) < node->pfx_len) {
+            break;
+        }
+        for (uint16_t i = node->dsts; i != 0; i = _offl_chain[i - 1]) {
+            _nib_offl_entry_t *entry = &_dsts[i - 1];
+
+            /* keep lowest array position to behave like a linear search */
+            if ((entry->mode != _EMPTY) &&
+                ((match == NULL) || (entry < match))) {
+                match = entry;
+            }
+        }
+        if (match != NULL) {
+            res = match;
+        }
+    }
+    return res;
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_INDEX */
+void _nib_onl_index_remove(const _nib_onl_entry_t *node)
+{
+    (void)node;
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
+
 uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
 {
     evtimer_msg_event_t *event = (evtimer_msg_event_t *)_nib_evtimer.events;
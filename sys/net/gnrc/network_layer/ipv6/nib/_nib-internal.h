@@ -34,6 +34,9 @@
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
 #endif
+#ifdef MODULE_GNRC_IPV6_FWD_CACHE
+#include "net/gnrc/ipv6/fwd_cache.h"
+#endif
 #include "net/gnrc/ipv6/nib/ft.h"
 #include "net/gnrc/ipv6/nib/nc.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -359,6 +362,29 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+/**
+ * @brief   Removes an on-link entry from the on-link entry index
+ *
+ * @note    Only does something with @ref CONFIG_GNRC_IPV6_NIB_INDEX != 0.
+ *          Must be called before the address or interface of @p node changes.
+ *
+ * @param[in] node  An entry. May not be in the index.
+ */
+void _nib_onl_index_remove(const _nib_onl_entry_t *node);
+
+/**
+ * @brief   Signals a change of the NIB that may affect the next hop of a
+ *          destination
+ *
+ * @note    Must be called with the NIB acquired.
+ */
+static inline void _nib_changed(void)
+{
+#ifdef MODULE_GNRC_IPV6_FWD_CACHE
+    gnrc_ipv6_fwd_cache_invalidate();
+#endif
+}
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -369,7 +395,12 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
  */
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
+    /* the mode of node changed */
+    _nib_changed();
     if (node->mode == _EMPTY) {
+        if (IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)) {
+            _nib_onl_index_remove(node);
+        }
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -603,6 +634,23 @@ void _nib_offl_clear(_nib_offl_entry_t *dst);
  */
 _nib_offl_entry_t *_nib_offl_iter(const _nib_offl_entry_t *last);
 
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *          from the off-link entry index
+ *
+ * @pre     `(dst != NULL) && (CONFIG_GNRC_IPV6_NIB_INDEX != 0)`
+ *
+ * On equal prefix length the entry that comes first in the off-link entry
+ * array is preferred, which mirrors the behavior of iterating with
+ * @ref _nib_offl_iter().
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @return  The off-link entry with the longest prefix matching @p dst.
+ * @return  NULL, if no off-link entry matches @p dst.
+ */
+_nib_offl_entry_t *_nib_offl_index_get_match(const ipv6_addr_t *dst);
+
 /**
  * @brief   Checks if @p entry was allocated using _nib_offl_alloc()
  *
@@ -269,12 +269,17 @@ static bool _on_link(const ipv6_addr_t *dst, unsigned *iface)
         return true;
     }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX)
+    (void)entry;
+    match = _nib_offl_index_get_match(dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_INDEX */
     while ((entry = _nib_offl_iter(entry))) {
         if ((ipv6_addr_match_prefix(dst, &entry->pfx) >= entry->pfx_len) &&
             ((match == NULL) || (entry->pfx_len > match->pfx_len))) {
             match = entry;
         }
     }
+#endif  /* CONFIG_GNRC_IPV6_NIB_INDEX */
 
     if (match) {
         *iface = _nib_onl_get_if(match->next_hop);
@@ -40,6 +40,7 @@ int gnrc_ipv6_nib_nc_set(const ipv6_addr_t *ipv6, unsigned iface,
         return -ENOMEM;
     }
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
+    _nib_changed();
     if ((l2addr != NULL) && (l2addr_len > 0)) {
         memcpy(node->l2addr, l2addr, l2addr_len);
     }
@@ -167,6 +167,19 @@ void gnrc_sixlowpan_multiplex_by_size(gnrc_pktsnip_t *pkt,
     }
 }
 
+/* removes the headroom the interface reserved in front of the frame, only
+ * IPHC decompression of unfragmented datagrams uses it, see
+ * CONFIG_GNRC_SIXLOWPAN_IPHC_RX_HEADROOM */
+static gnrc_pktsnip_t *_remove_headroom(gnrc_pktsnip_t *pkt,
+                                        gnrc_pktsnip_t *payload)
+{
+    if ((CONFIG_GNRC_SIXLOWPAN_IPHC_RX_HEADROOM > 0) &&
+        (payload->next != NULL) && (payload->next->type == GNRC_NETTYPE_UNDEF)) {
+        pkt = gnrc_pktbuf_remove_snip(pkt, payload->next);
+    }
+    return pkt;
+}
+
 static void _receive(gnrc_pktsnip_t *pkt)
 {
     gnrc_pktsnip_t *payload;
@@ -211,6 +224,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
             return;
         }
 
+        pkt = _remove_headroom(pkt, payload);
         /* packet is uncompressed: just mark and remove the dispatch */
         sixlowpan = gnrc_pktbuf_mark(payload, sizeof(uint8_t), GNRC_NETTYPE_SIXLOWPAN);
 
@@ -232,6 +246,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG
     else if (sixlowpan_frag_is((sixlowpan_frag_t *)dispatch)) {
         DEBUG("6lo: received 6LoWPAN fragment\n");
+        pkt = _remove_headroom(pkt, payload);
         gnrc_sixlowpan_frag_recv(pkt, NULL, 0);
         return;
     }
@@ -239,6 +254,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_SFR
     else if (sixlowpan_sfr_is((sixlowpan_sfr_t *)dispatch)) {
         DEBUG("6lo: received 6LoWPAN recoverable fragment\n");
+        pkt = _remove_headroom(pkt, payload);
         gnrc_sixlowpan_frag_sfr_recv(pkt, NULL, 0);
         return;
     }
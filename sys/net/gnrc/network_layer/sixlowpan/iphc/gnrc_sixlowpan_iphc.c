@@ -115,6 +115,10 @@
 
 #define SIXLOWPAN_IPHC_PREFIX_LEN   (64)    /**< minimum prefix length for IPHC */
 
+/* maximum length of the uncompressed headers of a datagram decompressed in
+ * place: IPv6-in-IPv6 with an 8 byte hop-by-hop option and a UDP header */
+#define IPHC_IN_PLACE_HDR_MAX       (2 * sizeof(ipv6_hdr_t) + 8U + sizeof(udp_hdr_t))
+
 /* currently only used with forwarding output, remove guard if more debug info
  * is added */
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
@@ -133,6 +137,17 @@ static inline bool _is_rfrag(gnrc_pktsnip_t *sixlo)
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR */
 }
 
+/* provides space for size bytes of uncompressed headers in ipv6. A scratch
+ * buffer for in-place decompression is not in the packet buffer and has
+ * gnrc_pktsnip_t::users 0, it can not grow. */
+static inline bool _iphc_reserve(gnrc_pktsnip_t *ipv6, size_t size)
+{
+    if (ipv6->size >= size) {
+        return true;
+    }
+    return (ipv6->users > 0) && (gnrc_pktbuf_realloc_data(ipv6, size) == 0);
+}
+
 static inline bool _context_overlaps_iid(gnrc_sixlowpan_ctx_t *ctx,
                                          ipv6_addr_t *addr,
                                          eui64_t *iid)
@@ -466,14 +481,10 @@ static size_t _iphc_nhc_ipv6_ext_decode(gnrc_pktsnip_t *sixlo, size_t offset,
                     : payload[offset + 1];
 
     /* realloc size for uncompressed snip, if too small */
-    if (ipv6->size < (*uncomp_hdr_len + sizeof(ipv6_ext_t) + ext_len)) {
-        if (gnrc_pktbuf_realloc_data(ipv6,
-                                     *uncomp_hdr_len + sizeof(ipv6_ext_t) +
-                                     ext_len)) {
-            DEBUG("6lo iphc: unable to decode IPv6 Extension header NHC "
-                  "(not enough buffer space)\n");
-            return 0;
-        }
+    if (!_iphc_reserve(ipv6, *uncomp_hdr_len + sizeof(ipv6_ext_t) + ext_len)) {
+        DEBUG("6lo iphc: unable to decode IPv6 Extension header NHC "
+              "(not enough buffer space)\n");
+        return 0;
     }
     ext_hdr = (ipv6_ext_t *)((uint8_t *)ipv6->data + *uncomp_hdr_len);
     switch (ipv6_ext_nhc & NHC_IPV6_EXT_EID_MASK) {
@@ -555,14 +566,10 @@ static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
 
             offset++;   /* move over NHC header */
             /* realloc size for uncompressed snip, if too small */
-            if (ipv6->size < (*uncomp_hdr_len + sizeof(ipv6_hdr_t))) {
-                if (gnrc_pktbuf_realloc_data(ipv6,
-                                             *uncomp_hdr_len +
-                                             sizeof(ipv6_hdr_t))) {
-                    DEBUG("6lo iphc: unable to decode IPv6 encapsulated header "
-                          "NHC (not enough buffer space)\n");
-                    return 0;
-                }
+            if (!_iphc_reserve(ipv6, *uncomp_hdr_len + sizeof(ipv6_hdr_t))) {
+                DEBUG("6lo iphc: unable to decode IPv6 encapsulated header "
+                      "NHC (not enough buffer space)\n");
+                return 0;
             }
             ipv6_hdr = (ipv6_hdr_t *)(((uint8_t *)ipv6->data) + *uncomp_hdr_len);
             tmp = _iphc_ipv6_decode(&payload[offset], netif->data,
@@ -594,8 +601,9 @@ static size_t _iphc_nhc_ipv6_decode(gnrc_pktsnip_t *sixlo, size_t offset,
                 }
             }
             else {
-                payload_len = (sixlo->size + *uncomp_hdr_len) -
-                              sizeof(ipv6_hdr_t) - offset;
+                /* the headers behind it may still grow by decompression, it
+                 * is set by _iphc_nhc_ipv6_set_len() */
+                payload_len = 0;
             }
             ipv6_hdr->len = byteorder_htons(payload_len);
             *uncomp_hdr_len += sizeof(ipv6_hdr_t);
@@ -639,12 +647,9 @@ static size_t _iphc_nhc_udp_decode(gnrc_pktsnip_t *sixlo, size_t offset,
     uint8_t tmp;
 
     /* realloc size for uncompressed snip, if too small */
-    if (ipv6->size < (*uncomp_hdr_len + sizeof(udp_hdr_t))) {
-        if (gnrc_pktbuf_realloc_data(ipv6,
-                                     *uncomp_hdr_len + sizeof(udp_hdr_t))) {
-            DEBUG("6lo: unable to decode UDP NHC (not enough buffer space)\n");
-            return 0;
-        }
+    if (!_iphc_reserve(ipv6, *uncomp_hdr_len + sizeof(udp_hdr_t))) {
+        DEBUG("6lo: unable to decode UDP NHC (not enough buffer space)\n");
+        return 0;
     }
     udp_hdr = (udp_hdr_t *)((uint8_t *)ipv6->data + *uncomp_hdr_len);
     network_uint16_t *src_port = &(udp_hdr->src_port);
@@ -716,75 +721,88 @@ static size_t _iphc_nhc_udp_decode(gnrc_pktsnip_t *sixlo, size_t offset,
 }
 #endif
 
-static inline void _recv_error_release(gnrc_pktsnip_t *sixlo,
-                                       gnrc_pktsnip_t *ipv6,
-                                       gnrc_sixlowpan_frag_rb_t *rbuf) {
-    if (rbuf != NULL) {
-        gnrc_sixlowpan_frag_rb_remove(rbuf);
+#ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
+/**
+ * @brief   Sets the payload length of the IPv6 headers encapsulated with NHC
+ *          in an unfragmented datagram
+ *
+ * The length is only known once all headers are decoded, as the NHC headers
+ * behind an encapsulated IPv6 header grow by decompression.
+ *
+ * @param[in,out] ipv6          The decoded headers
+ * @param[in] uncomp_hdr_len    Number of bytes decoded into @p ipv6
+ * @param[in] datagram_size     Size of the uncompressed datagram
+ */
+static void _iphc_nhc_ipv6_set_len(gnrc_pktsnip_t *ipv6, size_t uncomp_hdr_len,
+                                   size_t datagram_size)
+{
+    uint8_t *data = ipv6->data;
+    uint8_t nh = ((ipv6_hdr_t *)data)->nh;
+    size_t pos = sizeof(ipv6_hdr_t);
+
+    while (pos < uncomp_hdr_len) {
+        switch (nh) {
+            case PROTNUM_IPV6: {
+                ipv6_hdr_t *ipv6_hdr = (ipv6_hdr_t *)&data[pos];
+
+                pos += sizeof(ipv6_hdr_t);
+                ipv6_hdr->len = byteorder_htons(datagram_size - pos);
+                nh = ipv6_hdr->nh;
+                break;
+            }
+            case PROTNUM_IPV6_EXT_HOPOPT:
+            case PROTNUM_IPV6_EXT_RH:
+            case PROTNUM_IPV6_EXT_FRAG:
+            case PROTNUM_IPV6_EXT_DST:
+            case PROTNUM_IPV6_EXT_MOB: {
+                ipv6_ext_t *ext = (ipv6_ext_t *)&data[pos];
+
+                pos += (ext->len * IPV6_EXT_LEN_UNIT) + IPV6_EXT_LEN_UNIT;
+                nh = ext->nh;
+                break;
+            }
+            default:
+                return;
+        }
     }
-    gnrc_pktbuf_release(ipv6);
-    gnrc_pktbuf_release(sixlo);
 }
+#endif
 
-void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
-                              unsigned page)
+/**
+ * @brief   Decodes the IPHC header and the NHC headers of a datagram
+ *
+ * @param[in] sixlo                 The IPHC encoded packet
+ * @param[in] rbuf                  Reassembly buffer entry if @p ipv6 is a
+ *                                  fragmented datagram. May be NULL, if @p ipv6
+ *                                  is not fragmented
+ * @param[in] netif                 The NETIF snip of @p sixlo
+ * @param[out] ipv6                 The packet to write the decoded headers to
+ * @param[out] uncomp_hdr_len       Number of bytes decoded into @p ipv6
+ *
+ * @return  The offset of the payload in @p sixlo on success.
+ * @return  0 on error.
+ */
+static size_t _iphc_decode(gnrc_pktsnip_t *sixlo,
+                           const gnrc_sixlowpan_frag_rb_t *rbuf,
+                           gnrc_pktsnip_t *netif, gnrc_pktsnip_t *ipv6,
+                           size_t *uncomp_hdr_len)
 {
-    assert(sixlo != NULL);
-    gnrc_pktsnip_t *ipv6, *netif;
-    gnrc_netif_t *iface;
-    ipv6_hdr_t *ipv6_hdr;
     uint8_t *iphc_hdr = sixlo->data;
     size_t payload_offset;
-    size_t uncomp_hdr_len = sizeof(ipv6_hdr_t);
-    gnrc_sixlowpan_frag_rb_t *rbuf = rbuf_ptr;
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
-    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
-#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
-
-    if (sixlo->size < 2U) {
-        DEBUG("6lo iphc: IPHC header truncated\n");
-        if (rbuf != NULL) {
-            gnrc_sixlowpan_frag_rb_remove(rbuf);
-        }
-        gnrc_pktbuf_release(sixlo);
-        return;
-    }
-    if (rbuf != NULL) {
-        ipv6 = rbuf->pkt;
-        assert(ipv6 != NULL);
-        if ((ipv6->size < sizeof(ipv6_hdr_t)) &&
-            (gnrc_pktbuf_realloc_data(ipv6, sizeof(ipv6_hdr_t)) != 0)) {
-            DEBUG("6lo iphc: no space to decompress IPHC\n");
-            _recv_error_release(sixlo, ipv6, rbuf);
-            return;
-        }
-    }
-    else {
-        ipv6 = gnrc_pktbuf_add(NULL, NULL, sizeof(ipv6_hdr_t),
-                               GNRC_NETTYPE_IPV6);
-        if (ipv6 == NULL) {
-            gnrc_pktbuf_release(sixlo);
-            return;
-        }
-    }
-
-    assert(ipv6->size >= sizeof(ipv6_hdr_t));
 
-    netif = gnrc_pktsnip_search_type(sixlo, GNRC_NETTYPE_NETIF);
-    assert(netif != NULL);
-    iface = gnrc_netif_hdr_get_netif(netif->data);
-    payload_offset = _iphc_ipv6_decode(iphc_hdr, netif->data, iface,
+    *uncomp_hdr_len = sizeof(ipv6_hdr_t);
+    payload_offset = _iphc_ipv6_decode(iphc_hdr, netif->data,
+                                       gnrc_netif_hdr_get_netif(netif->data),
                                        ipv6->data);
     if ((payload_offset == 0) || (payload_offset > sixlo->size)) {
         /* unable to parse IPHC header or malicious packet */
         DEBUG("6lo iphc: malformed IPHC header\n");
-        _recv_error_release(sixlo, ipv6, rbuf);
-        return;
+        return 0;
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_IPHC_NHC
     if (iphc_hdr[IPHC1_IDX] & SIXLOWPAN_IPHC1_NH) {
         bool nhc_header = true;
-        ipv6_hdr = ipv6->data;
+        ipv6_hdr_t *ipv6_hdr = ipv6->data;
         size_t prev_nh_offset = (&ipv6_hdr->nh) - ((uint8_t *)ipv6->data);
 
         while (nhc_header) {
@@ -796,12 +814,11 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                                                            rbuf,
                                                            &prev_nh_offset,
                                                            ipv6,
-                                                           &uncomp_hdr_len);
+                                                           uncomp_hdr_len);
                     if ((payload_offset == 0) || (payload_offset > sixlo->size)) {
                         /* unable to parse IPHC header or malicious packet */
                         DEBUG("6lo iphc: malformed IPHC NHC IPv6 header\n");
-                        _recv_error_release(sixlo, ipv6, rbuf);
-                        return;
+                        return 0;
                     }
                     /* prev_nh_offset is set to 0 if next header is not
                      * compressed (== NH flag in compression header not set) */
@@ -813,12 +830,11 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                                                           rbuf,
                                                           prev_nh_offset,
                                                           ipv6,
-                                                          &uncomp_hdr_len);
+                                                          uncomp_hdr_len);
                     if ((payload_offset == 0) || (payload_offset > sixlo->size)) {
                         /* unable to parse IPHC header or malicious packet */
                         DEBUG("6lo iphc: malformed IPHC NHC IPv6 header\n");
-                        _recv_error_release(sixlo, ipv6, rbuf);
-                        return;
+                        return 0;
                     }
                     /* no NHC after UDP header */
                     nhc_header = false;
@@ -829,8 +845,132 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
                     break;
             }
         }
+        if (rbuf == NULL) {
+            _iphc_nhc_ipv6_set_len(ipv6, *uncomp_hdr_len,
+                                   *uncomp_hdr_len + sixlo->size - payload_offset);
+        }
     }
+#else
+    (void)rbuf;
 #endif
+    return payload_offset;
+}
+
+/**
+ * @brief   Decompresses an unfragmented datagram in place, into the headroom
+ *          the interface reserved in front of it
+ *
+ * @see     @ref CONFIG_GNRC_SIXLOWPAN_IPHC_RX_HEADROOM
+ *
+ * @param[in] sixlo     The IPHC encoded packet
+ * @param[in] netif     The NETIF snip of @p sixlo
+ * @param[in] page      Current 6Lo dispatch parsing page
+ *
+ * @return  true, if the datagram was decompressed and dispatched.
+ * @return  false, if @p sixlo has no headroom or it does not suffice.
+ *          @p sixlo is left unchanged then.
+ */
+static bool _iphc_recv_in_place(gnrc_pktsnip_t *sixlo, gnrc_pktsnip_t *netif,
+                                unsigned page)
+{
+    gnrc_pktsnip_t *headroom = sixlo->next;
+    uint8_t hdr[IPHC_IN_PLACE_HDR_MAX];
+    /* the headroom can only be taken once the length of the uncompressed
+     * headers is known, so decode them into a scratch buffer first */
+    gnrc_pktsnip_t scratch = { .data = hdr, .size = sizeof(hdr), .users = 0,
+                               .type = GNRC_NETTYPE_IPV6 };
+    ipv6_hdr_t *ipv6_hdr;
+    size_t payload_offset, uncomp_hdr_len;
+
+    if ((headroom == NULL) || (headroom->type != GNRC_NETTYPE_UNDEF)) {
+        return false;
+    }
+    payload_offset = _iphc_decode(sixlo, NULL, netif, &scratch,
+                                  &uncomp_hdr_len);
+    /* malformed datagrams are dropped by the regular path */
+    if ((payload_offset == 0) || (uncomp_hdr_len < payload_offset) ||
+        (gnrc_pktbuf_take_headroom(sixlo, headroom,
+                                   uncomp_hdr_len - payload_offset) != 0)) {
+        return false;
+    }
+    DEBUG("6lo iphc: decompressed %" PRIuSIZE " byte of headers in place\n",
+          uncomp_hdr_len);
+    memcpy(sixlo->data, hdr, uncomp_hdr_len);
+    ipv6_hdr = sixlo->data;
+    ipv6_hdr->len = byteorder_htons(sixlo->size - sizeof(ipv6_hdr_t));
+    sixlo->type = GNRC_NETTYPE_IPV6;
+    gnrc_pktbuf_remove_snip(sixlo, headroom);
+    gnrc_sixlowpan_dispatch_recv(sixlo, NULL, page);
+    return true;
+}
+
+static inline void _recv_error_release(gnrc_pktsnip_t *sixlo,
+                                       gnrc_pktsnip_t *ipv6,
+                                       gnrc_sixlowpan_frag_rb_t *rbuf) {
+    if (rbuf != NULL) {
+        gnrc_sixlowpan_frag_rb_remove(rbuf);
+    }
+    gnrc_pktbuf_release(ipv6);
+    gnrc_pktbuf_release(sixlo);
+}
+
+void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
+                              unsigned page)
+{
+    assert(sixlo != NULL);
+    gnrc_pktsnip_t *ipv6, *netif;
+    ipv6_hdr_t *ipv6_hdr;
+    size_t payload_offset;
+    size_t uncomp_hdr_len;
+    gnrc_sixlowpan_frag_rb_t *rbuf = rbuf_ptr;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    gnrc_netif_t *iface;
+    gnrc_sixlowpan_frag_vrb_t *vrbe = NULL;
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+
+    if (sixlo->size < 2U) {
+        DEBUG("6lo iphc: IPHC header truncated\n");
+        if (rbuf != NULL) {
+            gnrc_sixlowpan_frag_rb_remove(rbuf);
+        }
+        gnrc_pktbuf_release(sixlo);
+        return;
+    }
+    netif = gnrc_pktsnip_search_type(sixlo, GNRC_NETTYPE_NETIF);
+    assert(netif != NULL);
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
+    iface = gnrc_netif_hdr_get_netif(netif->data);
+#endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_VRB */
+    if ((CONFIG_GNRC_SIXLOWPAN_IPHC_RX_HEADROOM > 0) && (rbuf == NULL) &&
+        _iphc_recv_in_place(sixlo, netif, page)) {
+        return;
+    }
+    if (rbuf != NULL) {
+        ipv6 = rbuf->pkt;
+        assert(ipv6 != NULL);
+        if ((ipv6->size < sizeof(ipv6_hdr_t)) &&
+            (gnrc_pktbuf_realloc_data(ipv6, sizeof(ipv6_hdr_t)) != 0)) {
+            DEBUG("6lo iphc: no space to decompress IPHC\n");
+            _recv_error_release(sixlo, ipv6, rbuf);
+            return;
+        }
+    }
+    else {
+        ipv6 = gnrc_pktbuf_add(NULL, NULL, sizeof(ipv6_hdr_t),
+                               GNRC_NETTYPE_IPV6);
+        if (ipv6 == NULL) {
+            gnrc_pktbuf_release(sixlo);
+            return;
+        }
+    }
+
+    assert(ipv6->size >= sizeof(ipv6_hdr_t));
+
+    payload_offset = _iphc_decode(sixlo, rbuf, netif, ipv6, &uncomp_hdr_len);
+    if (payload_offset == 0) {
+        _recv_error_release(sixlo, ipv6, rbuf);
+        return;
+    }
     uint16_t payload_len;
     if (rbuf != NULL) {
         /* for a fragmented datagram we know the overall length already */
@@ -900,7 +1040,7 @@ void gnrc_sixlowpan_iphc_recv(gnrc_pktsnip_t *sixlo, void *rbuf_ptr,
     }
     if (rbuf == NULL) {
         /* (rbuf == NULL) => forwarding is not affected by this */
-        if (gnrc_pktbuf_realloc_data(ipv6, uncomp_hdr_len + payload_len) != 0) {
+        if (gnrc_pktbuf_realloc_data(ipv6, sizeof(ipv6_hdr_t) + payload_len) != 0) {
             DEBUG("6lo iphc: no space left to copy payload\n");
             _recv_error_release(sixlo, ipv6, rbuf);
             return;
@@ -168,6 +168,25 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     return new;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_mark_headroom(gnrc_pktsnip_t *pkt, size_t size)
+{
+    if ((pkt == NULL) || (size >= pkt->size)) {
+        return NULL;
+    }
+    /* malloc'd data can only be freed from its start, so the headroom can not
+     * stay in front of the data of pkt */
+    return gnrc_pktbuf_mark(pkt, size, GNRC_NETTYPE_UNDEF);
+}
+
+int gnrc_pktbuf_take_headroom(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *headroom,
+                              size_t size)
+{
+    (void)pkt;
+    (void)headroom;
+    (void)size;
+    return -ENOTSUP;
+}
+
 static int _realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
     assert(pkt != NULL);
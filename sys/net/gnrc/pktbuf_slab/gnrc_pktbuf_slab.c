@@ -0,0 +1,530 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf_slab
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "memarray.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/pktbuf_slab.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#include "pktbuf_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _ALIGN_MASK         ((2 * sizeof(uintptr_t)) - 1)
+#define _ALIGN(size)        (((size) + _ALIGN_MASK) & ~(_ALIGN_MASK))
+
+#define _SNIP_SIZE          _ALIGN(sizeof(gnrc_pktsnip_t))
+#define _SMALL_SIZE         _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE)
+#define _MEDIUM_SIZE        _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE)
+#define _LARGE_SIZE         _ALIGN(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE)
+
+#define _SHARE(share)       ((CONFIG_GNRC_PKTBUF_SIZE * (share)) / 100U)
+#define _SNIP_NUMOF         (_SHARE(CONFIG_GNRC_PKTBUF_SLAB_SNIP_SHARE) / _SNIP_SIZE)
+#define _SMALL_NUMOF        (_SHARE(CONFIG_GNRC_PKTBUF_SLAB_SMALL_SHARE) / _SMALL_SIZE)
+#define _MEDIUM_NUMOF       (_SHARE(CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SHARE) / _MEDIUM_SIZE)
+#define _LARGE_NUMOF        ((CONFIG_GNRC_PKTBUF_SIZE - \
+                              (_SNIP_NUMOF * _SNIP_SIZE) - \
+                              (_SMALL_NUMOF * _SMALL_SIZE) - \
+                              (_MEDIUM_NUMOF * _MEDIUM_SIZE)) / _LARGE_SIZE)
+
+static_assert((CONFIG_GNRC_PKTBUF_SLAB_SNIP_SHARE +
+               CONFIG_GNRC_PKTBUF_SLAB_SMALL_SHARE +
+               CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SHARE) < 100U,
+              "no space left for large slab of gnrc_pktbuf_slab");
+static_assert((_SNIP_SIZE <= _SMALL_SIZE) && (_SMALL_SIZE <= _MEDIUM_SIZE) &&
+              (_MEDIUM_SIZE <= _LARGE_SIZE),
+              "slab sizes of gnrc_pktbuf_slab must be in ascending order");
+static_assert((_SNIP_NUMOF > 0) && (_SMALL_NUMOF > 0) &&
+              (_MEDIUM_NUMOF > 0) && (_LARGE_NUMOF > 0),
+              "CONFIG_GNRC_PKTBUF_SIZE too small for gnrc_pktbuf_slab");
+
+/**
+ * @brief   A slab of equally sized blocks
+ */
+typedef struct {
+    memarray_t blocks;      /**< free list of the slab */
+    uint8_t *start;         /**< first block of the slab */
+    uint8_t *end;           /**< end of the slab */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t used;          /**< number of blocks in use */
+    uint16_t max_used;      /**< high-water mark of used */
+} _slab_t;
+
+static alignas(2 * sizeof(uintptr_t)) uint8_t _static_buf[CONFIG_GNRC_PKTBUF_SIZE];
+static _slab_t _slabs[GNRC_PKTBUF_SLAB_NUMOF];
+static size_t _requested;
+static size_t _reserved;
+static size_t _max_reserved;
+static unsigned _spills;
+static unsigned _fails;
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static uint8_t *_slab_init(_slab_t *slab, uint8_t *start, size_t size,
+                           unsigned numof)
+{
+    memarray_init(&slab->blocks, start, size, numof);
+    slab->start = start;
+    slab->end = start + (size * numof);
+    slab->numof = numof;
+    slab->used = 0;
+    slab->max_used = 0;
+    return slab->end;
+}
+
+static _slab_t *_get_slab(const void *ptr)
+{
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        if (((uint8_t *)ptr >= _slabs[i].start) &&
+            ((uint8_t *)ptr < _slabs[i].end)) {
+            return &_slabs[i];
+        }
+    }
+    return NULL;
+}
+
+/* gets start of the block data points into, data may point into the middle of
+ * a block after gnrc_pktbuf_mark() */
+static inline uint8_t *_block_start(const _slab_t *slab, const void *data)
+{
+    size_t offset = (uint8_t *)data - slab->start;
+
+    return slab->start + (offset - (offset % slab->blocks.size));
+}
+
+/* gets the number of bytes usable at data without reallocation */
+static inline size_t _block_space(const _slab_t *slab, const void *data)
+{
+    return (_block_start(slab, data) + slab->blocks.size) - (uint8_t *)data;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    uint8_t *ptr = _static_buf;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(_static_buf, GNRC_PKTBUF_CANARY, sizeof(_static_buf));
+    }
+    ptr = _slab_init(&_slabs[0], ptr, _SNIP_SIZE, _SNIP_NUMOF);
+    ptr = _slab_init(&_slabs[1], ptr, _SMALL_SIZE, _SMALL_NUMOF);
+    ptr = _slab_init(&_slabs[2], ptr, _MEDIUM_SIZE, _MEDIUM_NUMOF);
+    ptr = _slab_init(&_slabs[3], ptr, _LARGE_SIZE, _LARGE_NUMOF);
+    assert(ptr <= &_static_buf[CONFIG_GNRC_PKTBUF_SIZE]);
+    _requested = 0;
+    _reserved = 0;
+    _max_reserved = 0;
+    _spills = 0;
+    _fails = 0;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > _LARGE_SIZE) {
+        DEBUG("pktbuf: size (%" PRIuSIZE ") > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              size, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
+              "size > pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
+              size, (void *)pkt, (pkt ? pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    if (pkt->size != size) {
+        /* a block can only be released as a whole, so move the marked data
+         * into a block of its own and keep the rest where it is */
+        new_data_marked = _pktbuf_alloc(size);
+        if (new_data_marked == NULL) {
+            DEBUG("pktbuf: could not reallocate marked section.\n");
+            gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        memcpy(new_data_marked, pkt->data, size);
+        /* the marked bytes now are accounted for by new_data_marked */
+        _requested -= size;
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        new_data_marked = pkt->data;
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark_headroom(gnrc_pktsnip_t *pkt, size_t size)
+{
+    gnrc_pktsnip_t *headroom;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size >= pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
+              "size >= pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
+              size, (void *)pkt, (pkt ? pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    headroom = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (headroom == NULL) {
+        DEBUG("pktbuf: could not allocate headroom snip.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* the headroom stays in the block of pkt, in front of its data, so the
+     * headroom snip itself is empty */
+    _set_pktsnip(headroom, pkt->next, NULL, 0, GNRC_NETTYPE_UNDEF);
+    _requested -= size;
+    pkt->data = ((uint8_t *)pkt->data) + size;
+    pkt->size -= size;
+    pkt->next = headroom;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return headroom;
+}
+
+int gnrc_pktbuf_take_headroom(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *headroom,
+                              size_t size)
+{
+    assert((pkt != NULL) && (headroom != NULL));
+    mutex_lock(&gnrc_pktbuf_mutex);
+    /* the headroom of gnrc_pktbuf_mark_headroom() is the empty snip directly
+     * behind pkt, its bytes are the ones in front of the data in the block of
+     * pkt */
+    if ((pkt->data == NULL) || (pkt->users > 1) || (headroom->users > 1) ||
+        (pkt->next != headroom) || (headroom->data != NULL) ||
+        ((size_t)((uint8_t *)pkt->data -
+                  _block_start(_get_slab(pkt->data), pkt->data)) < size)) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return -ENOSPC;
+    }
+    _requested += size;
+    pkt->data = ((uint8_t *)pkt->data) - size;
+    pkt->size += size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    /* new size still fits into the current block: just adapt the accounting */
+    else if ((pkt->data != NULL) &&
+             (size <= _block_space(_get_slab(pkt->data), pkt->data))) {
+        _requested = _requested - pkt->size + size;
+    }
+    else {
+        void *new_data = _pktbuf_alloc(size);
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, pkt->size);
+        }
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = new_data;
+    }
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        assert(pkt->users + num <= 0xff);
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE &&
+        pkt->users == GNRC_PKTBUF_CANARY) {
+        puts("gnrc_pktbuf: use after free detected\n");
+        DEBUG_BREAKPOINT(3);
+    }
+
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+void gnrc_pktbuf_slab_get_usage(gnrc_pktbuf_slab_usage_t *usage)
+{
+    assert(usage != NULL);
+    mutex_lock(&gnrc_pktbuf_mutex);
+    usage->requested = _requested;
+    usage->reserved = _reserved;
+    usage->max_reserved = _max_reserved;
+    usage->spills = _spills;
+    usage->fails = _fails;
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        usage->slabs[i].block_size = _slabs[i].blocks.size;
+        usage->slabs[i].numof = _slabs[i].numof;
+        usage->slabs[i].used = _slabs[i].used;
+        usage->slabs[i].max_used = _slabs[i].max_used;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    gnrc_pktbuf_slab_usage_t usage;
+
+    gnrc_pktbuf_slab_get_usage(&usage);
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_static_buf[0],
+           (void *)&_static_buf[CONFIG_GNRC_PKTBUF_SIZE],
+           CONFIG_GNRC_PKTBUF_SIZE);
+    printf("  requested: %" PRIuSIZE " B, reserved: %" PRIuSIZE " B "
+           "(max: %" PRIuSIZE " B)\n",
+           usage.requested, usage.reserved, usage.max_reserved);
+    printf("  fragmentation: %u/1000, spills: %u, fails: %u\n",
+           gnrc_pktbuf_slab_fragmentation(&usage), usage.spills, usage.fails);
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        printf("  slab %u: %4" PRIuSIZE " B x %3u, used: %3u (max: %3u)\n",
+               i, usage.slabs[i].block_size, usage.slabs[i].numof,
+               usage.slabs[i].used, usage.slabs[i].max_used);
+    }
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        if (_slabs[i].used > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    size_t reserved = 0;
+
+    /* Invariants of this implementation:
+     *  - every block of a slab is either used or in its free list
+     *  - the reserved bytes are the sum of the sizes of all used blocks
+     *  - at most the reserved bytes are requested
+     */
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        if ((_slabs[i].used + memarray_available(&_slabs[i].blocks)) !=
+            _slabs[i].numof) {
+            return false;
+        }
+        reserved += _slabs[i].used * _slabs[i].blocks.size;
+    }
+    return (reserved == _reserved) && (_requested <= _reserved);
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    bool spilled = false;
+
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        _slab_t *slab = &_slabs[i];
+        void *ptr;
+
+        if (size > slab->blocks.size) {
+            continue;
+        }
+        if ((ptr = memarray_alloc(&slab->blocks)) == NULL) {
+            spilled = true;
+            continue;
+        }
+        if (++slab->used > slab->max_used) {
+            slab->max_used = slab->used;
+        }
+        _requested += size;
+        _reserved += slab->blocks.size;
+        if (_reserved > _max_reserved) {
+            _max_reserved = _reserved;
+        }
+        _spills += spilled;
+        if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+            const uint8_t *chk = (uint8_t *)ptr + sizeof(memarray_element_t);
+
+            for (size_t j = 0; j < (slab->blocks.size - sizeof(memarray_element_t)); j++) {
+                if (chk[j] != GNRC_PKTBUF_CANARY) {
+                    printf("[%p] mismatch at offset %" PRIuSIZE "/%" PRIuSIZE "\n",
+                           ptr, j + sizeof(memarray_element_t), slab->blocks.size);
+                    assert(0);
+                }
+            }
+            /* clear out canary */
+            memset(ptr, ~GNRC_PKTBUF_CANARY, slab->blocks.size);
+        }
+        return ptr;
+    }
+    DEBUG("pktbuf: no space left in packet buffer\n");
+    _fails++;
+    return NULL;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    _slab_t *slab;
+    uint8_t *block;
+
+    if (data == NULL) {
+        return;
+    }
+
+    if ((slab = _get_slab(data)) == NULL) {
+        assert(0);
+        return;
+    }
+    block = _block_start(slab, data);
+    assert(size <= _block_space(slab, data));
+    if (CONFIG_GNRC_PKTBUF_CHECK_USE_AFTER_FREE) {
+        memset(block, GNRC_PKTBUF_CANARY, slab->blocks.size);
+    }
+    memarray_free(&slab->blocks, block);
+    assert(slab->used > 0);
+    slab->used--;
+    _requested -= size;
+    _reserved -= slab->blocks.size;
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    const uintptr_t start = (uintptr_t)_static_buf;
+    const uintptr_t end = start + sizeof(_static_buf);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+}
+
+/** @} */
@@ -53,6 +53,13 @@ static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size
                                     gnrc_nettype_t type);
 static void *_pktbuf_alloc(size_t size);
 
+/* data of a snip may start up to sizeof(_unused_t) - 1 bytes into its chunk
+ * after gnrc_pktbuf_mark_headroom() or gnrc_pktbuf_take_headroom() */
+static inline size_t _chunk_offset(const void *data)
+{
+    return (uintptr_t)data & GNRC_PKTBUF_STATIC_ALIGN_MASK;
+}
+
 static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
                                 void *data, size_t size, gnrc_nettype_t type)
 {
@@ -99,8 +106,8 @@ gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t s
 gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
 {
     gnrc_pktsnip_t *marked_snip;
-    /* size required for chunk */
-    size_t required_new_size = _align(size);
+    /* size of marked data within its chunk */
+    size_t marked_size;
     void *new_data_marked;
 
     mutex_lock(&gnrc_pktbuf_mutex);
@@ -112,6 +119,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
         mutex_unlock(&gnrc_pktbuf_mutex);
         return NULL;
     }
+    marked_size = _chunk_offset(pkt->data) + size;
     /* create new snip descriptor for marked data */
     marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
     if (marked_snip == NULL) {
@@ -121,7 +129,7 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     }
     /* marked data would not fit _unused_t marker => move data around to allow
      * for proper free */
-    if ((pkt->size != size) && (size < required_new_size)) {
+    if ((pkt->size != size) && (marked_size < _align(marked_size))) {
         void *new_data_rest;
         new_data_marked = _pktbuf_alloc(size);
         if (new_data_marked == NULL) {
@@ -157,9 +165,95 @@ gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_
     return marked_snip;
 }
 
+gnrc_pktsnip_t *gnrc_pktbuf_mark_headroom(gnrc_pktsnip_t *pkt, size_t size)
+{
+    gnrc_pktsnip_t *headroom;
+    size_t offset, split;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size >= pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %" PRIuSIZE ") or pkt == NULL (was %p) or "
+              "size >= pkt->size (was %" PRIuSIZE ") or pkt->data == NULL (was %p)\n",
+              size, (void *)pkt, (pkt ? pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    headroom = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (headroom == NULL) {
+        DEBUG("pktbuf: could not allocate headroom snip.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* the headroom takes the chunk up to the last alignment boundary in front
+     * of the new data of pkt, the bytes behind that boundary stay in the
+     * chunk of pkt */
+    offset = _chunk_offset(pkt->data);
+    split = (offset + size) & ~GNRC_PKTBUF_STATIC_ALIGN_MASK;
+    if (split > offset) {
+        _set_pktsnip(headroom, pkt->next, pkt->data, split - offset,
+                     GNRC_NETTYPE_UNDEF);
+    }
+    else {
+        _set_pktsnip(headroom, pkt->next, NULL, 0, GNRC_NETTYPE_UNDEF);
+    }
+    pkt->data = ((uint8_t *)pkt->data) + size;
+    pkt->size -= size;
+    pkt->next = headroom;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return headroom;
+}
+
+int gnrc_pktbuf_take_headroom(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *headroom,
+                              size_t size)
+{
+    uint8_t *data, *start;
+
+    assert((pkt != NULL) && (headroom != NULL));
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((pkt->data == NULL) || (pkt->users > 1) || (headroom->users > 1)) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return -ENOSPC;
+    }
+    data = pkt->data;
+    /* the bytes in front of the data within the chunk of pkt are usable in
+     * any case, the headroom only if its chunk ends where the one of pkt
+     * starts */
+    start = data - _chunk_offset(data);
+    if (headroom->data != NULL) {
+        uint8_t *hr_chunk = ((uint8_t *)headroom->data) -
+                            _chunk_offset(headroom->data);
+
+        if ((hr_chunk + _align(_chunk_offset(headroom->data) + headroom->size))
+            == start) {
+            start = headroom->data;
+        }
+    }
+    if ((size_t)(data - start) < size) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return -ENOSPC;
+    }
+    data -= size;
+    if (start == headroom->data) {
+        /* the headroom keeps the whole chunks in front of the new data */
+        uint8_t *end = data - _chunk_offset(data);
+
+        if (end > start) {
+            headroom->size = end - start;
+        }
+        else {
+            headroom->data = NULL;
+            headroom->size = 0;
+        }
+    }
+    pkt->data = data;
+    pkt->size += size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
 int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
 {
-    size_t aligned_size = _align(size);
 
     mutex_lock(&gnrc_pktbuf_mutex);
     assert(pkt != NULL);
@@ -191,9 +285,15 @@ int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
         gnrc_pktbuf_free_internal(pkt->data, pkt->size);
         pkt->data = new_data;
     }
-    else if (_align(pkt->size) > aligned_size) {
-        gnrc_pktbuf_free_internal(((uint8_t *)pkt->data) + aligned_size,
-                     pkt->size - aligned_size);
+    else {
+        /* release whole chunks behind the new end of the data */
+        size_t offset = _chunk_offset(pkt->data);
+        size_t aligned_size = _align(offset + size);
+
+        if (_align(offset + pkt->size) > aligned_size) {
+            gnrc_pktbuf_free_internal(((uint8_t *)pkt->data) - offset + aligned_size,
+                                      offset + pkt->size - aligned_size);
+        }
     }
     pkt->size = size;
     mutex_unlock(&gnrc_pktbuf_mutex);
@@ -461,11 +561,15 @@ static inline _unused_t *_merge(_unused_t *a, _unused_t *b)
 void gnrc_pktbuf_free_internal(void *data, size_t size)
 {
     size_t bytes_at_end;
-    _unused_t *new = (_unused_t *)data, *prev = NULL, *ptr = _first_unused;
+    _unused_t *new, *prev = NULL, *ptr = _first_unused;
 
     if (data == NULL) {
         return;
     }
+    /* release the whole chunk data points into */
+    size += _chunk_offset(data);
+    data = ((uint8_t *)data) - _chunk_offset(data);
+    new = data;
 
     if (!gnrc_pktbuf_contains(data)) {
         assert(0);
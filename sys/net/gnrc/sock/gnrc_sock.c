@@ -18,8 +18,11 @@
 #include <stdlib.h>
 
 #include "compiler_hints.h"
+#include "container.h"
+#include "irq.h"
 #include "log.h"
 #include "macros/math.h"
+#include "memarray.h"
 #include "net/af.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/hdr.h"
@@ -40,42 +43,187 @@ extern gnrc_pktsnip_t *gnrc_pktbuf_fuzzptr;
 gnrc_pktsnip_t *gnrc_sock_prevpkt = NULL;
 #endif
 
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
+/**
+ * @brief   Slot of the pool holding a received packet
+ */
+typedef struct {
+    clist_node_t node;      /**< entry in gnrc_sock_reg_t::rx_queue */
+    gnrc_pktsnip_t *pkt;    /**< received packet */
+} _rx_slot_t;
+
+static _rx_slot_t _rx_slots[CONFIG_GNRC_SOCK_POOL_SIZE];
+static memarray_t _rx_pool;
+static bool _rx_pool_initialized;
+
+static void _rx_pool_init(void)
+{
+    unsigned state = irq_disable();
+
+    if (!_rx_pool_initialized) {
+        memarray_init(&_rx_pool, _rx_slots, sizeof(_rx_slot_t),
+                      ARRAY_SIZE(_rx_slots));
+        _rx_pool_initialized = true;
+    }
+    irq_restore(state);
+}
+
+static bool _rx_put(gnrc_sock_reg_t *reg, gnrc_pktsnip_t *pkt)
+{
+    unsigned state = irq_disable();
+    _rx_slot_t *slot = NULL;
+
+    if (reg->rx_len < reg->rx_max) {
+        slot = memarray_alloc(&_rx_pool);
+    }
+    if (slot == NULL) {
+        reg->rx_drops++;
+        irq_restore(state);
+        return false;
+    }
+    slot->pkt = pkt;
+    clist_rpush(&reg->rx_queue, &slot->node);
+    reg->rx_len++;
+    irq_restore(state);
+
+    /* wake up the receiver, if it isn't already going to */
+    msg_t msg = { .type = GNRC_NETAPI_MSG_TYPE_RCV };
+    mbox_try_put(&reg->mbox, &msg);
+    return true;
+}
+
+static gnrc_pktsnip_t *_rx_get(gnrc_sock_reg_t *reg)
+{
+    unsigned state = irq_disable();
+    _rx_slot_t *slot = (_rx_slot_t *)clist_lpop(&reg->rx_queue);
+    gnrc_pktsnip_t *pkt = NULL;
+
+    if (slot != NULL) {
+        pkt = slot->pkt;
+        memarray_free(&_rx_pool, slot);
+        reg->rx_len--;
+    }
+    irq_restore(state);
+
+    return pkt;
+}
+#endif /* MODULE_GNRC_SOCK_MBOX_POOL */
+
 #ifdef SOCK_HAS_ASYNC
+static bool _rx_avail(gnrc_sock_reg_t *reg)
+{
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
+    return reg->rx_len > 0;
+#else
+    return mbox_avail(&reg->mbox) > 0;
+#endif
+}
+#endif /* SOCK_HAS_ASYNC */
+
+#if defined(SOCK_HAS_ASYNC) || IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
 static void _netapi_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
 {
     if (cmd == GNRC_NETAPI_MSG_TYPE_RCV) {
+        gnrc_sock_reg_t *reg = ctx;
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
+        bool queued = _rx_put(reg, pkt);
+#else
         msg_t msg = { .type = GNRC_NETAPI_MSG_TYPE_RCV,
                       .content = { .ptr = pkt } };
-        gnrc_sock_reg_t *reg = ctx;
+        bool queued = (mbox_try_put(&reg->mbox, &msg) > 0);
+#endif
 
-        if (mbox_try_put(&reg->mbox, &msg) < 1) {
+        if (!queued) {
             LOG_WARNING("gnrc_sock: dropped message to %p (was full)\n",
                         (void *)&reg->mbox);
             /* packet could not be delivered so it should be dropped */
             gnrc_pktbuf_release(pkt);
             return;
         }
+#ifdef SOCK_HAS_ASYNC
         if (reg->async_cb.generic) {
             reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
         }
+#endif
     }
 }
-#endif /* SOCK_HAS_ASYNC */
+#endif /* SOCK_HAS_ASYNC || MODULE_GNRC_SOCK_MBOX_POOL */
 
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
     mbox_init(&reg->mbox, reg->mbox_queue, GNRC_SOCK_MBOX_SIZE);
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
+    _rx_pool_init();
+    reg->rx_queue.next = NULL;
+    reg->rx_len = 0;
+    reg->rx_max = CONFIG_GNRC_SOCK_POOL_SOCK_MAX;
+    reg->rx_drops = 0;
+#endif
 #ifdef SOCK_HAS_ASYNC
     reg->async_cb.generic = NULL;
+#endif
+#if defined(SOCK_HAS_ASYNC) || IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
     reg->netreg_cb.cb = _netapi_cb;
     reg->netreg_cb.ctx = reg;
     gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
-#else   /* SOCK_HAS_ASYNC */
+#else
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
-#endif  /* SOCK_HAS_ASYNC */
+#endif
     gnrc_netreg_register(type, &reg->entry);
 }
 
+/* gets a message from the mailbox of the sock, waiting for at most timeout */
+static int _recv_msg(gnrc_sock_reg_t *reg, msg_t *msg, uint32_t timeout)
+{
+    if (timeout == SOCK_NO_TIMEOUT) {
+        mbox_get(&reg->mbox, msg);
+    }
+    else if (timeout == 0) {
+        if (!mbox_try_get(&reg->mbox, msg)) {
+            return -EAGAIN;
+        }
+    }
+    else {
+        /* Preferring low power over us precision here if both options are
+         * possible. This is typically the better trade-off, as even on fast
+         * networks round-trip-times are typically measured in ms rather than
+         * in us */
+        if (IS_USED(MODULE_ZTIMER_MSEC)) {
+            /* rounding up seems more sensible here */
+            uint32_t timeout_ms = (timeout + US_PER_MS - 1) / US_PER_MS;
+            if (ztimer_mbox_get_timeout(ZTIMER_MSEC, &reg->mbox, msg, timeout_ms)) {
+                return -ETIMEDOUT;
+            }
+        }
+        else if (IS_USED(MODULE_ZTIMER_USEC)) {
+            if (ztimer_mbox_get_timeout(ZTIMER_USEC, &reg->mbox, msg, timeout)) {
+                return -ETIMEDOUT;
+            }
+        }
+        else {
+            /* cannot do timeout without a timer */
+            assert(0);
+            return -ENOTSUP;
+        }
+    }
+    return 0;
+}
+
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
+/* current time in us on the clock _recv_msg() waits on, only differences of
+ * it are meaningful */
+static uint32_t _now_us(void)
+{
+    if (IS_USED(MODULE_ZTIMER_MSEC)) {
+        return ztimer_now(ZTIMER_MSEC) * US_PER_MS;
+    }
+    else if (IS_USED(MODULE_ZTIMER_USEC)) {
+        return ztimer_now(ZTIMER_USEC);
+    }
+    return 0;
+}
+#endif
+
 ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
                        uint32_t timeout, sock_ip_ep_t *remote,
                        gnrc_sock_recv_aux_t *aux)
@@ -98,9 +246,16 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     }
 #endif
 
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
+    /* mbox_size() can't tell a mailbox of a single message from none */
+    if (reg->netreg_cb.cb != _netapi_cb) {
+        return -EINVAL;
+    }
+#else
     if (mbox_size(&reg->mbox) != GNRC_SOCK_MBOX_SIZE) {
         return -EINVAL;
     }
+#endif
 
 #if defined(DEVELHELP) && IS_ACTIVE(SOCK_HAS_ASYNC)
     if ((timeout != 0) && (reg->async_cb.generic)) {
@@ -111,36 +266,34 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     }
 #endif
 
-    if (timeout == SOCK_NO_TIMEOUT) {
-        mbox_get(&reg->mbox, &msg);
-    }
-    else if (timeout == 0) {
-        if (!mbox_try_get(&reg->mbox, &msg)) {
-            return -EAGAIN;
-        }
-    }
-    else {
-        /* Preferring low power over us precision here if both options are
-         * possible. This is typically the better trade-off, as even on fast
-         * networks round-trip-times are typically measured in ms rather than
-         * in us */
-        if (IS_USED(MODULE_ZTIMER_MSEC)) {
-            /* rounding up seems more sensible here */
-            uint32_t timeout_ms = (timeout + US_PER_MS - 1) / US_PER_MS;
-            if (ztimer_mbox_get_timeout(ZTIMER_MSEC, &reg->mbox, &msg, timeout_ms)) {
-                return -ETIMEDOUT;
-            }
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
+    /* the mailbox may signal packets already taken from the queue, so after
+     * such a wake-up only wait for what is left of the timeout */
+    uint32_t start = _now_us();
+    uint32_t left = timeout;
+
+    while ((pkt = _rx_get(reg)) == NULL) {
+        int res = _recv_msg(reg, &msg, left);
+        if (res < 0) {
+            return res;
         }
-        else if (IS_USED(MODULE_ZTIMER_USEC)) {
-            if (ztimer_mbox_get_timeout(ZTIMER_USEC, &reg->mbox, &msg, timeout)) {
-                return -ETIMEDOUT;
+        if ((timeout != 0) && (timeout != SOCK_NO_TIMEOUT)) {
+            uint32_t elapsed = _now_us() - start;
+
+            if (elapsed >= timeout) {
+                pkt = _rx_get(reg);
+                if (pkt == NULL) {
+                    return -ETIMEDOUT;
+                }
+                break;
             }
+            left = timeout - elapsed;
         }
-        else {
-            /* cannot do timeout without a timer */
-            assert(0);
-            return -ENOTSUP;
-        }
+    }
+#else
+    int res = _recv_msg(reg, &msg, timeout);
+    if (res < 0) {
+        return res;
     }
     switch (msg.type) {
         case GNRC_NETAPI_MSG_TYPE_RCV:
@@ -149,6 +302,7 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
         default:
             return -EINVAL;
     }
+#endif
     /* TODO: discern NETTYPE from remote->family (set in caller), when IPv4
      * was implemented */
     ipv6_hdr_t *ipv6_hdr = gnrc_ipv6_get_header(pkt);
@@ -186,7 +340,7 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     *pkt_out = pkt; /* set out parameter */
 
 #if IS_ACTIVE(SOCK_HAS_ASYNC)
-    if (reg->async_cb.generic && mbox_avail(&reg->mbox)) {
+    if (reg->async_cb.generic && _rx_avail(reg)) {
         reg->async_cb.generic(reg, SOCK_ASYNC_MSG_RECV, reg->async_cb_arg);
     }
 #endif
@@ -197,6 +351,18 @@ ssize_t gnrc_sock_recv(gnrc_sock_reg_t *reg, gnrc_pktsnip_t **pkt_out,
     return 0;
 }
 
+void gnrc_sock_close(gnrc_sock_reg_t *reg, gnrc_nettype_t type)
+{
+    gnrc_netreg_unregister(type, &reg->entry);
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
+    /* return the slots to the pool */
+    gnrc_pktsnip_t *pkt;
+    while ((pkt = _rx_get(reg)) != NULL) {
+        gnrc_pktbuf_release(pkt);
+    }
+#endif
+}
+
 ssize_t gnrc_sock_send(gnrc_pktsnip_t *payload, sock_ip_ep_t *local,
                        const sock_ip_ep_t *remote, uint8_t nh)
 {
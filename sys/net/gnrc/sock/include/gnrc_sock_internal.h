@@ -151,6 +151,12 @@ static inline void gnrc_ep_set(sock_ip_ep_t *out, const sock_ip_ep_t *in,
  */
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx);
 
+/**
+ * @brief   Close a sock internally
+ * @internal
+ */
+void gnrc_sock_close(gnrc_sock_reg_t *reg, gnrc_nettype_t type);
+
 /**
  * @brief   Receive a packet internally
  * @internal
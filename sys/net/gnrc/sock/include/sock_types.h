@@ -14,6 +14,17 @@
  * @brief       Provides an implementation of the @ref net_sock by the
  *              @ref net_gnrc
  *
+ * ## Receive queue pool
+ *
+ * By default, every sock holds a queue of @ref GNRC_SOCK_MBOX_SIZE received
+ * packets, whether it ever receives anything or not. With the module
+ * `gnrc_sock_mbox_pool`, received packets are queued in slots taken from a
+ * pool of @ref CONFIG_GNRC_SOCK_POOL_SIZE slots shared by all socks instead,
+ * when they are received. A sock holds at most
+ * @ref CONFIG_GNRC_SOCK_POOL_SOCK_MAX of them, so a single sock can't take
+ * all slots. Packets beyond that or received while the pool is empty are
+ * dropped and counted in gnrc_sock_reg_t::rx_drops.
+ *
  * @{
  *
  * @file
@@ -25,6 +36,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "clist.h"
 #include "mbox.h"
 #include "net/af.h"
 #include "net/gnrc.h"
@@ -58,14 +70,40 @@ extern "C" {
 #ifndef CONFIG_GNRC_SOCK_MBOX_SIZE_EXP
 #define CONFIG_GNRC_SOCK_MBOX_SIZE_EXP      (3)
 #endif
+
+/**
+ * @brief   Number of received packets queued in the pool shared by all socks
+ *
+ * @note    Only used with module `gnrc_sock_mbox_pool`
+ */
+#ifndef CONFIG_GNRC_SOCK_POOL_SIZE
+#define CONFIG_GNRC_SOCK_POOL_SIZE          (16U)
+#endif
+
+/**
+ * @brief   Default of the received packets a single sock queues in the pool,
+ *          gnrc_sock_reg_t::rx_max
+ *
+ * @note    Only used with module `gnrc_sock_mbox_pool`
+ */
+#ifndef CONFIG_GNRC_SOCK_POOL_SOCK_MAX
+#define CONFIG_GNRC_SOCK_POOL_SOCK_MAX      (CONFIG_GNRC_SOCK_POOL_SIZE * 3 / 4)
+#endif
 /** @} */
 
 /**
  * @brief Size for gnrc_sock_reg_t::mbox_queue
+ *
+ * With module `gnrc_sock_mbox_pool`, the mailbox only signals that packets
+ * were queued in the pool.
  */
 #ifndef GNRC_SOCK_MBOX_SIZE
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
+#define GNRC_SOCK_MBOX_SIZE  (1)
+#else
 #define GNRC_SOCK_MBOX_SIZE  (1 << CONFIG_GNRC_SOCK_MBOX_SIZE_EXP)
 #endif
+#endif
 
 /**
  * @brief   Forward declaration
@@ -94,8 +132,18 @@ struct gnrc_sock_reg {
     gnrc_netreg_entry_t entry;             /**< @ref net_gnrc_netreg entry for mbox */
     mbox_t mbox;                           /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[GNRC_SOCK_MBOX_SIZE]; /**< queue for gnrc_sock_reg_t::mbox */
-#ifdef SOCK_HAS_ASYNC
+#if IS_USED(MODULE_GNRC_SOCK_MBOX_POOL) || defined(DOXYGEN)
+    clist_node_t rx_queue;                 /**< received packets in pool slots */
+    uint16_t rx_len;                       /**< packets in gnrc_sock_reg_t::rx_queue */
+    uint16_t rx_max;                       /**< maximum of gnrc_sock_reg_t::rx_len */
+    uint32_t rx_drops;                     /**< packets dropped, as
+                                                gnrc_sock_reg_t::rx_max was
+                                                reached or the pool was empty */
+#endif
+#if defined(SOCK_HAS_ASYNC) || IS_USED(MODULE_GNRC_SOCK_MBOX_POOL)
     gnrc_netreg_entry_cbd_t netreg_cb;     /**< netreg callback */
+#endif
+#ifdef SOCK_HAS_ASYNC
     /**
      * @brief   asynchronous upper layer callback
      *
@@ -68,7 +68,7 @@ int sock_ip_create(sock_ip_t *sock, const sock_ip_ep_t *local,
 void sock_ip_close(sock_ip_t *sock)
 {
     assert(sock != NULL);
-    gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &sock->reg.entry);
+    gnrc_sock_close(&sock->reg, GNRC_NETTYPE_IPV6);
 #ifdef SOCK_HAS_ASYNC_CTX
     sock_event_close(sock_ip_get_async_ctx(sock));
 #endif
@@ -157,7 +157,7 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
 void sock_udp_close(sock_udp_t *sock)
 {
     assert(sock != NULL);
-    gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &sock->reg.entry);
+    gnrc_sock_close(&sock->reg, GNRC_NETTYPE_UDP);
 #ifdef SOCK_HAS_ASYNC_CTX
     sock_event_close(sock_udp_get_async_ctx(sock));
 #endif
@@ -330,6 +330,58 @@ ssize_t sock_udp_recv_buf_aux(sock_udp_t *sock, void **data, void **buf_ctx,
     return res;
 }
 
+ssize_t sock_udp_recv_view_aux(sock_udp_t *sock, sock_udp_recv_view_t *view,
+                               uint32_t timeout, sock_udp_ep_t *remote,
+                               sock_udp_aux_rx_t *aux)
+{
+    void *data;
+    ssize_t res;
+    unsigned n = 0;
+
+    assert((sock != NULL) && (view != NULL));
+    view->buf_ctx = NULL;
+    res = sock_udp_recv_buf_aux(sock, &data, &view->buf_ctx, timeout, remote,
+                                aux);
+    if (res < 0) {
+        return res;
+    }
+    view->snips[0] = (iolist_t){ 0 };
+    view->len = 0;
+    /* the payload snips come first in a received packet, the UDP header
+     * follows them */
+    for (gnrc_pktsnip_t *snip = view->buf_ctx;
+         (snip != NULL) && (snip->type != GNRC_NETTYPE_UDP);
+         snip = snip->next) {
+        if (snip->size == 0) {
+            continue;
+        }
+        if (n == ARRAY_SIZE(view->snips)) {
+            DEBUG("gnrc_sock_udp: payload scattered over too many snips\n");
+            gnrc_pktbuf_release(view->buf_ctx);
+            view->buf_ctx = NULL;
+            return -ENOBUFS;
+        }
+        view->snips[n] = (iolist_t){
+            .iol_base = snip->data,
+            .iol_len = snip->size,
+        };
+        if (n > 0) {
+            view->snips[n - 1].iol_next = &view->snips[n];
+        }
+        view->len += snip->size;
+        n++;
+    }
+    return view->len;
+}
+
+void sock_udp_recv_view_release(sock_udp_t *sock, sock_udp_recv_view_t *view)
+{
+    (void)sock;
+    assert(view != NULL);
+    gnrc_pktbuf_release(view->buf_ctx);
+    view->buf_ctx = NULL;
+}
+
 ssize_t sock_udp_sendv_aux(sock_udp_t *sock,
                            const iolist_t *snips,
                            const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
@@ -322,6 +322,9 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
     tcb->rtt_var = RTO_UNINITIALIZED;
     tcb->srtt = RTO_UNINITIALIZED;
     tcb->rto = RTO_UNINITIALIZED;
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+    ringbuffer_init(&tcb->snd_buf, tcb->snd_buf_raw, sizeof(tcb->snd_buf_raw));
+#endif
     mutex_init(&(tcb->fsm_lock));
     mutex_init(&(tcb->function_lock));
     TCP_DEBUG_LEAVE;
@@ -335,6 +338,8 @@ void gnrc_tcp_tcb_queue_init(gnrc_tcp_tcb_queue_t *queue)
     mutex_init(&queue->lock);
     queue->tcbs = NULL;
     queue->tcbs_len = 0;
+    memset(queue->syn_backlog, 0, sizeof(queue->syn_backlog));
+    queue->next = NULL;
     TCP_DEBUG_LEAVE;
 }
 
@@ -543,10 +548,18 @@ int gnrc_tcp_listen(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t *tcbs, size_t tc
         }
     }
 
-    /* If everything went well: setup queue and unlock all TCBs */
+    /* If everything went well: setup queue, make it receive connection requests
+     * and unlock all TCBs */
     if (!ret) {
+        _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+
         queue->tcbs = tcbs;
         queue->tcbs_len = tcbs_len;
+        memset(queue->syn_backlog, 0, sizeof(queue->syn_backlog));
+
+        mutex_lock(&list->lock);
+        LL_PREPEND(list->queues, queue);
+        mutex_unlock(&list->lock);
     }
 
     for (size_t i = 0; i < tcbs_len; ++i) {
@@ -725,8 +738,9 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until something was sent and all of it was acked, or with a send
+     * buffer until something was buffered */
+    while (ret == 0 || (!CONFIG_GNRC_TCP_SND_BUF_SIZE && ret > 0 && tcb->rtx_len > 0)) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -736,8 +750,9 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
             break;
         }
 
-        /* If the send window is closed: Setup Probing */
-        if (tcb->snd_wnd <= 0) {
+        /* If the send window is closed: Setup Probing. With a send buffer
+         * the persist timer of the connection probes */
+        if (!CONFIG_GNRC_TCP_SND_BUF_SIZE && tcb->snd_wnd <= 0) {
             /* If this is the first probe: Setup probing duration */
             if (!probing_mode) {
                 probing_mode = true;
@@ -749,9 +764,20 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send the remaining data as long as the window and the
+         * retransmit queue allow it and we are not probing */
+        if ((size_t)ret < len && !probing_mode) {
+            int sent;
+            while ((size_t)ret < len &&
+                   (sent = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL,
+                                         (uint8_t *)data + ret, len - ret)) > 0) {
+                ret += sent;
+            }
+        }
+
+        /* With a send buffer, return as soon as something was buffered */
+        if (CONFIG_GNRC_TCP_SND_BUF_SIZE && ret > 0) {
+            break;
         }
 
         /* Wait for responses */
@@ -960,13 +986,65 @@ void gnrc_tcp_abort(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
 }
 
+int gnrc_tcp_set_nodelay(gnrc_tcp_tcb_t *tcb, bool nodelay)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+
+    if (!CONFIG_GNRC_TCP_SND_BUF_SIZE) {
+        TCP_DEBUG_ERROR("-ENOTSUP: No send buffer configured.");
+        TCP_DEBUG_LEAVE;
+        return -ENOTSUP;
+    }
+
+    mutex_lock(&(tcb->function_lock));
+    _gnrc_tcp_fsm_set_status(tcb, STATUS_NODELAY, nodelay);
+
+    /* Send data the Nagle algorithm held back */
+    _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, NULL, 0);
+    mutex_unlock(&(tcb->function_lock));
+
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+int gnrc_tcp_set_cork(gnrc_tcp_tcb_t *tcb, bool cork)
+{
+    TCP_DEBUG_ENTER;
+    assert(tcb != NULL);
+
+    if (!CONFIG_GNRC_TCP_SND_BUF_SIZE) {
+        TCP_DEBUG_ERROR("-ENOTSUP: No send buffer configured.");
+        TCP_DEBUG_LEAVE;
+        return -ENOTSUP;
+    }
+
+    mutex_lock(&(tcb->function_lock));
+    _gnrc_tcp_fsm_set_status(tcb, STATUS_CORK, cork);
+
+    /* Send data held back while the connection was corked */
+    _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, NULL, 0);
+    mutex_unlock(&(tcb->function_lock));
+
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
 void gnrc_tcp_stop_listen(gnrc_tcp_tcb_queue_t *queue)
 {
     TCP_DEBUG_ENTER;
     assert(queue != NULL);
 
-    /* Close all connections associated with the given queue */
+    /* Stop receiving connection requests */
+    _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
     mutex_lock(&(queue->lock));
+    mutex_lock(&list->lock);
+    if (queue->tcbs != NULL) {
+        LL_DELETE(list->queues, queue);
+    }
+    mutex_unlock(&list->lock);
+
+    /* Close all connections associated with the given queue */
     for (size_t i = 0; i < queue->tcbs_len; ++i) {
         gnrc_tcp_tcb_t *tcb = &(queue->tcbs[i]);
         mutex_lock(&(tcb->function_lock));
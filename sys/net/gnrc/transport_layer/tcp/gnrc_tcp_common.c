@@ -17,11 +17,159 @@
  * @}
  */
 
+#include <string.h>
+#include "net/af.h"
+#include "unaligned.h"
 #include "include/gnrc_tcp_common.h"
 
-static _gnrc_tcp_common_tcb_list_t _list = {NULL, MUTEX_INIT};
+#ifdef MODULE_GNRC_IPV6
+#include "net/gnrc/ipv6.h"
+#endif
+
+static _gnrc_tcp_common_tcb_list_t _list = { .lock = MUTEX_INIT };
+
+/**
+ * @brief Calculates the connection table bucket of a connection.
+ *
+ * @param[in] local_addr   Local address.
+ * @param[in] peer_addr    Address of the peer.
+ * @param[in] local_port   Local port number.
+ * @param[in] peer_port    Port number of the peer.
+ *
+ * @returns   Index of the bucket.
+ */
+static unsigned _hash(const uint8_t *local_addr, const uint8_t *peer_addr,
+                      uint16_t local_port, uint16_t peer_port)
+{
+    uint32_t hash = ((uint32_t)local_port << 16) | peer_port;
+
+#ifdef MODULE_GNRC_IPV6
+    /* The interface identifiers of the addresses differ the most */
+    hash ^= unaligned_get_u32(peer_addr + 8) ^ unaligned_get_u32(peer_addr + 12);
+    /* Rotated, so that swapped addresses do not cancel each other out */
+    uint32_t local = unaligned_get_u32(local_addr + 8) ^ unaligned_get_u32(local_addr + 12);
+    hash ^= (local << 16) | (local >> 16);
+#else
+    (void)local_addr;
+    (void)peer_addr;
+#endif
+    /* Multiplicative hashing, the middle bits are mixed best */
+    hash *= 2654435769U;
+    return (hash >> 16) & (TCP_CONN_TABLE_SIZE - 1);
+}
+
+/**
+ * @brief Gets the connection table bucket of a TCB.
+ *
+ * @param[in] tcb   TCB with addresses and port numbers set.
+ *
+ * @returns   Head of the bucket.
+ */
+static gnrc_tcp_tcb_t **_bucket(const gnrc_tcp_tcb_t *tcb)
+{
+#ifdef MODULE_GNRC_IPV6
+    return &_list.table[_hash(tcb->local_addr, tcb->peer_addr,
+                              tcb->local_port, tcb->peer_port)];
+#else
+    return &_list.table[_hash(NULL, NULL, tcb->local_port, tcb->peer_port)];
+#endif
+}
+
+/**
+ * @brief Searches a connection table bucket for a connection.
+ *
+ * @param[in] local_addr   Local address.
+ * @param[in] peer_addr    Address of the peer.
+ * @param[in] local_port   Local port number.
+ * @param[in] peer_port    Port number of the peer.
+ *
+ * @returns   TCB of the connection, NULL if there is none.
+ */
+static gnrc_tcp_tcb_t *_find(const uint8_t *local_addr, const uint8_t *peer_addr,
+                             uint16_t local_port, uint16_t peer_port)
+{
+    gnrc_tcp_tcb_t *iter = _list.table[_hash(local_addr, peer_addr, local_port, peer_port)];
+
+    for (; iter; iter = iter->hnext) {
+        if (iter->local_port == local_port && iter->peer_port == peer_port) {
+#ifdef MODULE_GNRC_IPV6
+            if (iter->address_family == AF_INET6 &&
+                memcmp(iter->local_addr, local_addr, sizeof(iter->local_addr)) == 0 &&
+                memcmp(iter->peer_addr, peer_addr, sizeof(iter->peer_addr)) == 0) {
+                break;
+            }
+#else
+            break;
+#endif
+        }
+    }
+    return iter;
+}
 
 _gnrc_tcp_common_tcb_list_t *_gnrc_tcp_common_get_tcb_list(void)
 {
     return &_list;
 }
+
+void _gnrc_tcp_common_conn_add(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_tcp_tcb_t **bucket = _bucket(tcb);
+
+    for (gnrc_tcp_tcb_t *iter = *bucket; iter; iter = iter->hnext) {
+        if (iter == tcb) {
+            return;
+        }
+    }
+    tcb->hnext = *bucket;
+    *bucket = tcb;
+}
+
+void _gnrc_tcp_common_conn_remove(gnrc_tcp_tcb_t *tcb)
+{
+    for (gnrc_tcp_tcb_t **iter = _bucket(tcb); *iter; iter = &(*iter)->hnext) {
+        if (*iter == tcb) {
+            *iter = tcb->hnext;
+            tcb->hnext = NULL;
+            return;
+        }
+    }
+}
+
+gnrc_tcp_tcb_t *_gnrc_tcp_common_conn_find(const uint8_t *local_addr,
+                                           const uint8_t *peer_addr,
+                                           uint16_t local_port, uint16_t peer_port)
+{
+    gnrc_tcp_tcb_t *tcb = _find(local_addr, peer_addr, local_port, peer_port);
+
+#ifdef MODULE_GNRC_IPV6
+    /* The local address of an active open is not known before the SYN+ACK */
+    if (tcb == NULL) {
+        tcb = _find(ipv6_addr_unspecified.u8, peer_addr, local_port, peer_port);
+    }
+#endif
+    return tcb;
+}
+
+gnrc_tcp_tcb_queue_t *_gnrc_tcp_common_queue_find(const uint8_t *local_addr,
+                                                  uint16_t local_port)
+{
+    gnrc_tcp_tcb_queue_t *iter = _list.queues;
+
+    for (; iter; iter = iter->next) {
+        /* All TCBs of a queue listen on the same endpoint */
+        gnrc_tcp_tcb_t *tcb = iter->tcbs;
+
+        if (tcb->local_port == local_port) {
+#ifdef MODULE_GNRC_IPV6
+            if ((tcb->status & STATUS_ALLOW_ANY_ADDR) ||
+                memcmp(tcb->local_addr, local_addr, sizeof(tcb->local_addr)) == 0) {
+                break;
+            }
+#else
+            (void)local_addr;
+            break;
+#endif
+        }
+    }
+    return iter;
+}
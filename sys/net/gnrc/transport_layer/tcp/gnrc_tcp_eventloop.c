@@ -207,44 +207,18 @@ static int _receive(gnrc_pktsnip_t *pkt)
 #endif
     }
 
-    /* Find TCB to for this packet */
+    /* Find TCB for this packet in the connection table */
     _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
     mutex_lock(&list->lock);
-    tcb = list->head;
-    while (tcb) {
 #ifdef MODULE_GNRC_IPV6
-        /* Check if current TCB is fitting for the incoming packet */
-        if (ip->type == GNRC_NETTYPE_IPV6 && tcb->address_family == AF_INET6) {
-            /* If SYN is set, a connection is listening on that port ... */
-            ipv6_addr_t *tmp_addr = NULL;
-            _gnrc_tcp_fsm_state_t state = _gnrc_tcp_fsm_get_state(tcb);
-            if (syn && tcb->local_port == dst && state == FSM_STATE_LISTEN) {
-                /* ... and local addr is unspec or pre configured */
-                tmp_addr = &((ipv6_hdr_t *)ip->data)->dst;
-                if (ipv6_addr_equal((ipv6_addr_t *) tcb->local_addr, (ipv6_addr_t *) tmp_addr) ||
-                    ipv6_addr_is_unspecified((ipv6_addr_t *) tcb->local_addr)) {
-                    break;
-                }
-            }
-
-            /* If SYN is not set and the ports match ... */
-            if (!syn && tcb->local_port == dst && tcb->peer_port == src) {
-                /* .. and the IPv6 addresses match */
-                tmp_addr = &((ipv6_hdr_t * )ip->data)->src;
-                if (ipv6_addr_equal((ipv6_addr_t *) tcb->peer_addr, (ipv6_addr_t *) tmp_addr)) {
-                    break;
-                }
-            }
-        }
+    tcb = _gnrc_tcp_common_conn_find(((ipv6_hdr_t *)ip->data)->dst.u8,
+                                     ((ipv6_hdr_t *)ip->data)->src.u8, dst, src);
 #else
-        /* Suppress compiler warnings if TCP is built without network layer */
-        TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
-        (void) syn;
-        (void) src;
-        (void) dst;
+    /* Suppress compiler warnings if TCP is built without network layer */
+    TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
+    (void) src;
+    (void) dst;
 #endif
-        tcb = tcb->next;
-    }
     mutex_unlock(&list->lock);
 
     /* Call FSM with event RCVD_PKT if a fitting TCB was found */
@@ -252,10 +226,16 @@ static int _receive(gnrc_pktsnip_t *pkt)
      * (reason: tcb can be NULL at runtime)
      */
     if (tcb != NULL) {
-        _gnrc_tcp_fsm(tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
+        /* A SYN for an existing connection is not a new connection request */
+        if (syn) {
+            TCP_DEBUG_INFO("Connection is handled by another TCB.");
+        }
+        else {
+            _gnrc_tcp_fsm(tcb, FSM_EVENT_RCVD_PKT, pkt, NULL, 0);
+        }
     }
-    /* No fitting TCB has been found. Respond with reset */
-    else {
+    /* Pass packet to a listening queue. If there is none, respond with reset */
+    else if (_gnrc_tcp_fsm_listen(pkt) < 0) {
         if ((ctl & MSK_RST) != MSK_RST) {
             _gnrc_tcp_pkt_build_reset_from_pkt(&reset, pkt);
             if (gnrc_netapi_send(_tcp_eventloop_pid, reset) < 1) {
@@ -43,6 +43,13 @@
  */
 #define TCB_EQUAL(a, b)      ((a) != (b))
 
+/**
+ * @brief Number of duplicate acknowledgements triggering a fast retransmit.
+ *
+ * @see https://tools.ietf.org/html/rfc5681#section-3.2
+ */
+#define DUP_ACK_THRESHOLD    (3U)
+
 /**
  * @brief Checks if a given port number is currently used by a TCB as local_port.
  *
@@ -92,15 +99,163 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
+    if (tcb->rtx_len > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        for (unsigned i = 0; i < tcb->rtx_len; i++) {
+            gnrc_pktbuf_release(tcb->rtx_queue[i].pkt);
+        }
+        tcb->rtx_len = 0;
     }
+    tcb->status &= ~(STATUS_RECOVERY | STATUS_RTT_PENDING);
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Calculates the senders maximum segment size.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @return   Size of the largest segment that is sent.
+ */
+static uint32_t _smss(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->mss < CONFIG_GNRC_TCP_MSS) ? tcb->mss : CONFIG_GNRC_TCP_MSS;
+}
+
+/**
+ * @brief Initializes congestion control after the SYN exchange.
+ *
+ * @see https://tools.ietf.org/html/rfc5681#section-3.1
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _init_congestion_control(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = _smss(tcb);
+
+    tcb->cwnd = (smss > 2190) ? 2 * smss : (smss > 1095) ? 3 * smss : 4 * smss;
+    tcb->ssthresh = UINT32_MAX;
+    tcb->dup_acks = 0;
+    tcb->status &= ~STATUS_RECOVERY;
+}
+
+/**
+ * @brief Starts loss recovery, reduces the slow start threshold.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _enter_recovery(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t flight_size = tcb->snd_nxt - tcb->snd_una;
+    uint32_t smss = _smss(tcb);
+
+    tcb->ssthresh = (flight_size / 2 > 2 * smss) ? flight_size / 2 : 2 * smss;
+    tcb->recover = tcb->snd_nxt;
+    tcb->status |= STATUS_RECOVERY;
+    for (unsigned i = 0; i < tcb->rtx_len; i++) {
+        tcb->rtx_queue[i].retransmitted = false;
+    }
+}
+
+/**
+ * @brief Retransmits the oldest segment that was neither selectively
+ *        acknowledged nor retransmitted in the current loss recovery.
+ *
+ * @param[in,out] tcb            TCB holding the connection information.
+ * @param[in]     sacked_after   Retransmit the segment only if the peer
+ *                               selectively acknowledged a later segment.
+ */
+static void _retransmit_lost(gnrc_tcp_tcb_t *tcb, bool sacked_after)
+{
+    unsigned i = 0;
+
+    while (i < tcb->rtx_len &&
+           (tcb->rtx_queue[i].sacked || tcb->rtx_queue[i].retransmitted)) {
+        i++;
+    }
+    if (i == tcb->rtx_len) {
+        return;
+    }
+    if (sacked_after) {
+        unsigned j = i + 1;
+
+        while (j < tcb->rtx_len && !tcb->rtx_queue[j].sacked) {
+            j++;
+        }
+        if (j == tcb->rtx_len) {
+            return;
+        }
+    }
+
+    /* Every send attempt consumes a user of the packet */
+    gnrc_tcp_rtx_seg_t *seg = &tcb->rtx_queue[i];
+    seg->retransmitted = true;
+    gnrc_pktbuf_hold(seg->pkt, 1);
+    _gnrc_tcp_pkt_send(tcb, seg->pkt, 0, true);
+}
+
+/**
+ * @brief Congestion control and loss recovery for acknowledgements of new data.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     ack     Acknowledgement number received.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ */
+static void _rcvd_new_ack(gnrc_tcp_tcb_t *tcb, uint32_t ack, uint32_t acked)
+{
+    uint32_t smss = _smss(tcb);
+
+    tcb->dup_acks = 0;
+
+    /* Slow start or congestion avoidance, as long as the window limits sending */
+    if (tcb->cwnd < tcb->snd_wnd) {
+        if (tcb->cwnd < tcb->ssthresh) {
+            tcb->cwnd += (acked < smss) ? acked : smss;
+        }
+        else {
+            uint32_t inc = (tcb->cwnd > 0) ? smss * smss / tcb->cwnd : smss;
+            tcb->cwnd += (inc > 0) ? inc : 1;
+        }
+    }
+
+    if (tcb->status & STATUS_RECOVERY) {
+        /* Partial acknowledgement: The next segment was lost as well (RFC 6582) */
+        if (LSS_32_BIT(ack, tcb->recover)) {
+            _retransmit_lost(tcb, false);
+        }
+        else {
+            tcb->status &= ~STATUS_RECOVERY;
+        }
+    }
+}
+
+/**
+ * @brief Fast retransmit and loss recovery for duplicate acknowledgements.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _rcvd_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->dup_acks < UINT8_MAX) {
+        tcb->dup_acks++;
+    }
+
+    if (tcb->status & STATUS_RECOVERY) {
+        /* Retransmit segments the peer reported missing (RFC 6675) */
+        if (tcb->status & STATUS_SACK) {
+            _retransmit_lost(tcb, true);
+        }
+    }
+    else if (tcb->dup_acks == DUP_ACK_THRESHOLD) {
+        /* Fast retransmit, continue with half the congestion window */
+        TCP_DEBUG_INFO("Fast retransmit.");
+        _enter_recovery(tcb);
+        tcb->cwnd = tcb->ssthresh;
+        _retransmit_lost(tcb, false);
+    }
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -148,8 +303,14 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and blocks received out of order */
             _clear_retransmit(tcb);
+            tcb->sack_len = 0;
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+            /* Discard data that was not sent */
+            ringbuffer_init(&tcb->snd_buf, tcb->snd_buf_raw, sizeof(tcb->snd_buf_raw));
+            tcb->status &= ~STATUS_FIN_PENDING;
+#endif
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -157,6 +318,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 /* Remove connection from active connections */
                 mutex_lock(&list->lock);
                 LL_DELETE(list->head, tcb);
+                _gnrc_tcp_common_conn_remove(tcb);
                 mutex_unlock(&list->lock);
 
                 /* Free potentially allocated receive buffer */
@@ -177,6 +339,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             /* Clear Accepted Status */
             tcb->status &= ~(STATUS_ACCEPTED);
 
+            /* Remove connection from the connection table before its address info is cleared */
+            mutex_lock(&list->lock);
+            _gnrc_tcp_common_conn_remove(tcb);
+
             /* Clear address info */
 #ifdef MODULE_GNRC_IPV6
             if (tcb->address_family == AF_INET6) {
@@ -189,7 +355,6 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             tcb->peer_port = PORT_UNSPEC;
 
             /* Add connection to active connections (if not already active) */
-            mutex_lock(&list->lock);
             LL_SEARCH(list->head, iter, tcb, TCB_EQUAL);
             if (iter == NULL) {
                 LL_PREPEND(list->head, tcb);
@@ -219,6 +384,7 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 }
                 LL_PREPEND(list->head, tcb);
             }
+            _gnrc_tcp_common_conn_add(tcb);
             mutex_unlock(&list->lock);
             break;
 
@@ -228,6 +394,11 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
                 _gnrc_tcp_eventloop_sched(&tcb->event_timeout,
                                           CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS,
                                           MSG_TYPE_CONNECTION_TIMEOUT, tcb);
+
+                /* Segments of the connection are matched by the connection table from now on */
+                mutex_lock(&list->lock);
+                _gnrc_tcp_common_conn_add(tcb);
+                mutex_unlock(&list->lock);
             }
             break;
 
@@ -252,6 +423,153 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
     return 0;
 }
 
+/**
+ * @brief Sends a FIN and transitions into the matching closing state.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _send_fin(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_pktsnip_t *out_pkt = NULL;
+    uint16_t seq_con = 0;
+
+    _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt,
+                        tcb->rcv_nxt, NULL, 0);
+    _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+    _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+
+    if (tcb->state == FSM_STATE_SYN_RCVD || tcb->state == FSM_STATE_ESTABLISHED) {
+        _transition_to(tcb, FSM_STATE_FIN_WAIT_1);
+    }
+    else if (tcb->state == FSM_STATE_CLOSE_WAIT) {
+        _transition_to(tcb, FSM_STATE_LAST_ACK);
+    }
+}
+
+/**
+ * @brief Sends a zero window probe.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _send_probe(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_pktsnip_t *out_pkt = NULL;  /* Outgoing packet */
+    uint8_t probe_pay[] = {1};       /* Probe payload */
+
+    /* The probe sends a already acknowledged sequence no. with a garbage byte. */
+    _gnrc_tcp_pkt_build(tcb, &out_pkt, NULL, MSK_ACK, tcb->snd_una - 1,
+                        tcb->rcv_nxt, probe_pay, sizeof(probe_pay));
+    _gnrc_tcp_pkt_send(tcb, out_pkt, 0, false);
+}
+
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+/**
+ * @brief Starts the persist timer, probing the closed window of the peer.
+ *
+ * The retransmission timer is used, it is idle while nothing is in flight.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _sched_persist(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t duration = (tcb->rto > (int32_t)CONFIG_GNRC_TCP_PROBE_LOWER_BOUND_MS)
+                      ? (uint32_t)tcb->rto : CONFIG_GNRC_TCP_PROBE_LOWER_BOUND_MS;
+
+    /* Back off exponentially with every probe sent */
+    for (unsigned i = 0; i < tcb->retries &&
+         duration < CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS; i++) {
+        duration *= 2;
+    }
+    if (duration > CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS) {
+        duration = CONFIG_GNRC_TCP_PROBE_UPPER_BOUND_MS;
+    }
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, duration,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
+/**
+ * @brief Sends data from the send buffer, as far as the windows allow it.
+ *
+ * A segment smaller than the maximum segment size is held back while
+ * previously sent data is unacknowledged (Nagle algorithm, RFC 1122) or while
+ * the connection is corked. The FIN of a closing connection follows the last
+ * buffered byte.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _send_buffered(gnrc_tcp_tcb_t *tcb)
+{
+    /* The send buffer is empty until the connection is established */
+    if (tcb->state != FSM_STATE_SYN_RCVD && tcb->state != FSM_STATE_ESTABLISHED &&
+        tcb->state != FSM_STATE_CLOSE_WAIT) {
+        return;
+    }
+
+    uint32_t smss = _smss(tcb);
+    while (!ringbuffer_empty(&tcb->snd_buf) &&
+           tcb->rtx_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
+        uint32_t wnd = (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+        uint32_t flight_size = tcb->snd_nxt - tcb->snd_una;
+        size_t avail = tcb->snd_buf.avail;
+
+        if (flight_size >= wnd) {
+            break;
+        }
+        size_t payload = wnd - flight_size;
+        payload = (payload < smss) ? payload : smss;
+        payload = (payload < avail) ? payload : avail;
+
+        /* Coalesce the last bytes of the buffer with later writes */
+        if (payload == avail && payload < smss && !(tcb->status & STATUS_FIN_PENDING)) {
+            if (tcb->status & STATUS_CORK) {
+                break;
+            }
+            if (!(tcb->status & STATUS_NODELAY) && flight_size > 0) {
+                break;
+            }
+        }
+
+        /* Build the segment and move the data from the send buffer into it */
+        gnrc_pktsnip_t *out_pkt = NULL;
+        uint16_t seq_con = 0;
+        uint16_t ctl = (payload == avail) ? MSK_ACK | MSK_PSH : MSK_ACK;
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, ctl, tcb->snd_nxt,
+                                tcb->rcv_nxt, NULL, payload) < 0) {
+            TCP_DEBUG_ERROR("Can't build segment.");
+            break;
+        }
+        gnrc_pktsnip_t *pay_snp = gnrc_pktsnip_search_type(out_pkt, GNRC_NETTYPE_UNDEF);
+        ringbuffer_get(&tcb->snd_buf, pay_snp->data, payload);
+
+        /* Nothing was in flight, the backoff of previous probes is over */
+        if (tcb->rtx_len == 0) {
+            tcb->retries = 0;
+        }
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+
+        /* Signal user that the send buffer has room again */
+        tcb->status |= STATUS_NOTIFY_USER;
+    }
+
+    if (!ringbuffer_empty(&tcb->snd_buf)) {
+        /* The peer closed its window: Probe it until it opens again */
+        if (tcb->snd_wnd == 0 && tcb->rtx_len == 0) {
+            _sched_persist(tcb);
+        }
+    }
+    /* All data was sent: Send the FIN of a pending close. It needs a slot in
+     * the retransmission queue, otherwise it stays pending until an ACK
+     * frees one. */
+    else if ((tcb->status & STATUS_FIN_PENDING) &&
+             (tcb->rtx_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE)) {
+        tcb->status &= ~STATUS_FIN_PENDING;
+        _send_fin(tcb);
+    }
+}
+#endif
+
 /**
  * @brief FSM handling function for opening a TCP connection.
  *
@@ -285,6 +603,14 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         tcb->snd_nxt = tcb->iss;
         tcb->snd_una = tcb->iss;
 
+        /* Offer SACK and window scaling, the peers SYN confirms them */
+        tcb->status |= STATUS_SACK;
+        if (IS_ACTIVE(CONFIG_GNRC_TCP_WND_SCALE_EN)) {
+            tcb->status |= STATUS_WND_SCALE;
+        }
+        tcb->snd_wscale = 0;
+        tcb->rcv_wscale = 0;
+
         /* Transition FSM to SYN_SENT */
         ret = _transition_to(tcb, FSM_STATE_SYN_SENT);
         if (ret < 0) {
@@ -312,16 +638,26 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
  *
- * @returns   Number of successfully transmitted bytes.
+ * @returns   Number of successfully transmitted bytes, or with a send buffer
+ *            the number of bytes stored in it.
  */
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+    /* Buffer as much data as possible and send what the windows allow */
+    unsigned added = ringbuffer_add(&tcb->snd_buf, buf, len);
+    _send_buffered(tcb);
+    TCP_DEBUG_LEAVE;
+    return added;
+#else
+    uint32_t wnd = (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+    uint32_t flight_size = tcb->snd_nxt - tcb->snd_una;
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
+    /* Check if window is open and the retransmit queue takes another segment */
+    if (flight_size < wnd && tcb->rtx_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         /* Calculate segment size */
+        size_t payload = wnd - flight_size;
         payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
         payload = (payload < tcb->mss) ? payload : tcb->mss;
         payload = (payload < len) ? payload : len;
@@ -329,8 +665,12 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
         /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
+                                tcb->snd_nxt, tcb->rcv_nxt, buf, payload) < 0) {
+            TCP_DEBUG_ERROR("Can't build segment.");
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
         _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
         TCP_DEBUG_LEAVE;
@@ -338,6 +678,7 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     }
     TCP_DEBUG_LEAVE;
     return 0;
+#endif
 }
 
 /**
@@ -389,25 +730,18 @@ static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
 
     if (tcb->state == FSM_STATE_SYN_RCVD || tcb->state == FSM_STATE_ESTABLISHED ||
         tcb->state == FSM_STATE_CLOSE_WAIT) {
-
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+        /* Send FIN packet after the buffered data */
+        tcb->status |= STATUS_FIN_PENDING;
+        _send_buffered(tcb);
+#else
         /* Send FIN packet */
-        gnrc_pktsnip_t *out_pkt = NULL;
-        uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt,
-                            tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
-        _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+        _send_fin(tcb);
+#endif
     }
-
-    if (tcb->state == FSM_STATE_LISTEN) {
+    else if (tcb->state == FSM_STATE_LISTEN) {
         _transition_to(tcb, FSM_STATE_CLOSED);
     }
-    else if (tcb->state == FSM_STATE_SYN_RCVD || tcb->state == FSM_STATE_ESTABLISHED) {
-        _transition_to(tcb, FSM_STATE_FIN_WAIT_1);
-    }
-    else if (tcb->state == FSM_STATE_CLOSE_WAIT) {
-        _transition_to(tcb, FSM_STATE_LAST_ACK);
-    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -458,18 +792,26 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     gnrc_pktsnip_t *out_pkt = NULL;  /* Outgoing packet */
     uint16_t seq_con = 0;            /* Sequence number consumption of outgoing packet */
     gnrc_pktsnip_t *snp;             /* Temporary packet snip */
-    gnrc_tcp_tcb_t *lst = NULL;      /* Temporary pointer to TCB */
     uint16_t ctl = 0;                /* Control bits of the incoming packet */
     uint32_t seg_seq = 0;            /* Sequence number of the incoming packet*/
     uint32_t seg_ack = 0;            /* Acknowledgment number of the incoming packet */
     uint32_t seg_wnd = 0;            /* Receive window of the incoming packet */
+    gnrc_tcp_sack_block_t sack[TCP_OPTION_SACK_BLOCKS_MAX]; /* SACK blocks of the incoming packet */
+    uint8_t sack_len = 0;            /* Number of SACK blocks of the incoming packet */
+
+    /* Segments for listening TCBs are handled by their queue, see _gnrc_tcp_fsm_listen() */
+    if (tcb->state == FSM_STATE_LISTEN) {
+        TCP_DEBUG_INFO("Segment for listening TCB ignored.");
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
 
     /* Search for TCP header. */
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_TCP);
     tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
 
     /* Parse packet options, return if they are malformed */
-    if (_gnrc_tcp_option_parse(tcb, tcp_hdr) < 0) {
+    if (_gnrc_tcp_option_parse(tcb, tcp_hdr, sack, &sack_len) < 0) {
         TCP_DEBUG_ERROR("Failed to parse TCP header options.");
         TCP_DEBUG_LEAVE;
         return 0;
@@ -481,6 +823,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
     seg_wnd = byteorder_ntohs(tcp_hdr->window);
 
+    /* The window of a SYN is never scaled */
+    if (!(ctl & MSK_SYN)) {
+        seg_wnd <<= tcb->snd_wscale;
+    }
+
     /* Extract network layer header */
 #ifdef MODULE_GNRC_IPV6
     snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_IPV6);
@@ -492,100 +839,8 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     void *ip = snp->data;
 #endif
 
-    /* Handle state LISTEN */
-    if (tcb->state == FSM_STATE_LISTEN) {
-        /* 1) Check RST: if RST is set: return */
-        if (ctl & MSK_RST) {
-            TCP_DEBUG_INFO("RST flag set in packet.");
-            TCP_DEBUG_LEAVE;
-            return 0;
-        }
-        /* 2) Check ACK: if ACK is set: send RST with seq_no = ack_no and return */
-        if (ctl & MSK_ACK) {
-            _gnrc_tcp_pkt_build_reset_from_pkt(&out_pkt, in_pkt);
-            _gnrc_tcp_pkt_send(tcb, out_pkt, 0, false);
-            TCP_DEBUG_INFO("ACK flag set in packet. Send reset.");
-            TCP_DEBUG_LEAVE;
-            return 0;
-        }
-        /* 3) Check SYN: if SYN is set prepare for incoming connection */
-        if (ctl & MSK_SYN) {
-            uint16_t src = byteorder_ntohs(tcp_hdr->src_port);
-            uint16_t dst = byteorder_ntohs(tcp_hdr->dst_port);
-
-            /* Check if SYN request is handled by another connection */
-            lst = _gnrc_tcp_common_get_tcb_list()->head;
-            while (lst) {
-                /* Compare port numbers and network layer addresses */
-                if (lst->local_port == dst && lst->peer_port == src) {
-#ifdef MODULE_GNRC_IPV6
-                    if (snp->type == GNRC_NETTYPE_IPV6 && lst->address_family == AF_INET6) {
-                        ipv6_addr_t *dst_addr = &((ipv6_hdr_t *)ip)->dst;
-                        ipv6_addr_t *src_addr = &((ipv6_hdr_t *)ip)->src;
-
-                        if (ipv6_addr_equal((ipv6_addr_t *)lst->local_addr, dst_addr) &&
-                            ipv6_addr_equal((ipv6_addr_t *)lst->peer_addr, src_addr)) {
-                            break;
-                        }
-                    }
-#endif
-                }
-                lst = lst->next;
-            }
-            /* Return if connection is already handled (port and addresses match) */
-            /* cppcheck-suppress knownConditionTrueFalse
-             * (reason: tmp *lst* can be true at runtime
-             */
-            if (lst) {
-                TCP_DEBUG_INFO("Connection is handled by another TCB.");
-                TCP_DEBUG_LEAVE;
-                return 0;
-            }
-
-            /* SYN request is valid, fill TCB with connection information */
-#ifdef MODULE_GNRC_IPV6
-            if (snp->type == GNRC_NETTYPE_IPV6 && tcb->address_family == AF_INET6) {
-                memcpy(tcb->local_addr, &((ipv6_hdr_t *)ip)->dst, sizeof(ipv6_addr_t));
-                memcpy(tcb->peer_addr, &((ipv6_hdr_t *)ip)->src, sizeof(ipv6_addr_t));
-
-                /* In case peer_addr is link local: Store interface Id in TCB */
-                if (ipv6_addr_is_link_local((ipv6_addr_t *) tcb->peer_addr)) {
-                    gnrc_pktsnip_t *tmp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_NETIF);
-                    if (tmp == NULL) {
-                        TCP_DEBUG_ERROR("Packet contains no netif header.");
-                        TCP_DEBUG_LEAVE;
-                        return 0;
-                    }
-                    tcb->ll_iface = ((gnrc_netif_hdr_t *)tmp->data)->if_pid;
-                }
-            }
-#else
-            TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
-            TCP_DEBUG_LEAVE;
-            return 0;
-#endif
-
-            tcb->local_port = dst;
-            tcb->peer_port = src;
-            tcb->irs = byteorder_ntohl(tcp_hdr->seq_num);
-            tcb->rcv_nxt = tcb->irs + 1;
-            tcb->iss = random_uint32();
-            tcb->snd_una = tcb->iss;
-            tcb->snd_nxt = tcb->iss;
-            tcb->snd_wnd = seg_wnd;
-
-            /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
-            _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss,
-                                tcb->rcv_nxt, NULL, 0);
-            _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
-            _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-            _transition_to(tcb, FSM_STATE_SYN_RCVD);
-        }
-        TCP_DEBUG_LEAVE;
-        return 0;
-    }
     /* Handle state SYN_SENT */
-    else if (tcb->state == FSM_STATE_SYN_SENT) {
+    if (tcb->state == FSM_STATE_SYN_SENT) {
         /* 1) Check ACK */
         if (ctl & MSK_ACK) {
             /* If ACK is not acceptable ...*/
@@ -620,7 +875,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Set local network layer address accordingly */
 #ifdef MODULE_GNRC_IPV6
             if (snp->type == GNRC_NETTYPE_IPV6 && tcb->address_family == AF_INET6) {
+                /* The local address is part of the connection table hash */
+                _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+
+                mutex_lock(&list->lock);
+                _gnrc_tcp_common_conn_remove(tcb);
                 memcpy(tcb->local_addr, &((ipv6_hdr_t *)ip)->dst, sizeof(ipv6_addr_t));
+                _gnrc_tcp_common_conn_add(tcb);
+                mutex_unlock(&list->lock);
             }
 #else
             TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
@@ -646,6 +908,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->snd_wnd = seg_wnd;
             tcb->snd_wl1 = seg_seq;
             tcb->snd_wl2 = seg_ack;
+            _init_congestion_control(tcb);
         }
         TCP_DEBUG_LEAVE;
         return 0;
@@ -712,8 +975,15 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
+
                     tcb->snd_una = seg_ack;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+                    _gnrc_tcp_pkt_sack(tcb, sack, sack_len);
+                    _rcvd_new_ack(tcb, seg_ack, acked);
+
+                    /* Signal user after the retransmit queue drained */
+                    tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -723,6 +993,12 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     TCP_DEBUG_LEAVE;
                     return 0;
                 }
+                /* Duplicate ACK: The peer received a segment out of order */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && !(ctl & MSK_FIN) &&
+                         seg_wnd == tcb->snd_wnd && tcb->rtx_len > 0) {
+                    _gnrc_tcp_pkt_sack(tcb, sack, sack_len);
+                    _rcvd_dup_ack(tcb);
+                }
                 /* Update receive window */
                 if (LEQ_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     if (LSS_32_BIT(tcb->snd_wl1, seg_seq) || (tcb->snd_wl1 == seg_seq &&
@@ -738,25 +1014,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -775,13 +1051,16 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Search for begin of payload */
                 snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
 
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
+                /* Copy contents into receive buffer, data received out of order
+                 * is kept there until the data before it was received */
+                uint32_t seq = seg_seq;
+                size_t avail = 0;
+                while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+                    avail += _gnrc_tcp_rcvbuf_add(tcb, seq, snp->data, snp->size);
+                    seq += snp->size;
+                    snp = snp->next;
+                }
+                if (avail > 0) {
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
@@ -789,15 +1068,23 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                if (!(ctl & MSK_FIN) || LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
                     _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK,
                                         tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
                     _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
                 }
             }
         }
-        /* 7) Check FIN */
-        if (ctl & MSK_FIN) {
+        /* 7) Check FIN, it is processed after all data before it was received */
+        if ((ctl & MSK_FIN) && LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+            /* Acknowledge data received so far, if payload processing did not */
+            if (pay_len == 0) {
+                _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                    tcb->rcv_nxt, NULL, 0);
+                _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+            }
+        }
+        else if (ctl & MSK_FIN) {
             if (tcb->state == FSM_STATE_CLOSED || tcb->state == FSM_STATE_LISTEN ||
                 tcb->state == FSM_STATE_SYN_SENT) {
                 TCP_DEBUG_LEAVE;
@@ -813,7 +1100,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -827,11 +1114,66 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _restart_timewait_timer(tcb);
             }
         }
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+        /* Send buffered data the acknowledgement or window update allows */
+        _send_buffered(tcb);
+#endif
     }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief FSM handling function for the ACK completing a handshake of the SYN backlog.
+ *
+ * @param[in,out] tcb      Listening TCB to bind to the connection.
+ * @param[in]     in_pkt   Incoming ACK.
+ * @param[in]     req      Connection request completed by @p in_pkt.
+ *
+ * @returns   Zero on success.
+ *            -ENOTCONN if @p tcb is not listening anymore.
+ */
+static int _fsm_rcvd_handshake(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt,
+                               const gnrc_tcp_syn_req_t *req)
+{
+    TCP_DEBUG_ENTER;
+    /* The TCB might have been closed since it was picked */
+    if (tcb->state != FSM_STATE_LISTEN || !(tcb->status & STATUS_LISTENING)) {
+        TCP_DEBUG_ERROR("-ENOTCONN: TCB is not listening.");
+        TCP_DEBUG_LEAVE;
+        return -ENOTCONN;
+    }
+
+    /* Fill TCB with the connection information of the request */
+#ifdef MODULE_GNRC_IPV6
+    memcpy(tcb->local_addr, req->local_addr, sizeof(tcb->local_addr));
+    memcpy(tcb->peer_addr, req->peer_addr, sizeof(tcb->peer_addr));
+    if (ipv6_addr_is_link_local((ipv6_addr_t *) tcb->peer_addr)) {
+        tcb->ll_iface = req->ll_iface;
+    }
+#endif
+    tcb->peer_port = req->peer_port;
+    tcb->irs = req->irs;
+    tcb->rcv_nxt = req->irs + 1;
+    tcb->iss = req->iss;
+    tcb->snd_una = req->iss;
+    tcb->snd_nxt = req->iss + 1;
+    tcb->snd_wnd = req->snd_wnd;
+    if (req->mss) {
+        tcb->mss = req->mss;
+    }
+    tcb->status = (tcb->status & ~(STATUS_SACK | STATUS_WND_SCALE)) | req->status;
+    tcb->snd_wscale = req->snd_wscale;
+    tcb->rcv_wscale = (req->status & STATUS_WND_SCALE) ? _gnrc_tcp_option_rcv_wscale() : 0;
+    _init_congestion_control(tcb);
+
+    /* The SYN+ACK was sent by the queue, T: LISTEN -> SYN_RCVD */
+    _transition_to(tcb, FSM_STATE_SYN_RCVD);
+    int ret = _fsm_rcvd_pkt(tcb, in_pkt);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
 /**
  * @brief FSM handling function for timewait timeout handling.
  *
@@ -857,10 +1199,37 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->rtx_len > 0) {
+        gnrc_tcp_rtx_seg_t *seg = &tcb->rtx_queue[0];
+
+        /* Hold the slow start threshold if the segment timed out before (RFC 5681) */
+        if (tcb->retries == 0) {
+            _enter_recovery(tcb);
+        }
+        else {
+            tcb->status |= STATUS_RECOVERY;
+        }
+        /* Restart with slow start. The peer may discard data it selectively
+         * acknowledged, forget about it (RFC 2018) */
+        tcb->cwnd = _smss(tcb);
+        tcb->dup_acks = 0;
+        for (unsigned i = 0; i < tcb->rtx_len; i++) {
+            tcb->rtx_queue[i].sacked = false;
+        }
+        seg->retransmitted = true;
+        _gnrc_tcp_pkt_setup_retransmit(tcb, seg->pkt, true);
+        _gnrc_tcp_pkt_send(tcb, seg->pkt, 0, true);
+    }
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+    /* Persist timer expired: Probe the closed window of the peer */
+    else if (!ringbuffer_empty(&tcb->snd_buf) && tcb->snd_wnd == 0) {
+        _send_probe(tcb);
+        if (tcb->retries < UINT8_MAX) {
+            tcb->retries++;
+        }
+        _sched_persist(tcb);
     }
+#endif
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
     }
@@ -893,13 +1262,7 @@ static int _fsm_timeout_connection(gnrc_tcp_tcb_t *tcb)
 static int _fsm_send_probe(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    gnrc_pktsnip_t *out_pkt = NULL;  /* Outgoing packet */
-    uint8_t probe_pay[] = {1};       /* Probe payload */
-
-    /* The probe sends a already acknowledged sequence no. with a garbage byte. */
-    _gnrc_tcp_pkt_build(tcb, &out_pkt, NULL, MSK_ACK, tcb->snd_una - 1,
-                        tcb->rcv_nxt, probe_pay, sizeof(probe_pay));
-    _gnrc_tcp_pkt_send(tcb, out_pkt, 0, false);
+    _send_probe(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -958,6 +1321,9 @@ static int _fsm_unprotected(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
         case FSM_EVENT_RCVD_PKT :
             ret = _fsm_rcvd_pkt(tcb, in_pkt);
             break;
+        case FSM_EVENT_RCVD_HANDSHAKE :
+            ret = _fsm_rcvd_handshake(tcb, in_pkt, buf);
+            break;
         case FSM_EVENT_TIMEOUT_TIMEWAIT :
             ret = _fsm_timeout_timewait(tcb);
             break;
@@ -1011,6 +1377,20 @@ void _gnrc_tcp_fsm_set_mbox(gnrc_tcp_tcb_t *tcb, mbox_t *mbox)
     TCP_DEBUG_LEAVE;
 }
 
+void _gnrc_tcp_fsm_set_status(gnrc_tcp_tcb_t *tcb, uint16_t mask, bool set)
+{
+    TCP_DEBUG_ENTER;
+    mutex_lock(&(tcb->fsm_lock));
+    if (set) {
+        tcb->status |= mask;
+    }
+    else {
+        tcb->status &= ~mask;
+    }
+    mutex_unlock(&(tcb->fsm_lock));
+    TCP_DEBUG_LEAVE;
+}
+
 _gnrc_tcp_fsm_state_t _gnrc_tcp_fsm_get_state(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
@@ -1020,3 +1400,190 @@ _gnrc_tcp_fsm_state_t _gnrc_tcp_fsm_get_state(gnrc_tcp_tcb_t *tcb)
     TCP_DEBUG_LEAVE;
     return res;
 }
+
+#ifdef MODULE_GNRC_IPV6
+/**
+ * @brief Searches the SYN backlog for the handshake in progress with a peer.
+ *
+ * @param[in] queue       Listening queue holding the SYN backlog.
+ * @param[in] peer_addr   Address of the peer.
+ * @param[in] peer_port   Port number of the peer.
+ *
+ * @returns   Connection request of the peer, NULL if there is none.
+ */
+static gnrc_tcp_syn_req_t *_syn_backlog_find(gnrc_tcp_tcb_queue_t *queue,
+                                             const uint8_t *peer_addr, uint16_t peer_port)
+{
+    uint32_t now = evtimer_now_msec();
+
+    for (unsigned i = 0; i < CONFIG_GNRC_TCP_SYN_BACKLOG_SIZE; i++) {
+        gnrc_tcp_syn_req_t *req = &queue->syn_backlog[i];
+
+        /* Requests older than the connection timeout are expired */
+        if (req->peer_port != PORT_UNSPEC && req->peer_port == peer_port &&
+            memcmp(req->peer_addr, peer_addr, sizeof(req->peer_addr)) == 0 &&
+            now - req->time < CONFIG_GNRC_TCP_CONNECTION_TIMEOUT_DURATION_MS) {
+            return req;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Picks the SYN backlog entry for a new connection request.
+ *
+ * @param[in] queue   Listening queue holding the SYN backlog.
+ *
+ * @returns   A free entry if there is one, the oldest entry otherwise.
+ */
+static gnrc_tcp_syn_req_t *_syn_backlog_alloc(gnrc_tcp_tcb_queue_t *queue)
+{
+    uint32_t now = evtimer_now_msec();
+    gnrc_tcp_syn_req_t *oldest = &queue->syn_backlog[0];
+
+    for (unsigned i = 0; i < CONFIG_GNRC_TCP_SYN_BACKLOG_SIZE; i++) {
+        gnrc_tcp_syn_req_t *req = &queue->syn_backlog[i];
+
+        if (req->peer_port == PORT_UNSPEC) {
+            return req;
+        }
+        if (now - req->time > now - oldest->time) {
+            oldest = req;
+        }
+    }
+    return oldest;
+}
+
+/**
+ * @brief Picks a TCB of a listening queue that is not bound to a connection.
+ *
+ * @note The state is read without the FSM lock. Only the eventloop binds
+ *       listening TCBs, _fsm_rcvd_handshake() checks the state again.
+ *
+ * @param[in] queue   Listening queue.
+ *
+ * @returns   A listening TCB, NULL if all TCBs of @p queue are in use.
+ */
+static gnrc_tcp_tcb_t *_listening_tcb(gnrc_tcp_tcb_queue_t *queue)
+{
+    for (size_t i = 0; i < queue->tcbs_len; i++) {
+        if (queue->tcbs[i].state == FSM_STATE_LISTEN) {
+            return &queue->tcbs[i];
+        }
+    }
+    return NULL;
+}
+#endif
+
+int _gnrc_tcp_fsm_listen(gnrc_pktsnip_t *in_pkt)
+{
+    TCP_DEBUG_ENTER;
+#ifdef MODULE_GNRC_IPV6
+    gnrc_pktsnip_t *out_pkt = NULL;  /* Outgoing packet */
+    gnrc_tcp_tcb_t *tcb = NULL;      /* TCB to bind to a completed handshake */
+    gnrc_tcp_syn_req_t bound;        /* Request of the completed handshake */
+    int ret = 0;
+
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_TCP);
+    tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
+    snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_IPV6);
+    ipv6_hdr_t *ip6_hdr = (ipv6_hdr_t *) snp->data;
+
+    uint16_t ctl = byteorder_ntohs(tcp_hdr->off_ctl);
+    uint16_t src = byteorder_ntohs(tcp_hdr->src_port);
+    uint16_t dst = byteorder_ntohs(tcp_hdr->dst_port);
+    uint32_t seg_seq = byteorder_ntohl(tcp_hdr->seq_num);
+    uint32_t seg_ack = byteorder_ntohl(tcp_hdr->ack_num);
+
+    _gnrc_tcp_common_tcb_list_t *list = _gnrc_tcp_common_get_tcb_list();
+    mutex_lock(&list->lock);
+
+    gnrc_tcp_tcb_queue_t *queue = _gnrc_tcp_common_queue_find(ip6_hdr->dst.u8, dst);
+    if (queue == NULL) {
+        mutex_unlock(&list->lock);
+        TCP_DEBUG_INFO("No queue is listening.");
+        TCP_DEBUG_LEAVE;
+        return -ENOTCONN;
+    }
+    gnrc_tcp_syn_req_t *req = _syn_backlog_find(queue, ip6_hdr->src.u8, src);
+
+    /* 1) Check RST: if RST is set: Drop the connection request */
+    if (ctl & MSK_RST) {
+        if (req != NULL) {
+            req->peer_port = PORT_UNSPEC;
+        }
+    }
+    /* 2) Check ACK: if ACK completes a handshake: Bind a TCB, otherwise send reset */
+    else if (ctl & MSK_ACK) {
+        if (req == NULL || (ctl & MSK_SYN) || seg_ack != req->iss + 1) {
+            TCP_DEBUG_INFO("ACK does not complete a handshake.");
+            ret = -ENOTCONN;
+        }
+        else if ((tcb = _listening_tcb(queue)) != NULL) {
+            bound = *req;
+            req->peer_port = PORT_UNSPEC;
+        }
+        else {
+            /* Keep the request, the peer repeats the ACK with its next segment */
+            TCP_DEBUG_INFO("All TCBs of the queue are in use.");
+        }
+    }
+    /* 3) Check SYN: Store the connection request and send SYN+ACK */
+    else if (ctl & MSK_SYN) {
+        /* A retransmitted SYN is answered with the same SYN+ACK */
+        if (req == NULL || req->irs != seg_seq) {
+            if (req == NULL) {
+                req = _syn_backlog_alloc(queue);
+            }
+            memcpy(req->local_addr, &ip6_hdr->dst, sizeof(req->local_addr));
+            memcpy(req->peer_addr, &ip6_hdr->src, sizeof(req->peer_addr));
+            req->ll_iface = 0;
+            req->peer_port = src;
+            req->irs = seg_seq;
+            req->iss = random_uint32();
+            req->snd_wnd = byteorder_ntohs(tcp_hdr->window);
+            req->mss = 0;
+            req->time = evtimer_now_msec();
+
+            /* In case peer_addr is link local: Store interface Id in the request */
+            if (ipv6_addr_is_link_local(&ip6_hdr->src)) {
+                snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_NETIF);
+                if (snp == NULL) {
+                    TCP_DEBUG_ERROR("Packet contains no netif header.");
+                    req->peer_port = PORT_UNSPEC;
+                }
+                else {
+                    req->ll_iface = ((gnrc_netif_hdr_t *)snp->data)->if_pid;
+                }
+            }
+            if (req->peer_port != PORT_UNSPEC && _gnrc_tcp_option_parse_syn(req, tcp_hdr) < 0) {
+                TCP_DEBUG_ERROR("Failed to parse TCP header options.");
+                req->peer_port = PORT_UNSPEC;
+            }
+        }
+        if (req->peer_port != PORT_UNSPEC) {
+            _gnrc_tcp_pkt_build_syn_ack_from_pkt(&out_pkt, in_pkt, req);
+        }
+    }
+    mutex_unlock(&list->lock);
+
+    /* Send SYN+ACK, it is not retransmitted: A retransmitted SYN repeats it */
+    if (out_pkt != NULL &&
+        !gnrc_netapi_dispatch_send(GNRC_NETTYPE_TCP, GNRC_NETREG_DEMUX_CTX_ALL, out_pkt)) {
+        TCP_DEBUG_ERROR("Can't dispatch to network layer.");
+        gnrc_pktbuf_release(out_pkt);
+    }
+
+    /* Bind TCB to the completed handshake */
+    if (tcb != NULL) {
+        ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_RCVD_HANDSHAKE, in_pkt, &bound, sizeof(bound));
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+#else
+    (void)in_pkt;
+    TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
+    TCP_DEBUG_LEAVE;
+    return -ENOTCONN;
+#endif
+}
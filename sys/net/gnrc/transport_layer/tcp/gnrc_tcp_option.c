@@ -17,16 +17,40 @@
  * @}
  */
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_fsm.h"
 #include "include/gnrc_tcp_option.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+/**
+ * @brief Parses options of a given TCP header.
+ *
+ * @param[in]     hdr          TCP header to be parsed.
+ * @param[in]     negotiate    The header is a SYN of the handshake, which
+ *                             negotiates the options of the connection.
+ * @param[in,out] status       Status flags, SACK and window scaling are set
+ *                             if @p negotiate and the SYN offers them.
+ * @param[out]    mss          MSS of the peer, if @p negotiate and the header
+ *                             contains it.
+ * @param[out]    snd_wscale   Window scale shift count of the peer, if
+ *                             @p negotiate and the SYN offers window scaling.
+ * @param[out]    sack         SACK blocks of the header, if SACK was negotiated.
+ *                             May be NULL to ignore SACK blocks.
+ * @param[out]    sack_len     Number of blocks in @p sack.
+ *
+ * @returns   Zero on success.
+ *            Negative value on error.
+ */
+static int _parse(tcp_hdr_t *hdr, bool negotiate, uint16_t *status, uint16_t *mss,
+                  uint8_t *snd_wscale, gnrc_tcp_sack_block_t *sack, uint8_t *sack_len)
 {
     TCP_DEBUG_ENTER;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+    *sack_len = 0;
+
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         TCP_DEBUG_LEAVE;
         return 0;
@@ -61,7 +85,60 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                     return -1;
                 }
                 TCP_DEBUG_INFO("MSS option found.");
-                tcb->mss = (option->value[0] << 8) | option->value[1];
+                if (negotiate) {
+                    *mss = (option->value[0] << 8) | option->value[1];
+                }
+                break;
+
+            case TCP_OPTION_KIND_WS:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_WS) {
+                    TCP_DEBUG_ERROR("Invalid window scale option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("Window scale option found.");
+                /* Scale windows only if both SYNs carry the option */
+                if (negotiate && IS_ACTIVE(CONFIG_GNRC_TCP_WND_SCALE_EN)) {
+                    *status |= STATUS_WND_SCALE;
+                    *snd_wscale = (option->value[0] < TCP_OPTION_WS_MAX) ?
+                                  option->value[0] : TCP_OPTION_WS_MAX;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    TCP_DEBUG_ERROR("Invalid SACK permitted option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK permitted option found.");
+                if (negotiate) {
+                    *status |= STATUS_SACK;
+                }
+                break;
+
+            case TCP_OPTION_KIND_SACK:
+                if (opt_left < TCP_OPTION_LENGTH_MIN || option->length > opt_left ||
+                    option->length < TCP_OPTION_LENGTH_MIN + TCP_OPTION_SACK_BLOCK_SIZE ||
+                    (option->length - TCP_OPTION_LENGTH_MIN) % TCP_OPTION_SACK_BLOCK_SIZE) {
+                    TCP_DEBUG_ERROR("Invalid SACK option length.");
+                    TCP_DEBUG_LEAVE;
+                    return -1;
+                }
+                TCP_DEBUG_INFO("SACK option found.");
+                if (sack != NULL && (*status & STATUS_SACK)) {
+                    uint8_t *block = option->value;
+                    uint8_t *end = opt_ptr + option->length;
+
+                    while (block < end && *sack_len < TCP_OPTION_SACK_BLOCKS_MAX) {
+                        sack[*sack_len].left = byteorder_bebuftohl(block);
+                        sack[*sack_len].right = byteorder_bebuftohl(block + 4);
+                        *sack_len += 1;
+                        block += TCP_OPTION_SACK_BLOCK_SIZE;
+                    }
+                }
                 break;
 
             default:
@@ -83,3 +160,47 @@ int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     TCP_DEBUG_LEAVE;
     return 0;
 }
+
+int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr,
+                           gnrc_tcp_sack_block_t *sack, uint8_t *sack_len)
+{
+    TCP_DEBUG_ENTER;
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+
+    /* Only a SYN of the handshake negotiates window scaling, SACK and the MSS.
+     * A SYN in any later state must not change what was negotiated. */
+    bool negotiate = (ctl & MSK_SYN) &&
+                     ((tcb->state == FSM_STATE_LISTEN) ||
+                      (tcb->state == FSM_STATE_SYN_SENT) ||
+                      (tcb->state == FSM_STATE_SYN_RCVD));
+
+    /* Clear what was offered before */
+    if (negotiate) {
+        tcb->status &= ~(STATUS_SACK | STATUS_WND_SCALE);
+        tcb->snd_wscale = 0;
+        tcb->rcv_wscale = 0;
+    }
+
+    int ret = _parse(hdr, negotiate, &tcb->status, &tcb->mss, &tcb->snd_wscale,
+                     sack, sack_len);
+
+    /* Scale the receive window only if both SYNs carry the option */
+    if (negotiate && (tcb->status & STATUS_WND_SCALE)) {
+        tcb->rcv_wscale = _gnrc_tcp_option_rcv_wscale();
+    }
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+int _gnrc_tcp_option_parse_syn(gnrc_tcp_syn_req_t *req, tcp_hdr_t *hdr)
+{
+    TCP_DEBUG_ENTER;
+    uint8_t sack_len = 0;
+
+    req->status = 0;
+    req->snd_wscale = 0;
+    int ret = _parse(hdr, true, &req->status, &req->mss, &req->snd_wscale, NULL,
+                     &sack_len);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
@@ -49,6 +49,126 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Calculates the window field of an outgoing segment.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ * @param[in] ctl   Control bits of the outgoing segment.
+ *
+ * @returns   Receive window, never scaled in a SYN.
+ */
+static uint16_t _wnd(const gnrc_tcp_tcb_t *tcb, const uint16_t ctl)
+{
+    uint32_t wnd = (ctl & MSK_SYN) ? tcb->rcv_wnd : (tcb->rcv_wnd >> tcb->rcv_wscale);
+    return (wnd < UINT16_MAX) ? wnd : UINT16_MAX;
+}
+
+/**
+ * @brief Calculates the header offset of a SYN.
+ *
+ * @param[in] status   Status flags holding the options to offer.
+ *
+ * @returns   Header offset including the options.
+ */
+static uint8_t _syn_offset(const uint16_t status)
+{
+    uint8_t offset = TCP_HDR_OFFSET_MIN + 1;
+
+    if (status & STATUS_WND_SCALE) {
+        offset += 1;
+    }
+    if (status & STATUS_SACK) {
+        offset += 1;
+    }
+    return offset;
+}
+
+/**
+ * @brief Writes the options of a SYN: MSS, window scale and SACK permitted.
+ *
+ * @param[out] opt_ptr   Option field of the header.
+ * @param[in]  status    Status flags holding the options to offer.
+ */
+static void _syn_options(uint8_t *opt_ptr, const uint16_t status)
+{
+    network_uint32_t mss_option = byteorder_htonl(
+        _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
+
+    memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+    opt_ptr += sizeof(mss_option);
+
+    if (status & STATUS_WND_SCALE) {
+        network_uint32_t ws_option = byteorder_htonl(
+            _gnrc_tcp_option_build_ws(_gnrc_tcp_option_rcv_wscale()));
+
+        memcpy(opt_ptr, &ws_option, sizeof(ws_option));
+        opt_ptr += sizeof(ws_option);
+    }
+    if (status & STATUS_SACK) {
+        network_uint32_t sack_perm_option = byteorder_htonl(
+            _gnrc_tcp_option_build_sack_perm());
+
+        memcpy(opt_ptr, &sack_perm_option, sizeof(sack_perm_option));
+    }
+}
+
+/**
+ * @brief Prepends the network layer header of a reply to a received packet.
+ *
+ * @param[out] out_pkt   Reply with all headers, NULL on error.
+ * @param[in]  tcp_snp   TCP header of the reply, released on error.
+ * @param[in]  in_pkt    Received packet.
+ *
+ * @returns   Zero on success.
+ *            -ENOMEM if pktbuf is full.
+ */
+static int _build_reply_hdrs(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *tcp_snp,
+                             gnrc_pktsnip_t *in_pkt)
+{
+    *out_pkt = tcp_snp;
+#ifdef MODULE_GNRC_IPV6
+    gnrc_pktsnip_t *ip6_snp = gnrc_pktsnip_search_type(in_pkt,
+                                                       GNRC_NETTYPE_IPV6);
+    ipv6_hdr_t *ip6_hdr = (ipv6_hdr_t *)ip6_snp->data;
+
+    /* Build new network layer header */
+    ip6_snp = gnrc_ipv6_hdr_build(tcp_snp, &(ip6_hdr->dst), &(ip6_hdr->src));
+    if (ip6_snp == NULL) {
+        gnrc_pktbuf_release(tcp_snp);
+        *(out_pkt) = NULL;
+        TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for IPv6 header.");
+        return -ENOMEM;
+    }
+    *out_pkt = ip6_snp;
+
+    /* Add netif header in case the receiver addr sent from a link local address */
+    if (ipv6_addr_is_link_local(&ip6_hdr->src)) {
+
+        /* Search for netif header in received packet */
+        gnrc_pktsnip_t *net_snp = gnrc_pktsnip_search_type(in_pkt,
+                                                           GNRC_NETTYPE_NETIF);
+        gnrc_netif_hdr_t *net_hdr = (gnrc_netif_hdr_t *)net_snp->data;
+
+        /* Allocate new header and set interface id */
+        net_snp = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+        if (net_snp == NULL) {
+            gnrc_pktbuf_release(ip6_snp);
+            *(out_pkt) = NULL;
+            TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for netif header.");
+            return -ENOMEM;
+        }
+        else {
+            ((gnrc_netif_hdr_t *)net_snp->data)->if_pid = net_hdr->if_pid;
+            *(out_pkt) = gnrc_pkt_prepend(ip6_snp, net_snp);
+        }
+    }
+#else
+    (void)in_pkt;
+    TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
+#endif
+    return 0;
+}
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -59,11 +179,6 @@ int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
     gnrc_pktsnip_t *tcp_snp = gnrc_pktsnip_search_type(in_pkt,
                                                        GNRC_NETTYPE_TCP);
     tcp_hdr_t *tcp_hdr_in = (tcp_hdr_t *)tcp_snp->data;
-#ifdef MODULE_GNRC_IPV6
-    gnrc_pktsnip_t *ip6_snp = gnrc_pktsnip_search_type(in_pkt,
-                                                       GNRC_NETTYPE_IPV6);
-    ipv6_hdr_t *ip6_hdr = (ipv6_hdr_t *)ip6_snp->data;
-#endif
 
     /* Setup header information */
     tcp_hdr_out.src_port = tcp_hdr_in->dst_port;
@@ -102,47 +217,55 @@ int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
     }
-    *out_pkt = tcp_snp;
 
-    /* Build new network layer header */
-#ifdef MODULE_GNRC_IPV6
-    ip6_snp = gnrc_ipv6_hdr_build(tcp_snp, &(ip6_hdr->dst), &(ip6_hdr->src));
-    if (ip6_snp == NULL) {
-        gnrc_pktbuf_release(tcp_snp);
+    /* Build network layer header */
+    int ret = _build_reply_hdrs(out_pkt, tcp_snp, in_pkt);
+    TCP_DEBUG_LEAVE;
+    return ret;
+}
+
+int _gnrc_tcp_pkt_build_syn_ack_from_pkt(gnrc_pktsnip_t **out_pkt,
+                                         gnrc_pktsnip_t *in_pkt,
+                                         const gnrc_tcp_syn_req_t *req)
+{
+    TCP_DEBUG_ENTER;
+    tcp_hdr_t tcp_hdr_out;
+    uint8_t offset = _syn_offset(req->status);
+
+    /* Extract header */
+    gnrc_pktsnip_t *tcp_snp = gnrc_pktsnip_search_type(in_pkt,
+                                                       GNRC_NETTYPE_TCP);
+    tcp_hdr_t *tcp_hdr_in = (tcp_hdr_t *)tcp_snp->data;
+
+    /* Setup header information, the window of a SYN is never scaled */
+    tcp_hdr_out.src_port = tcp_hdr_in->dst_port;
+    tcp_hdr_out.dst_port = tcp_hdr_in->src_port;
+    tcp_hdr_out.seq_num = byteorder_htonl(req->iss);
+    tcp_hdr_out.ack_num = byteorder_htonl(req->irs + 1);
+    tcp_hdr_out.off_ctl = byteorder_htons(
+        _gnrc_tcp_option_build_offset_control(offset, MSK_SYN_ACK));
+    tcp_hdr_out.window = byteorder_htons((CONFIG_GNRC_TCP_DEFAULT_WINDOW < UINT16_MAX) ?
+                                         CONFIG_GNRC_TCP_DEFAULT_WINDOW : UINT16_MAX);
+    tcp_hdr_out.checksum = byteorder_htons(0);
+    tcp_hdr_out.urgent_ptr = byteorder_htons(0);
+
+    /* Allocate new TCP header with the options offered in the SYN */
+    tcp_snp = gnrc_pktbuf_add(NULL, NULL, offset * 4, GNRC_NETTYPE_TCP);
+    if (tcp_snp == NULL) {
         *(out_pkt) = NULL;
-        TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for IPv6 header.");
+        TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for TCP header.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
     }
-    *out_pkt = ip6_snp;
-
-    /* Add netif header in case the receiver addr sent from a link local address */
-    if (ipv6_addr_is_link_local(&ip6_hdr->src)) {
+    memcpy(tcp_snp->data, &tcp_hdr_out, sizeof(tcp_hdr_out));
+    memset((uint8_t *)tcp_snp->data + sizeof(tcp_hdr_out), TCP_OPTION_KIND_EOL,
+           offset * 4 - sizeof(tcp_hdr_out));
+    _syn_options((uint8_t *)tcp_snp->data + sizeof(tcp_hdr_out), req->status);
 
-        /* Search for netif header in received packet */
-        gnrc_pktsnip_t *net_snp = gnrc_pktsnip_search_type(in_pkt,
-                                                           GNRC_NETTYPE_NETIF);
-        gnrc_netif_hdr_t *net_hdr = (gnrc_netif_hdr_t *)net_snp->data;
-
-        /* Allocate new header and set interface id */
-        net_snp = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
-        if (net_snp == NULL) {
-            gnrc_pktbuf_release(ip6_snp);
-            *(out_pkt) = NULL;
-            TCP_DEBUG_ERROR("-ENOMEM: Can't alloc buffer for netif header.");
-            TCP_DEBUG_LEAVE;
-            return -ENOMEM;
-        }
-        else {
-            ((gnrc_netif_hdr_t *)net_snp->data)->if_pid = net_hdr->if_pid;
-            *(out_pkt) = gnrc_pkt_prepend(ip6_snp, net_snp);
-        }
-    }
-#else
-    TCP_DEBUG_ERROR("Missing network layer. Add module to makefile.");
-#endif
+    /* Build network layer header */
+    int ret = _build_reply_hdrs(out_pkt, tcp_snp, in_pkt);
     TCP_DEBUG_LEAVE;
-    return 0;
+    return ret;
 }
 
 int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
@@ -156,8 +279,8 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr_t tcp_hdr;
     uint8_t offset = TCP_HDR_OFFSET_MIN;
 
-    /* Add payload, if supplied */
-    if (payload != NULL && payload_len > 0) {
+    /* Add payload, if supplied, uninitialized if there is no payload buffer */
+    if (payload_len > 0) {
         pay_snp = gnrc_pktbuf_add(pay_snp, payload, payload_len, GNRC_NETTYPE_UNDEF);
         if (pay_snp == NULL) {
             *(out_pkt) = NULL;
@@ -173,13 +296,17 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
     tcp_hdr.checksum = byteorder_htons(0);
     tcp_hdr.seq_num = byteorder_htonl(seq_num);
     tcp_hdr.ack_num = byteorder_htonl(ack_num);
-    tcp_hdr.window = byteorder_htons(tcb->rcv_wnd);
+    tcp_hdr.window = byteorder_htons(_wnd(tcb, ctl));
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
+    /* Add MSS option if SYN is sent, window scale and SACK permitted if offered */
     if (ctl & MSK_SYN) {
-        offset += 1;
+        offset = _syn_offset(tcb->status);
+    }
+    /* Add SACK option if blocks were received out of order */
+    else if ((ctl & MSK_ACK) && !(ctl & MSK_RST) && (tcb->status & STATUS_SACK)) {
+        offset += (tcb->sack_len > 0) ? 1 + 2 * tcb->sack_len : 0;
     }
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(
@@ -211,15 +338,27 @@ int _gnrc_tcp_pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt,
             /* Init options field with 'End Of List' - option (0) */
             memset(opt_ptr, TCP_OPTION_KIND_EOL, opt_left);
 
-            /* If SYN flag is set: Add MSS option */
+            /* If SYN flag is set: Add MSS option and the offered options */
             if (ctl & MSK_SYN) {
-                network_uint32_t mss_option = byteorder_htonl(
-                    _gnrc_tcp_option_build_mss(CONFIG_GNRC_TCP_MSS));
-
-                memcpy(opt_ptr, &mss_option, sizeof(mss_option));
+                _syn_options(opt_ptr, tcb->status);
+            }
+            /* Else add SACK option, the most recently received block first */
+            else {
+                network_uint32_t sack_option = byteorder_htonl(
+                    _gnrc_tcp_option_build_sack(tcb->sack_len));
+
+                memcpy(opt_ptr, &sack_option, sizeof(sack_option));
+                opt_ptr += sizeof(sack_option);
+                for (unsigned i = 0; i < tcb->sack_len; i++) {
+                    network_uint32_t edges[] = {
+                        byteorder_htonl(tcb->sack[i].left),
+                        byteorder_htonl(tcb->sack[i].right),
+                    };
+
+                    memcpy(opt_ptr, edges, sizeof(edges));
+                    opt_ptr += sizeof(edges);
+                }
             }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
-            /* NOTE: Add additional options here */
         }
         *(out_pkt) = tcp_snp;
     }
@@ -285,14 +424,19 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number and measure time,
+     * unless the round trip time of another segment is measured */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
+        if (seq_con > 0 && !(tcb->status & STATUS_RTT_PENDING)) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_start = evtimer_now_msec();
+            tcb->rtt_seq = tcb->snd_nxt;
+        }
     }
+    /* Retransmitted segments are not measured (Karns Algorithm) */
     else {
-        tcb->retries += 1;
+        tcb->status &= ~STATUS_RTT_PENDING;
     }
 
     /* Pass packet down the network stack */
@@ -376,6 +520,51 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief Calculates the retransmission timeout and (re)starts the retransmission timer.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     backoff   Flag used to indicate that the timer expired before.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb, const bool backoff)
+{
+    /* RTO adjustment */
+    if (!backoff) {
+        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
+        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+        }
+        else {
+            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+        }
+    }
+    else {
+        /* If this is a retransmission: Double the rto (Timer Backoff) */
+        tcb->rto *= 2;
+
+        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+        /* New measurements must be taken the next time something is sent. */
+        if (tcb->retries >= 5) {
+            tcb->srtt = RTO_UNINITIALIZED;
+            tcb->rtt_var = RTO_UNINITIALIZED;
+        }
+    }
+
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
 int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit)
 {
@@ -391,8 +580,17 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    /* A retransmission consumes a user of the packet in the retransmit queue */
+    if (retransmit) {
+        gnrc_pktbuf_hold(pkt, 1);
+        tcb->retries += 1;
+        _sched_retransmit(tcb, true);
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    /* Check if retransmit queue is full */
+    if (tcb->rtx_len >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -415,44 +613,19 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Append pkt and increase users: every send attempt consumes a user */
+    gnrc_tcp_rtx_seg_t *seg = &tcb->rtx_queue[tcb->rtx_len++];
+    seg->pkt = pkt;
+    seg->seq = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+    seg->len = _gnrc_tcp_pkt_get_seg_len(pkt);
+    seg->sacked = false;
+    seg->retransmitted = false;
     gnrc_pktbuf_hold(pkt, 1);
 
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
+    /* Start the retransmission timer, if it is not running for an older segment */
+    if (tcb->rtx_len == 1) {
+        _sched_retransmit(tcb, false);
     }
-    else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
-
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
-        }
-    }
-
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
-    }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -460,41 +633,41 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    unsigned acked = 0;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
+    /* Release all segments that were acknowledged from pktbuf */
+    while (acked < tcb->rtx_len) {
+        gnrc_tcp_rtx_seg_t *seg = &tcb->rtx_queue[acked];
+
+        if (!LEQ_32_BIT(seg->seq + seg->len, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(seg->pkt);
+        acked++;
+    }
+    if (acked == 0) {
         TCP_DEBUG_LEAVE;
-        return -EINVAL;
+        return 0;
     }
+    tcb->rtx_len -= acked;
+    memmove(tcb->rtx_queue, &tcb->rtx_queue[acked],
+            tcb->rtx_len * sizeof(tcb->rtx_queue[0]));
+    tcb->retries = 0;
 
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
-
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
+    /* Measure round trip time, if the measured segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
 
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
+        tcb->status &= ~STATUS_RTT_PENDING;
+        /* Use time only if there was no timer overflow */
+        if (rtt > 0) {
             /* If this is the first sample taken */
             if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
                 tcb->srtt = rtt;
@@ -509,10 +682,41 @@ int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
             }
         }
     }
+
+    /* Stop timer if everything was acknowledged, restart it for the remaining segments if not */
+    if (tcb->rtx_len == 0) {
+        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    }
+    else {
+        _sched_retransmit(tcb, false);
+    }
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_sack_block_t *sack,
+                        const uint8_t sack_len)
+{
+    TCP_DEBUG_ENTER;
+    for (unsigned i = 0; i < sack_len; i++) {
+        /* Ignore blocks reporting duplicates or data that was not sent */
+        if (LEQ_32_BIT(sack[i].right, sack[i].left) ||
+            LSS_32_BIT(sack[i].left, tcb->snd_una) ||
+            LSS_32_BIT(tcb->snd_nxt, sack[i].right)) {
+            continue;
+        }
+        for (unsigned j = 0; j < tcb->rtx_len; j++) {
+            gnrc_tcp_rtx_seg_t *seg = &tcb->rtx_queue[j];
+
+            if (LEQ_32_BIT(sack[i].left, seg->seq) &&
+                LEQ_32_BIT(seg->seq + seg->len, sack[i].right)) {
+                seg->sacked = true;
+            }
+        }
+    }
+    TCP_DEBUG_LEAVE;
+}
+
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
                                  const gnrc_pktsnip_t *pseudo_hdr,
                                  const gnrc_pktsnip_t *payload)
@@ -18,6 +18,7 @@
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_rcvbuf.h"
@@ -124,3 +125,100 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+/**
+ * @brief Writes data behind the data available in a ringbuffer.
+ *
+ * @param[in,out] rb       Ringbuffer to write into.
+ * @param[in]     offset   Offset of @p data behind the available data.
+ * @param[in]     data     Data to write.
+ * @param[in]     len      Number of bytes in @p data.
+ */
+static void _write_at(ringbuffer_t *rb, size_t offset, const uint8_t *data, size_t len)
+{
+    size_t pos = (rb->start + rb->avail + offset) % rb->size;
+
+    while (len > 0) {
+        size_t chunk = (len < rb->size - pos) ? len : rb->size - pos;
+
+        memcpy(rb->buf + pos, data, chunk);
+        data += chunk;
+        len -= chunk;
+        pos = 0;
+    }
+}
+
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, uint32_t seq, const uint8_t *data,
+                            size_t len)
+{
+    TCP_DEBUG_ENTER;
+    ringbuffer_t *rb = &tcb->rcv_buf;
+    size_t free = ringbuffer_get_free(rb);
+
+    /* Skip data that was received before */
+    if (LSS_32_BIT(seq, tcb->rcv_nxt)) {
+        uint32_t dup = tcb->rcv_nxt - seq;
+
+        if (dup >= len) {
+            TCP_DEBUG_LEAVE;
+            return 0;
+        }
+        seq += dup;
+        data += dup;
+        len -= dup;
+    }
+
+    /* Cut off data that does not fit into the receive buffer */
+    uint32_t offset = seq - tcb->rcv_nxt;
+    if (offset >= free) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    len = (len < free - offset) ? len : free - offset;
+
+    /* Merge all blocks overlapping or adjacent to the received data */
+    uint32_t left = seq;
+    uint32_t right = seq + len;
+    unsigned merged = 0;
+    for (unsigned i = 0; i < tcb->sack_len;) {
+        gnrc_tcp_sack_block_t *block = &tcb->sack[i];
+
+        if (LEQ_32_BIT(block->left, right) && LEQ_32_BIT(left, block->right)) {
+            left = LSS_32_BIT(block->left, left) ? block->left : left;
+            right = LSS_32_BIT(right, block->right) ? block->right : right;
+            tcb->sack_len--;
+            memmove(block, block + 1, (tcb->sack_len - i) * sizeof(*block));
+            merged++;
+        }
+        else {
+            i++;
+        }
+    }
+
+    /* Drop data out of order, if there is no block left to track it */
+    if (left != tcb->rcv_nxt && merged == 0 &&
+        tcb->sack_len >= CONFIG_GNRC_TCP_SACK_BLOCKS) {
+        TCP_DEBUG_INFO("No SACK block left, dropping data.");
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+    _write_at(rb, offset, data, len);
+
+    /* Hand all data received in order to the user */
+    if (left == tcb->rcv_nxt) {
+        size_t avail = right - left;
+
+        rb->avail += avail;
+        tcb->rcv_nxt = right;
+        TCP_DEBUG_LEAVE;
+        return avail;
+    }
+
+    /* Track data received out of order, as the most recent block */
+    memmove(&tcb->sack[1], &tcb->sack[0], tcb->sack_len * sizeof(tcb->sack[0]));
+    tcb->sack[0].left = left;
+    tcb->sack[0].right = right;
+    tcb->sack_len++;
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
@@ -46,6 +46,13 @@ extern "C" {
 #define STATUS_NOTIFY_USER    (1 << 2) /**< Internal: Status bitmask NOTIFY_USER */
 #define STATUS_ACCEPTED       (1 << 3) /**< Internal: Status bitmask ACCEPTED */
 #define STATUS_LOCKED         (1 << 4) /**< Internal: Status bitmask LOCKED */
+#define STATUS_SACK           (1 << 5) /**< Internal: Status bitmask SACK */
+#define STATUS_WND_SCALE      (1 << 6) /**< Internal: Status bitmask WND_SCALE */
+#define STATUS_RECOVERY       (1 << 7) /**< Internal: Status bitmask RECOVERY */
+#define STATUS_RTT_PENDING    (1 << 8) /**< Internal: Status bitmask RTT_PENDING */
+#define STATUS_NODELAY        (1 << 9) /**< Internal: Status bitmask NODELAY */
+#define STATUS_CORK           (1 << 10) /**< Internal: Status bitmask CORK */
+#define STATUS_FIN_PENDING    (1 << 11) /**< Internal: Status bitmask FIN_PENDING */
 /** @} */
 
 /**
@@ -100,7 +107,7 @@ extern "C" {
 #define LSS_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <  0) /**< Internal: operator < */
 #define LEQ_32_BIT(x, y) (((int32_t) (x)) - ((int32_t) (y)) <= 0) /**< Internal: operator <= */
 #define GRT_32_BIT(x, y) (!LEQ_32_BIT(x, y)) /**< Internal: operator > */
-#define GEQ_32_BIT(x, y) (!LSS_32_BOT(x, y)) /**< Internal: operator >= */
+#define GEQ_32_BIT(x, y) (!LSS_32_BIT(x, y)) /**< Internal: operator >= */
 /** @} */
 
 /**
@@ -145,12 +152,20 @@ extern "C" {
 #define TCP_DEBUG_INFO(msg) DEBUG("GNRC_TCP: Info: \"%s\", Func: %s, File: %s(%d)\n", \
                                   msg, DEBUG_FUNC, __FILE__, __LINE__)
 
+/**
+ * @brief Number of buckets of the connection table.
+ */
+#define TCP_CONN_TABLE_SIZE (1 << CONFIG_GNRC_TCP_CONN_TABLE_SIZE_EXP)
+
 /**
  * @brief TCB list type.
  */
 typedef struct {
-    gnrc_tcp_tcb_t *head; /**< Head of TCB list */
-    mutex_t lock;         /**< Lock of TCB list */
+    gnrc_tcp_tcb_t *head;                       /**< Head of TCB list */
+    gnrc_tcp_tcb_t *table[TCP_CONN_TABLE_SIZE]; /**< Connected TCBs by hash of
+                                                     their addresses and ports */
+    gnrc_tcp_tcb_queue_t *queues;               /**< Head of listening queues */
+    mutex_t lock;                               /**< Lock of TCB list */
 } _gnrc_tcp_common_tcb_list_t;
 
 /**
@@ -160,6 +175,57 @@ typedef struct {
  */
 _gnrc_tcp_common_tcb_list_t *_gnrc_tcp_common_get_tcb_list(void);
 
+/**
+ * @brief Adds a TCB to the connection table, if it is not in there yet.
+ *
+ * @note Must be called from a context where the TCB list is locked.
+ *
+ * @param[in] tcb   TCB with addresses and port numbers set.
+ */
+void _gnrc_tcp_common_conn_add(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Removes a TCB from the connection table, if it is in there.
+ *
+ * @note Must be called from a context where the TCB list is locked.
+ *
+ * @param[in] tcb   TCB to remove.
+ */
+void _gnrc_tcp_common_conn_remove(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Searches the connection table for the TCB of a received segment.
+ *
+ * A TCB without local address, i.e. an active open waiting for the SYN+ACK,
+ * matches segments to any local address.
+ *
+ * @note Must be called from a context where the TCB list is locked.
+ *
+ * @param[in] local_addr   Destination address of the segment.
+ * @param[in] peer_addr    Source address of the segment.
+ * @param[in] local_port   Destination port of the segment.
+ * @param[in] peer_port    Source port of the segment.
+ *
+ * @returns   TCB of the connection, NULL if there is none.
+ */
+gnrc_tcp_tcb_t *_gnrc_tcp_common_conn_find(const uint8_t *local_addr,
+                                           const uint8_t *peer_addr,
+                                           uint16_t local_port, uint16_t peer_port);
+
+/**
+ * @brief Searches the listening queue for a connection request.
+ *
+ * @note Must be called from a context where the TCB list is locked.
+ *
+ * @param[in] local_addr   Destination address of the connection request.
+ * @param[in] local_port   Destination port of the connection request.
+ *
+ * @returns   Queue listening on @p local_addr and @p local_port, NULL if
+ *            there is none.
+ */
+gnrc_tcp_tcb_queue_t *_gnrc_tcp_common_queue_find(const uint8_t *local_addr,
+                                                  uint16_t local_port);
+
 #ifdef __cplusplus
 }
 #endif
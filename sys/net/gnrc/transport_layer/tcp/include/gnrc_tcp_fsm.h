@@ -19,6 +19,7 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "mbox.h"
 #include "net/gnrc.h"
@@ -55,6 +56,7 @@ typedef enum {
     FSM_EVENT_CALL_CLOSE,         /* User function call: close */
     FSM_EVENT_CALL_ABORT,         /* User function call: abort */
     FSM_EVENT_RCVD_PKT,           /* Packet received from peer */
+    FSM_EVENT_RCVD_HANDSHAKE,     /* Packet completing a handshake of the SYN backlog */
     FSM_EVENT_TIMEOUT_TIMEWAIT,   /* Timeout: timewait */
     FSM_EVENT_TIMEOUT_RETRANSMIT, /* Timeout: retransmit */
     FSM_EVENT_TIMEOUT_CONNECTION, /* Timeout: connection */
@@ -67,8 +69,10 @@ typedef enum {
  *
  * @param[in,out] tcb     TCB holding the connection information.
  * @param[in]     event   Current event that triggers FSM transition.
- * @param[in]     in_pkt  Incoming packet. Only not NULL in case of event RCVD_PKT.
- * @param[in,out] buf     Buffer for send and receive functions.
+ * @param[in]     in_pkt  Incoming packet. Only not NULL in case of event RCVD_PKT
+ *                        and RCVD_HANDSHAKE.
+ * @param[in,out] buf     Buffer for send and receive functions. The connection
+ *                        request in case of event RCVD_HANDSHAKE.
  * @param[in]     len     Number of bytes to send or receive.
  *
  * @returns   Zero on success
@@ -78,6 +82,21 @@ typedef enum {
 int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
                   gnrc_pktsnip_t *in_pkt, void *buf, size_t len);
 
+/**
+ * @brief Handles a segment for a listening queue.
+ *
+ * Connection requests are kept in the SYN backlog of the queue and answered
+ * without a TCB. A TCB of the queue is bound to a request when the ACK
+ * completing its handshake arrives.
+ *
+ * @param[in] in_pkt   Incoming packet, not matching any connection.
+ *
+ * @returns   Zero if the segment was handled.
+ *            -ENOTCONN if no queue listens for the segment or it does not
+ *            belong to a handshake in progress.
+ */
+int _gnrc_tcp_fsm_listen(gnrc_pktsnip_t *in_pkt);
+
 /**
  * @brief Associate mbox with tcb. Messages sent from the FSM will be stored in the mbox.
  *
@@ -87,6 +106,15 @@ int _gnrc_tcp_fsm(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_event_t event,
  */
 void _gnrc_tcp_fsm_set_mbox(gnrc_tcp_tcb_t *tcb, mbox_t *mbox);
 
+/**
+ * @brief Set or clear status flags of a TCB, synchronized with the FSM.
+ *
+ * @param[in, out] tcb    TCB to modify.
+ * @param[in]      mask   Status flags to modify.
+ * @param[in]      set    Set the flags if true, clear them otherwise.
+ */
+void _gnrc_tcp_fsm_set_status(gnrc_tcp_tcb_t *tcb, uint16_t mask, bool set);
+
 /**
  * @brief Get latest FSM state from given TCB.
  *
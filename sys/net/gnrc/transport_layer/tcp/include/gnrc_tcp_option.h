@@ -41,6 +41,62 @@ static inline uint32_t _gnrc_tcp_option_build_mss(uint16_t mss)
             ((uint32_t) TCP_OPTION_LENGTH_MSS << 16) | mss);
 }
 
+/**
+ * @brief Helper function to build the window scale option, preceded by a NOP.
+ *
+ * @param[in] shift   Shift count that should be set.
+ *
+ * @returns   Window scale option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_ws(uint8_t shift)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_WS << 16) |
+            ((uint32_t) TCP_OPTION_LENGTH_WS << 8) | shift);
+}
+
+/**
+ * @brief Helper function to build the SACK permitted option, preceded by two NOPs.
+ *
+ * @returns   SACK permitted option value.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack_perm(void)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK_PERM << 8) | TCP_OPTION_LENGTH_SACK_PERM);
+}
+
+/**
+ * @brief Helper function to build the head of a SACK option, preceded by two NOPs.
+ *
+ * @param[in] blocks   Number of SACK blocks following the head.
+ *
+ * @returns   Head of the SACK option.
+ */
+static inline uint32_t _gnrc_tcp_option_build_sack(uint8_t blocks)
+{
+    return (((uint32_t) TCP_OPTION_KIND_NOP << 24) |
+            ((uint32_t) TCP_OPTION_KIND_NOP << 16) |
+            ((uint32_t) TCP_OPTION_KIND_SACK << 8) |
+            (TCP_OPTION_LENGTH_MIN + blocks * TCP_OPTION_SACK_BLOCK_SIZE));
+}
+
+/**
+ * @brief Calculates the window scale shift count announced to peers.
+ *
+ * @returns   Smallest shift count announcing the whole receive buffer.
+ */
+static inline uint8_t _gnrc_tcp_option_rcv_wscale(void)
+{
+    uint8_t shift = 0;
+    while (((uint32_t) GNRC_TCP_RCV_BUF_SIZE >> shift) > UINT16_MAX &&
+           shift < TCP_OPTION_WS_MAX) {
+        shift++;
+    }
+    return shift;
+}
+
 /**
  * @brief Helper function to build the combined option and control flag field.
  *
@@ -58,13 +114,32 @@ static inline uint16_t _gnrc_tcp_option_build_offset_control(uint16_t nopts, uin
 /**
  * @brief Parses options of a given TCP header.
  *
- * @param[in,out] tcb   TCB holding the connection information.
- * @param[in]     hdr   TCP header to be parsed.
+ * Options of a SYN in the states LISTEN, SYN_SENT and SYN_RCVD negotiate the
+ * MSS, window scaling and SACK for the connection. In all other states only
+ * SACK blocks are parsed and the negotiated options stay unchanged.
+ *
+ * @param[in,out] tcb        TCB holding the connection information.
+ * @param[in]     hdr        TCP header to be parsed.
+ * @param[out]    sack       SACK blocks of the header, if SACK was negotiated.
+ *                           Holds up to @ref TCP_OPTION_SACK_BLOCKS_MAX blocks.
+ * @param[out]    sack_len   Number of blocks in @p sack.
+ *
+ * @returns   Zero on success.
+ *            Negative value on error.
+ */
+int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr,
+                           gnrc_tcp_sack_block_t *sack, uint8_t *sack_len);
+
+/**
+ * @brief Parses options of a SYN for a connection request of the SYN backlog.
+ *
+ * @param[in,out] req   Connection request, gets the MSS and the offered options.
+ * @param[in]     hdr   TCP header of the SYN to be parsed.
  *
  * @returns   Zero on success.
  *            Negative value on error.
  */
-int _gnrc_tcp_option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+int _gnrc_tcp_option_parse_syn(gnrc_tcp_syn_req_t *req, tcp_hdr_t *hdr);
 
 #ifdef __cplusplus
 }
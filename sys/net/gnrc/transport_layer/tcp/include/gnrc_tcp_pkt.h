@@ -42,6 +42,23 @@ extern "C" {
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt);
 
+/**
+ * @brief Build a SYN+ACK from an incoming SYN for a connection request.
+ *
+ * @note This function answers a SYN without a TCB, the connection request
+ *       in the SYN backlog holds the state of the handshake.
+ *
+ * @param[out] out_pkt    Outgoing SYN+ACK packet
+ * @param[in]  in_pkt     Incoming SYN
+ * @param[in]  req        Connection request of @p in_pkt
+ *
+ * @returns   Zero on success
+ *            -ENOMEM if pktbuf is full.
+ */
+int _gnrc_tcp_pkt_build_syn_ack_from_pkt(gnrc_pktsnip_t **out_pkt,
+                                         gnrc_pktsnip_t *in_pkt,
+                                         const gnrc_tcp_syn_req_t *req);
+
 /**
  * @brief Build and allocate a TCB packet, TCB stores pointer to new packet.
  *
@@ -51,7 +68,8 @@ int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
  * @param[in]     ctl           Control bits to set in @p out_pkt.
  * @param[in]     seq_num       Sequence number of the new packet.
  * @param[in]     ack_num       Acknowledgment number of the new packet.
- * @param[in]     payload       Pointer to payload buffer.
+ * @param[in]     payload       Pointer to payload buffer. If NULL, the payload
+ *                              is left uninitialized for the caller to fill.
  * @param[in]     payload_len   Payload size.
  *
  * @returns   Zero on success.
@@ -110,6 +128,10 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * @p pkt is appended to the retransmit queue, unless @p retransmit is set:
+ * Then @p pkt is the oldest packet in the retransmit queue, about to be sent
+ * again because the retransmission timer expired.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
  * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
@@ -122,7 +144,7 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
                                    const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -132,6 +154,16 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Marks packets in the retransmission mechanism as selectively acknowledged.
+ *
+ * @param[in,out] tcb        TCB holding the connection information.
+ * @param[in]     sack       SACK blocks received from the peer.
+ * @param[in]     sack_len   Number of blocks in @p sack.
+ */
+void _gnrc_tcp_pkt_sack(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_sack_block_t *sack,
+                        const uint8_t sack_len);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
@@ -47,6 +47,23 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Stores received data in the receive buffer.
+ *
+ * Data received out of order is kept in the receive buffer behind the data
+ * available to the user, and tracked in the SACK blocks of @p tcb until the
+ * gap before it is filled. Advances tcb->rcv_nxt over all data received in order.
+ *
+ * @param[in,out] tcb    TCB holding the receive buffer.
+ * @param[in]     seq    Sequence number of @p data.
+ * @param[in]     data   Received data.
+ * @param[in]     len    Number of bytes in @p data.
+ *
+ * @returns   Number of bytes that became available to the user.
+ */
+size_t _gnrc_tcp_rcvbuf_add(gnrc_tcp_tcb_t *tcb, uint32_t seq, const uint8_t *data,
+                            size_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,247 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_profiler
+ * @{
+ *
+ * @file
+ * @brief       Scheduler profiler implementation
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "irq.h"
+#include "sched.h"
+#include "sched_profiler.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+#include "schedstatistics.h"
+#endif
+
+/* thread became runnable and did not run since */
+#define _FLAG_WOKEN         (0x1)
+/* ... and was woken from interrupt context */
+#define _FLAG_WOKEN_IN_ISR  (0x2)
+
+/* pid, runtime, 5 counters, histogram */
+#define _RECORD_SIZE_MAX    (3 + 10 + (5 * 5) + \
+                             (5 * CONFIG_SCHED_PROFILER_HIST_SIZE))
+
+static_assert((CONFIG_SCHED_PROFILER_HIST_SIZE >= 2) &&
+              (CONFIG_SCHED_PROFILER_HIST_SIZE <= (8 * sizeof(unsigned)) + 1),
+              "CONFIG_SCHED_PROFILER_HIST_SIZE out of range");
+
+/**
+ * When core_idle_thread is not active, the KERNEL_PID_UNDEF is used to track
+ * the idle time
+ */
+static sched_profiler_stat_t _stats[KERNEL_PID_LAST + 1];
+
+/* thread that was switched out while still runnable, until the next thread
+ * is scheduled */
+static kernel_pid_t _preempted = KERNEL_PID_UNDEF;
+static bool _enabled;
+
+static unsigned _bucket(uint32_t latency)
+{
+    if (latency >> (CONFIG_SCHED_PROFILER_HIST_SIZE - 2)) {
+        return CONFIG_SCHED_PROFILER_HIST_SIZE - 1;
+    }
+    return latency ? bitarithm_msb(latency) + 1 : 0;
+}
+
+static void _unschedule(kernel_pid_t pid, uint32_t now)
+{
+    sched_profiler_stat_t *stat = &_stats[pid];
+
+    stat->runtime_us += now - stat->laststart;
+    if (pid == KERNEL_PID_UNDEF) {
+        return;
+    }
+
+    /* a wake-up while the thread was still running does not count */
+    stat->flags = 0;
+
+    /* the scheduler already set a thread that is still runnable to pending */
+    thread_t *thread = thread_get_unchecked(pid);
+    if (thread && (thread->status == STATUS_PENDING)) {
+        stat->involuntary++;
+        _preempted = pid;
+    }
+    else {
+        stat->voluntary++;
+    }
+}
+
+static void _schedule(kernel_pid_t pid, uint32_t now)
+{
+    sched_profiler_stat_t *stat = &_stats[pid];
+
+    stat->laststart = now;
+    stat->schedules++;
+
+    if (stat->flags & _FLAG_WOKEN) {
+        uint32_t latency = now - stat->woken_at;
+
+        stat->latency_hist[_bucket(latency)]++;
+        if (latency > stat->latency_max) {
+            stat->latency_max = latency;
+        }
+        if ((stat->flags & _FLAG_WOKEN_IN_ISR) &&
+            (_preempted != KERNEL_PID_UNDEF)) {
+            _stats[_preempted].preempted_by_isr++;
+        }
+        stat->flags = 0;
+    }
+    _preempted = KERNEL_PID_UNDEF;
+}
+
+static void _sched_profiler_cb(kernel_pid_t active_thread,
+                               kernel_pid_t next_thread)
+{
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+#if IS_USED(MODULE_SCHEDSTATISTICS)
+    sched_statistics_cb(active_thread, next_thread);
+#endif
+
+    if (!IS_USED(MODULE_CORE_IDLE_THREAD) || active_thread != KERNEL_PID_UNDEF) {
+        _unschedule(active_thread, now);
+    }
+    if (!IS_USED(MODULE_CORE_IDLE_THREAD) || next_thread != KERNEL_PID_UNDEF) {
+        _schedule(next_thread, now);
+    }
+}
+
+void sched_wakeup_callback(thread_t *thread)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    sched_profiler_stat_t *stat = &_stats[thread->pid];
+
+    stat->woken_at = ztimer_now(ZTIMER_USEC);
+    stat->flags = irq_is_in() ? (_FLAG_WOKEN | _FLAG_WOKEN_IN_ISR) : _FLAG_WOKEN;
+}
+
+void sched_profiler_init(void)
+{
+    ztimer_acquire(ZTIMER_USEC);
+
+    /* the thread starting the profiler was scheduled before the callback was
+     * registered */
+    unsigned state = irq_disable();
+    sched_profiler_stat_t *stat = &_stats[thread_getpid()];
+    stat->laststart = ztimer_now(ZTIMER_USEC);
+    stat->schedules = 1;
+    _enabled = true;
+    sched_register_cb(_sched_profiler_cb);
+    irq_restore(state);
+}
+
+void sched_profiler_reset(void)
+{
+    unsigned state = irq_disable();
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_stats); i++) {
+        sched_profiler_stat_t *stat = &_stats[i];
+        uint32_t woken_at = stat->woken_at;
+        uint8_t flags = stat->flags;
+
+        memset(stat, 0, sizeof(*stat));
+        /* keep a pending wake-up so its latency is still recorded */
+        stat->laststart = now;
+        stat->woken_at = woken_at;
+        stat->flags = flags;
+    }
+    irq_restore(state);
+}
+
+int sched_profiler_get(kernel_pid_t pid, sched_profiler_stat_t *stat)
+{
+    if ((pid < 0) || (pid > KERNEL_PID_LAST)) {
+        return -EINVAL;
+    }
+
+    unsigned state = irq_disable();
+    *stat = _stats[pid];
+    if (pid == thread_getpid()) {
+        /* account for the running time slice */
+        stat->runtime_us += ztimer_now(ZTIMER_USEC) - stat->laststart;
+    }
+    irq_restore(state);
+    return 0;
+}
+
+static size_t _put_varint(uint8_t *buf, uint64_t val)
+{
+    size_t len = 0;
+
+    while (val >= 0x80) {
+        buf[len++] = (uint8_t)val | 0x80;
+        val >>= 7;
+    }
+    buf[len++] = (uint8_t)val;
+    return len;
+}
+
+size_t sched_profiler_export(sched_profiler_write_t write, void *arg)
+{
+    uint8_t buf[_RECORD_SIZE_MAX];
+    sched_profiler_stat_t stat;
+    size_t len = 0;
+    size_t total;
+
+    buf[len++] = 'S';
+    buf[len++] = 'P';
+    buf[len++] = SCHED_PROFILER_EXPORT_VERSION;
+    buf[len++] = CONFIG_SCHED_PROFILER_HIST_SIZE;
+    len += _put_varint(&buf[len], ztimer_now(ZTIMER_USEC));
+    write(buf, len, arg);
+    total = len;
+
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        if (pid == KERNEL_PID_UNDEF) {
+            if (IS_USED(MODULE_CORE_IDLE_THREAD)) {
+                continue;
+            }
+        }
+        else if (thread_get(pid) == NULL) {
+            continue;
+        }
+
+        sched_profiler_get(pid, &stat);
+        len = _put_varint(buf, pid + 1);
+        len += _put_varint(&buf[len], stat.runtime_us);
+        len += _put_varint(&buf[len], stat.schedules);
+        len += _put_varint(&buf[len], stat.voluntary);
+        len += _put_varint(&buf[len], stat.involuntary);
+        len += _put_varint(&buf[len], stat.preempted_by_isr);
+        len += _put_varint(&buf[len], stat.latency_max);
+        for (unsigned i = 0; i < CONFIG_SCHED_PROFILER_HIST_SIZE; i++) {
+            len += _put_varint(&buf[len], stat.latency_hist[i]);
+        }
+        write(buf, len, arg);
+        total += len;
+    }
+
+    buf[0] = 0;
+    write(buf, 1, arg);
+    return total + 1;
+}
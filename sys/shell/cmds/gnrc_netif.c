@@ -182,6 +182,13 @@ static int _netif_stats(netif_t *iface, unsigned module, bool reset)
                (unsigned)stats.tx_bytes,
                (unsigned)stats.tx_success,
                (unsigned)stats.tx_failed);
+        if (stats.rx_wakeups) {
+            unsigned per_wakeup = (stats.rx_count * 100ULL) / stats.rx_wakeups;
+
+            printf("            RX wakeups %u  packets per wakeup %u.%02u\n",
+                   (unsigned)stats.rx_wakeups,
+                   per_wakeup / 100, per_wakeup % 100);
+        }
         res = 0;
     }
     return res;
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for the scheduler profiler
+ *
+ * @note        Enable this by using the modules shell_cmds_default and
+ *              sched_profiler, or shell_cmd_sched_profiler
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sched_profiler.h"
+#include "shell.h"
+#include "thread.h"
+
+/* upper bound of the latency in µs that pct percent of the wake-ups met */
+static uint32_t _percentile(const sched_profiler_stat_t *stat, unsigned pct)
+{
+    uint32_t total = 0;
+    uint32_t sum = 0;
+
+    for (unsigned i = 0; i < CONFIG_SCHED_PROFILER_HIST_SIZE; i++) {
+        total += stat->latency_hist[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    uint32_t target = (uint32_t)(((uint64_t)total * pct + 99) / 100);
+    for (unsigned i = 0; i < CONFIG_SCHED_PROFILER_HIST_SIZE - 1; i++) {
+        sum += stat->latency_hist[i];
+        if (sum >= target) {
+            uint32_t bound = sched_profiler_bucket_min(i + 1) - 1;
+            return (bound < stat->latency_max) ? bound : stat->latency_max;
+        }
+    }
+    return stat->latency_max;
+}
+
+static const char *_name(kernel_pid_t pid)
+{
+    if (pid == KERNEL_PID_UNDEF) {
+        return "(idle)";
+    }
+#ifdef CONFIG_THREAD_NAMES
+    thread_t *thread = thread_get(pid);
+    if (thread) {
+        return thread_get_name(thread);
+    }
+#endif
+    return "-";
+}
+
+static void _print_summary(void)
+{
+    sched_profiler_stat_t stat;
+
+    printf("\tpid | %-20s | %12s | %8s | %8s | %8s | %6s | %8s | %8s | %8s\n",
+           "name", "runtime_us", "switches", "vol", "invol", "isr",
+           "p50_us", "p99_us", "max_us");
+
+    for (kernel_pid_t pid = KERNEL_PID_UNDEF; pid <= KERNEL_PID_LAST; pid++) {
+        if (pid == KERNEL_PID_UNDEF) {
+            if (IS_USED(MODULE_CORE_IDLE_THREAD)) {
+                continue;
+            }
+        }
+        else if (thread_get(pid) == NULL) {
+            continue;
+        }
+        sched_profiler_get(pid, &stat);
+        printf("\t%3" PRIkernel_pid " | %-20s | %12" PRIu64 " | %8" PRIu32
+               " | %8" PRIu32 " | %8" PRIu32 " | %6" PRIu32 " | %8" PRIu32
+               " | %8" PRIu32 " | %8" PRIu32 "\n",
+               pid, _name(pid), stat.runtime_us, stat.schedules,
+               stat.voluntary, stat.involuntary, stat.preempted_by_isr,
+               _percentile(&stat, 50), _percentile(&stat, 99),
+               stat.latency_max);
+    }
+}
+
+static int _print_hist(const char *arg)
+{
+    sched_profiler_stat_t stat;
+    kernel_pid_t pid = atoi(arg);
+
+    if ((sched_profiler_get(pid, &stat) != 0) ||
+        ((pid != KERNEL_PID_UNDEF) && (thread_get(pid) == NULL))) {
+        printf("No active thread found for ID \"%s\"\n", arg);
+        return EXIT_FAILURE;
+    }
+
+    printf("wake-up latency of %" PRIkernel_pid " (%s):\n", pid, _name(pid));
+    for (unsigned i = 0; i < CONFIG_SCHED_PROFILER_HIST_SIZE; i++) {
+        if (i == CONFIG_SCHED_PROFILER_HIST_SIZE - 1) {
+            printf("\t>= %8" PRIu32 " us: %" PRIu32 "\n",
+                   sched_profiler_bucket_min(i), stat.latency_hist[i]);
+        }
+        else {
+            printf("\t<  %8" PRIu32 " us: %" PRIu32 "\n",
+                   sched_profiler_bucket_min(i + 1), stat.latency_hist[i]);
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+static void _write_hex(const void *data, size_t len, void *arg)
+{
+    const uint8_t *bytes = data;
+    unsigned *col = arg;
+
+    for (size_t i = 0; i < len; i++) {
+        printf("%02x", bytes[i]);
+        if (++(*col) == 32) {
+            puts("");
+            *col = 0;
+        }
+    }
+}
+
+static int _sc_schedprof(int argc, char **argv)
+{
+    if (argc == 1) {
+        _print_summary();
+        return EXIT_SUCCESS;
+    }
+    if ((argc == 2) && !strcmp(argv[1], "reset")) {
+        sched_profiler_reset();
+        return EXIT_SUCCESS;
+    }
+    if ((argc == 2) && !strcmp(argv[1], "export")) {
+        unsigned col = 0;
+
+        sched_profiler_export(_write_hex, &col);
+        if (col) {
+            puts("");
+        }
+        return EXIT_SUCCESS;
+    }
+    if ((argc == 3) && !strcmp(argv[1], "hist")) {
+        return _print_hist(argv[2]);
+    }
+
+    printf("Usage: %s [reset|export|hist <THREAD_ID>]\n"
+           "  (no args)      per-thread summary\n"
+           "  reset          clear all profiles\n"
+           "  export         dump the binary profile stream as hex\n"
+           "  hist <ID>      wake-up latency histogram of a thread\n",
+           argv[0]);
+    return EXIT_FAILURE;
+}
+
+SHELL_COMMAND(schedprof, "Print scheduler profile of threads", _sc_schedprof);
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_spscrb
+ * @{
+ *
+ * @file
+ * @brief       Lock-free single-producer/single-consumer ringbuffer
+ *              implementation
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "macros/utils.h"
+#include "spscrb.h"
+
+/* number of elements from index pos up to count, but not beyond the end of
+ * a buffer of size elements */
+static unsigned _span(unsigned size, unsigned pos, unsigned count)
+{
+    return MIN(count, size - (pos & (size - 1)));
+}
+
+unsigned spscrb_reserve(spscrb_t *rb, uint8_t **data)
+{
+    unsigned writes = rb->writes;
+
+    *data = &rb->buf[writes & (rb->size - 1)];
+    return _span(rb->size, writes, spscrb_free(rb));
+}
+
+unsigned spscrb_peek(spscrb_t *rb, const uint8_t **data)
+{
+    unsigned reads = rb->reads;
+
+    *data = &rb->buf[reads & (rb->size - 1)];
+    return _span(rb->size, reads, spscrb_avail(rb));
+}
+
+size_t spscrb_write(spscrb_t *rb, const uint8_t *src, size_t n)
+{
+    unsigned writes = rb->writes;
+    unsigned num = MIN(n, spscrb_free(rb));
+    unsigned first = _span(rb->size, writes, num);
+
+    memcpy(&rb->buf[writes & (rb->size - 1)], src, first);
+    memcpy(rb->buf, &src[first], num - first);
+    spscrb_commit(rb, num);
+    return num;
+}
+
+size_t spscrb_copy(const spscrb_t *rb, uint8_t *dst, size_t n)
+{
+    unsigned reads = rb->reads;
+    unsigned num = MIN(n, spscrb_avail(rb));
+    unsigned first = _span(rb->size, reads, num);
+
+    memcpy(dst, &rb->buf[reads & (rb->size - 1)], first);
+    memcpy(&dst[first], rb->buf, num - first);
+    return num;
+}
+
+size_t spscrb_read(spscrb_t *rb, uint8_t *dst, size_t n)
+{
+    unsigned num;
+
+    if (dst) {
+        num = spscrb_copy(rb, dst, n);
+    }
+    else {
+        num = MIN(n, spscrb_avail(rb));
+    }
+    spscrb_release(rb, num);
+    return num;
+}
+
+static void *_obj(const spscrb_obj_t *rb, unsigned pos)
+{
+    return (uint8_t *)rb->buf + ((pos & (rb->size - 1)) * rb->obj_size);
+}
+
+unsigned spscrb_obj_reserve(spscrb_obj_t *rb, void **slots)
+{
+    unsigned writes = rb->writes;
+
+    *slots = _obj(rb, writes);
+    return _span(rb->size, writes, spscrb_obj_free(rb));
+}
+
+unsigned spscrb_obj_peek(spscrb_obj_t *rb, void **objs)
+{
+    unsigned reads = rb->reads;
+
+    *objs = _obj(rb, reads);
+    return _span(rb->size, reads, spscrb_obj_avail(rb));
+}
+
+unsigned spscrb_obj_write(spscrb_obj_t *rb, const void *objs, unsigned n)
+{
+    unsigned writes = rb->writes;
+    unsigned num = MIN(n, spscrb_obj_free(rb));
+    unsigned first = _span(rb->size, writes, num);
+
+    memcpy(_obj(rb, writes), objs, first * rb->obj_size);
+    memcpy(rb->buf, (const uint8_t *)objs + (first * rb->obj_size),
+           (num - first) * rb->obj_size);
+    spscrb_obj_commit(rb, num);
+    return num;
+}
+
+unsigned spscrb_obj_read(spscrb_obj_t *rb, void *objs, unsigned n)
+{
+    unsigned reads = rb->reads;
+    unsigned num = MIN(n, spscrb_obj_avail(rb));
+    unsigned first = _span(rb->size, reads, num);
+
+    memcpy(objs, _obj(rb, reads), first * rb->obj_size);
+    memcpy((uint8_t *)objs + (first * rb->obj_size), rb->buf,
+           (num - first) * rb->obj_size);
+    spscrb_obj_release(rb, num);
+    return num;
+}
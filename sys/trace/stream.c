@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_trace
+ * @{
+ *
+ * @file
+ * @brief       Streaming export of the trace buffer
+ *
+ * @}
+ */
+
+#include <stdint.h>
+
+#include "architecture.h"
+#include "thread.h"
+#include "trace.h"
+#include "ztimer.h"
+
+#if IS_USED(MODULE_TRACE_STREAM_VFS)
+#include <fcntl.h>
+#include "vfs.h"
+#else
+#include "stdio_base.h"
+#endif
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/* events taken out of the trace buffer at once */
+#define TRACE_STREAM_CHUNK  (8U)
+
+kernel_pid_t trace_stream_pid = KERNEL_PID_UNDEF;
+
+static char _stack[CONFIG_TRACE_STREAM_STACKSIZE];
+
+#if IS_USED(MODULE_TRACE_STREAM_VFS)
+static int _fd = -1;
+
+static void _open(void)
+{
+    _fd = vfs_open(CONFIG_TRACE_STREAM_VFS_PATH, O_CREAT | O_TRUNC | O_WRONLY,
+                   0644);
+    if (_fd < 0) {
+        DEBUG("trace_stream: can't open %s: %d\n", CONFIG_TRACE_STREAM_VFS_PATH,
+              _fd);
+    }
+}
+
+static void _write(const void *data, size_t len)
+{
+    if (_fd >= 0) {
+        vfs_write(_fd, data, len);
+    }
+}
+
+static void _flush(void)
+{
+    if (_fd >= 0) {
+        vfs_fsync(_fd);
+    }
+}
+#else
+static void _open(void)
+{
+}
+
+static void _write(const void *data, size_t len)
+{
+    stdio_write(data, len);
+}
+
+static void _flush(void)
+{
+}
+#endif
+
+static void *_stream_thread(void *arg)
+{
+    (void)arg;
+    trace_event_t events[TRACE_STREAM_CHUNK];
+    uint8_t buf[TRACE_STREAM_CHUNK * TRACE_STREAM_RECORD_SIZE];
+    const uint8_t magic[] = {
+        (uint8_t)TRACE_STREAM_MAGIC,
+        (uint8_t)(TRACE_STREAM_MAGIC >> 8),
+        (uint8_t)(TRACE_STREAM_MAGIC >> 16),
+        (uint8_t)(TRACE_STREAM_MAGIC >> 24),
+    };
+
+    _open();
+    _write(magic, sizeof(magic));
+
+    while (1) {
+        size_t n = trace_read(events, ARRAY_SIZE(events));
+
+        if (n == 0) {
+            _flush();
+            ztimer_sleep(ZTIMER_MSEC, CONFIG_TRACE_STREAM_INTERVAL_MS);
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            trace_stream_record(&buf[i * TRACE_STREAM_RECORD_SIZE], &events[i]);
+        }
+        _write(buf, n * TRACE_STREAM_RECORD_SIZE);
+    }
+
+    return NULL;
+}
+
+void trace_stream_init(void)
+{
+    trace_stream_pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MIN - 1,
+                                     0, _stream_thread, NULL,
+                                     "trace_stream");
+}
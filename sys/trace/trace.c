@@ -9,7 +9,7 @@
  */
 
 /**
- * @ingroup     sys
+ * @ingroup     sys_trace
  * @{
  *
  * @file
@@ -20,52 +20,202 @@
  * @}
  */
 
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 
 #include "architecture.h"
 #include "irq.h"
+#include "spscrb.h"
+#include "thread.h"
+#include "trace.h"
 #include "ztimer.h"
 
-#ifndef CONFIG_TRACE_BUFSIZE
-#define CONFIG_TRACE_BUFSIZE 512
+static_assert((CONFIG_TRACE_BUFSIZE & (CONFIG_TRACE_BUFSIZE - 1)) == 0,
+              "CONFIG_TRACE_BUFSIZE must be a power of 2");
+
+static trace_event_t tracebuf[CONFIG_TRACE_BUFSIZE];
+static spscrb_obj_t tracebuf_rb = SPSCRB_OBJ_INIT(tracebuf);
+static unsigned tracebuf_dropped;
+static bool trace_enabled;
+
+#if IS_USED(MODULE_TRACE_STREAM)
+extern kernel_pid_t trace_stream_pid;
+extern void trace_stream_init(void);
 #endif
 
-typedef struct {
-    uint32_t time;
-    uint32_t val;
-} tracebuf_entry_t;
+static const char *const event_names[] = {
+    [TRACE_EVENT_USER] = "user",
+    [TRACE_EVENT_DROPPED] = "dropped",
+    [TRACE_EVENT_SCHED_SWITCH] = "sched_switch",
+    [TRACE_EVENT_SCHED_WAKEUP] = "sched_wakeup",
+    [TRACE_EVENT_MSG_SEND] = "msg_send",
+    [TRACE_EVENT_MSG_RECV] = "msg_recv",
+    [TRACE_EVENT_MUTEX_BLOCK] = "mutex_block",
+    [TRACE_EVENT_MUTEX_RESUME] = "mutex_resume",
+    [TRACE_EVENT_MUTEX_HANDOVER] = "mutex_handover",
+    [TRACE_EVENT_NETAPI_SEND] = "netapi_send",
+    [TRACE_EVENT_NETAPI_DISPATCH] = "netapi_dispatch",
+    [TRACE_EVENT_ZTIMER_SET] = "ztimer_set",
+    [TRACE_EVENT_ZTIMER_FIRE] = "ztimer_fire",
+};
+
+static_assert(ARRAY_SIZE(event_names) == TRACE_EVENT_NUMOF,
+              "name missing for trace event");
 
-static tracebuf_entry_t tracebuf[CONFIG_TRACE_BUFSIZE];
-static size_t tracebuf_pos;
+void trace_init(void)
+{
+    ztimer_acquire(ZTIMER_USEC);
+    trace_enabled = true;
+#if IS_USED(MODULE_TRACE_STREAM)
+    trace_stream_init();
+#endif
+}
 
-void trace(uint32_t val)
+void trace_event(uint16_t id, uint32_t arg0, uint32_t arg1)
 {
+    /* ZTIMER_USEC can't be used before auto_init */
+    if (!trace_enabled) {
+        return;
+    }
+
+    uint16_t ctx = irq_is_in() ? TRACE_CTX_ISR : (uint16_t)thread_getpid();
+#if IS_USED(MODULE_TRACE_STREAM)
+    /* the stream would otherwise mostly trace itself */
+    if (ctx == (uint16_t)trace_stream_pid) {
+        return;
+    }
+#endif
+
     unsigned state = irq_disable();
+    trace_event_t *slot;
+
+    if (spscrb_obj_reserve(&tracebuf_rb, (void **)&slot) == 0) {
+        if (IS_USED(MODULE_TRACE_STREAM)) {
+            /* the stream thread owns the read side, so drop the new event */
+            tracebuf_dropped++;
+            irq_restore(state);
+            return;
+        }
+        /* overwrite the oldest event */
+        spscrb_obj_release(&tracebuf_rb, 1);
+        spscrb_obj_reserve(&tracebuf_rb, (void **)&slot);
+    }
+    *slot = (trace_event_t){
+        .time = ztimer_now(ZTIMER_USEC),
+        .id = id,
+        .ctx = ctx,
+        .arg0 = arg0,
+        .arg1 = arg1,
+    };
+    spscrb_obj_commit(&tracebuf_rb, 1);
+    irq_restore(state);
+}
 
-    tracebuf[tracebuf_pos % CONFIG_TRACE_BUFSIZE] =
-        (tracebuf_entry_t){ .time = ztimer_now(ZTIMER_USEC), .val = val };
-    tracebuf_pos++;
+size_t trace_read(trace_event_t *events, size_t num)
+{
+    size_t n = 0;
+
+    if (num == 0) {
+        return 0;
+    }
+
+    unsigned state = irq_disable();
+    unsigned dropped = tracebuf_dropped;
+    tracebuf_dropped = 0;
     irq_restore(state);
+
+    if (dropped) {
+        events[n++] = (trace_event_t){
+            .time = ztimer_now(ZTIMER_USEC),
+            .id = TRACE_EVENT_DROPPED,
+            .ctx = thread_getpid(),
+            .arg0 = dropped,
+        };
+    }
+
+    if (IS_USED(MODULE_TRACE_STREAM)) {
+        /* single consumer, writers never touch the read side */
+        n += spscrb_obj_read(&tracebuf_rb, &events[n], num - n);
+    }
+    else {
+        /* writers may overwrite the oldest events */
+        state = irq_disable();
+        n += spscrb_obj_read(&tracebuf_rb, &events[n], num - n);
+        irq_restore(state);
+    }
+    return n;
+}
+
+const char *trace_event_name(uint16_t id)
+{
+    return (id < TRACE_EVENT_NUMOF) ? event_names[id] : "app";
+}
+
+void trace_stream_record(uint8_t *buf, const trace_event_t *event)
+{
+    const uint32_t words[] = {
+        event->time,
+        event->id | ((uint32_t)event->ctx << 16),
+        event->arg0,
+        event->arg1,
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(words); i++) {
+        buf[4 * i] = words[i];
+        buf[4 * i + 1] = words[i] >> 8;
+        buf[4 * i + 2] = words[i] >> 16;
+        buf[4 * i + 3] = words[i] >> 24;
+    }
 }
 
 void trace_dump(void)
 {
-    size_t n = tracebuf_pos >
-               CONFIG_TRACE_BUFSIZE ? CONFIG_TRACE_BUFSIZE : tracebuf_pos;
     uint32_t t_last = 0;
+    unsigned state = irq_disable();
+    unsigned start = tracebuf_rb.reads;
+    unsigned n = spscrb_obj_avail(&tracebuf_rb);
+
+    irq_restore(state);
+
+    for (unsigned i = 0; i < n; i++) {
+        state = irq_disable();
+        if ((tracebuf_rb.reads - start) > i) {
+            /* the event was overwritten or streamed in the meantime */
+            irq_restore(state);
+            continue;
+        }
+        trace_event_t ev = tracebuf[(start + i) & (CONFIG_TRACE_BUFSIZE - 1)];
+        irq_restore(state);
 
-    for (size_t i = 0; i < n; i++) {
-        printf("n=%4" PRIuSIZE " t=%s%8" PRIu32 " v=0x%08" PRIx32 "\n", i,
-               i ? "+" : " ",
-               tracebuf[i].time - t_last, tracebuf[i].val);
-        t_last = tracebuf[i].time;
+        if (ev.id == TRACE_EVENT_USER) {
+            printf("n=%4u t=%s%8" PRIu32 " v=0x%08" PRIx32 "\n", i,
+                   i ? "+" : " ", ev.time - t_last, ev.arg0);
+        }
+        else {
+            printf("n=%4u t=%s%8" PRIu32 " e=%s a=0x%08" PRIx32 ",0x%08"
+                   PRIx32 " ctx=", i, i ? "+" : " ", ev.time - t_last,
+                   trace_event_name(ev.id), ev.arg0, ev.arg1);
+            if (ev.ctx == TRACE_CTX_ISR) {
+                puts("isr");
+            }
+            else {
+                printf("%u\n", ev.ctx);
+            }
+        }
+        t_last = ev.time;
     }
 }
 
 void trace_reset(void)
 {
-    unsigned state = irq_disable();
+    if (IS_USED(MODULE_TRACE_STREAM)) {
+        /* the read side belongs to the stream thread */
+        return;
+    }
 
-    tracebuf_pos = 0;
+    unsigned state = irq_disable();
+    spscrb_obj_release(&tracebuf_rb, spscrb_obj_avail(&tracebuf_rb));
     irq_restore(state);
 }
@@ -20,6 +20,47 @@
 #include "irq.h"
 #include "tsrb.h"
 
+#if MODULE_TSRB_SPSCRB
+int tsrb_get_one(tsrb_t *rb)
+{
+    uint8_t c;
+
+    return (spscrb_read(rb, &c, 1) == 1) ? c : -1;
+}
+
+int tsrb_peek_one(tsrb_t *rb)
+{
+    uint8_t c;
+
+    return (spscrb_copy(rb, &c, 1) == 1) ? c : -1;
+}
+
+int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    return spscrb_read(rb, dst, n);
+}
+
+int tsrb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    return spscrb_copy(rb, dst, n);
+}
+
+int tsrb_drop(tsrb_t *rb, size_t n)
+{
+    return spscrb_read(rb, NULL, n);
+}
+
+int tsrb_add_one(tsrb_t *rb, uint8_t c)
+{
+    return (spscrb_write(rb, &c, 1) == 1) ? 0 : -1;
+}
+
+int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
+{
+    return spscrb_write(rb, src, n);
+}
+#else /* MODULE_TSRB_SPSCRB */
+
 static void _push(tsrb_t *rb, uint8_t c)
 {
     rb->buf[rb->writes++ & (rb->size - 1)] = c;
@@ -116,3 +157,4 @@ int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
     irq_restore(irq_state);
     return (n - tmp);
 }
+#endif /* MODULE_TSRB_SPSCRB */
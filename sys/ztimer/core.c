@@ -32,12 +32,17 @@
 #include "pm_layered.h"
 #endif
 #include "ztimer.h"
+#if MODULE_ZTIMER_WHEEL
+#include "ztimer/wheel.h"
+#endif
 #include "log.h"
+#include "tracepoint.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
+static void _insert_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry);
 static void _ztimer_update(ztimer_clock_t *clock);
 static void _ztimer_print(const ztimer_clock_t *clock);
@@ -112,8 +117,34 @@ bool ztimer_release(ztimer_clock_t *clock)
 }
 #endif /* MODULE_ZTIMER_ONDEMAND */
 
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+static bool _is_empty(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel && !ztimer_wheel_is_empty(clock->wheel)) {
+        return false;
+    }
+#endif
+    return clock->list.next == NULL;
+}
+#endif
+
+#if MODULE_ZTIMER_WHEEL
+/* pprev of a timer that was never set may hold garbage, it is only trusted if
+ * it links back to the timer */
+static bool _in_wheel(const ztimer_clock_t *clock, const ztimer_base_t *entry)
+{
+    return clock->wheel && entry->pprev && (*entry->pprev == entry);
+}
+#endif
+
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
+#if MODULE_ZTIMER_WHEEL
+    if (_in_wheel(clock, &t->base)) {
+        return 1;
+    }
+#endif
     if (!clock->list.next) {
         return 0;
     }
@@ -175,6 +206,7 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 
     DEBUG("ztimer_set(): %p: set %p at %" PRIu32 " offset %" PRIu32 "\n",
           (void *)clock, (void *)timer, clock->ops->now(clock), val);
+    TRACEPOINT(TRACE_EVENT_ZTIMER_SET, timer, val);
 
     uint32_t now = _ztimer_update_head_offset(clock);
 
@@ -215,18 +247,32 @@ uint32_t ztimer_set(ztimer_clock_t *clock, ztimer_t *timer, uint32_t val)
 
 static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 {
-    uint32_t delta_sum = 0;
-
-    ztimer_base_t *list = &clock->list;
-
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
-    /* First timer on the clock's linked list */
-    if (list->next == NULL &&
+    /* First timer on the clock */
+    if (_is_empty(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_block(clock->block_pm_mode);
     }
 #endif
 
+#if MODULE_ZTIMER_WHEEL
+    /* timers not due within the current slot of the wheel go into the wheel */
+    if (clock->wheel &&
+        ztimer_wheel_add(clock->wheel, entry, clock->list.offset)) {
+        return;
+    }
+    entry->pprev = NULL;
+#endif
+
+    _insert_entry_to_list(clock, entry);
+}
+
+static void _insert_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    uint32_t delta_sum = 0;
+
+    ztimer_base_t *list = &clock->list;
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -247,11 +293,31 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
         clock->last = entry;
     }
     list->next = entry;
-    DEBUG("_add_entry_to_list() %p offset %" PRIu32 "\n", (void *)entry,
+    DEBUG("_insert_entry_to_list() %p offset %" PRIu32 "\n", (void *)entry,
           entry->offset);
 
 }
 
+#if MODULE_ZTIMER_WHEEL
+/* move timers from the wheel that are due before its new horizon to the list,
+ * requires clock->list.offset to be up to date */
+static void _ztimer_wheel_advance(ztimer_clock_t *clock)
+{
+    ztimer_base_t *entry = ztimer_wheel_advance(clock->wheel,
+                                                clock->list.offset);
+
+    while (entry) {
+        ztimer_base_t *next = entry->next;
+        /* offset holds the absolute target while in the wheel */
+        int32_t offset = entry->offset - clock->list.offset;
+
+        entry->offset = (offset > 0) ? (uint32_t)offset : 0;
+        _insert_entry_to_list(clock, entry);
+        entry = next;
+    }
+}
+#endif
+
 static uint32_t _add_modulo(uint32_t a, uint32_t b, uint32_t mod)
 {
     if (a < b) {
@@ -335,7 +401,15 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
-    while (list->next) {
+#if MODULE_ZTIMER_WHEEL
+    if (_in_wheel(clock, entry)) {
+        ztimer_wheel_del(clock->wheel, entry);
+        was_removed = true;
+        list = NULL;
+    }
+#endif
+
+    while (list && list->next) {
         ztimer_base_t *list_entry = list->next;
         if (list_entry == entry) {
             if (entry == clock->last) {
@@ -359,8 +433,8 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
-    /* The last timer just got removed from the clock's linked list */
-    if (clock->list.next == NULL &&
+    /* The last timer just got removed from the clock */
+    if (_is_empty(clock) &&
         clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
         pm_unblock(clock->block_pm_mode);
     }
@@ -379,7 +453,8 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
             /* The last timer just got removed from the clock's linked list */
             clock->last = NULL;
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
-            if (clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+            if (_is_empty(clock) &&
+                clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
                 pm_unblock(clock->block_pm_mode);
             }
 #endif
@@ -397,12 +472,26 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
 
 static void _ztimer_update(ztimer_clock_t *clock)
 {
+    bool armed = (clock->list.next != NULL);
+    uint32_t target = armed ? clock->list.next->offset : 0;
+
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel && !ztimer_wheel_is_empty(clock->wheel)) {
+        /* wake up when the wheel reaches its next non-empty slot */
+        int32_t next = clock->wheel->next - clock->list.offset;
+        uint32_t wheel_target = (next > 0) ? (uint32_t)next : 0;
+
+        if (!armed || (wheel_target < target)) {
+            target = wheel_target;
+        }
+        armed = true;
+    }
+#endif
+
 #ifdef MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
-        if (clock->list.next) {
-            clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
-                                     clock->max_value >> 1));
+        if (armed) {
+            clock->ops->set(clock, _min_u32(target, clock->max_value >> 1));
         }
         else {
             clock->ops->set(clock, clock->max_value >> 1);
@@ -412,8 +501,8 @@ static void _ztimer_update(ztimer_clock_t *clock)
 #endif
     }
     else {
-        if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+        if (armed) {
+            clock->ops->set(clock, target);
         }
         else {
             clock->ops->cancel(clock);
@@ -431,6 +520,19 @@ void ztimer_handler(ztimer_clock_t *clock)
         _ztimer_print(clock);
     }
 
+#if MODULE_ZTIMER_WHEEL
+    if (clock->wheel) {
+        /* the clock may have been set for the wheel instead of the list */
+        _ztimer_update_head_offset(clock);
+        _ztimer_wheel_advance(clock);
+        if (!clock->list.next || clock->list.next->offset) {
+            DEBUG("ztimer_handler(): %p wheel advanced\n", (void *)clock);
+            _ztimer_update(clock);
+            return;
+        }
+    }
+#endif
+
 #if MODULE_ZTIMER_EXTEND
     if (clock->max_value < UINT32_MAX) {
         /* calling now triggers checkpointing */
@@ -470,6 +572,7 @@ void ztimer_handler(ztimer_clock_t *clock)
             DEBUG("ztimer_handler(): trigger %p->%p at %" PRIu32 "\n",
                   (void *)entry, (void *)entry->base.next, clock->ops->now(
                       clock));
+            TRACEPOINT(TRACE_EVENT_ZTIMER_FIRE, entry, 0);
             entry->callback(entry->arg);
 #if MODULE_ZTIMER_ONDEMAND
             no_clock_user_left = ztimer_release(clock);
@@ -51,6 +51,7 @@
 #include "ztimer/periph_rtt.h"
 #include "ztimer/periph_rtc.h"
 #include "ztimer/config.h"
+#include "ztimer/wheel.h"
 
 /* both 'stdio_rtt' and 'stdio_semihosting' rely on ztimer for stdio output,
    so not output is possible before 'ztimer' has been initiated, silence all
@@ -268,6 +269,18 @@ ztimer_clock_t *const ZTIMER_SEC = ZTIMER_SEC_BASE;
 #  endif
 #endif
 
+#if MODULE_ZTIMER_WHEEL_USEC
+static ztimer_wheel_t _ztimer_wheel_usec;
+#endif
+
+#if MODULE_ZTIMER_WHEEL_MSEC
+static ztimer_wheel_t _ztimer_wheel_msec;
+#endif
+
+#if MODULE_ZTIMER_WHEEL_SEC
+static ztimer_wheel_t _ztimer_wheel_sec;
+#endif
+
 #if IS_USED(MODULE_ZTIMER_USEC)
 #ifndef CONFIG_ZTIMER_AUTO_ADJUST_BASE_ITVL
 #define CONFIG_ZTIMER_AUTO_ADJUST_BASE_ITVL     1000
@@ -446,4 +459,21 @@ void ztimer_init(void)
                              FREQ_1HZ, ZTIMER_SEC_CONVERT_LOWER_FREQ);
 #  endif
 #endif
+
+/* Step 6: attach timer wheels */
+#if MODULE_ZTIMER_WHEEL_USEC
+    LOG_DEBUG("ztimer_init(): ZTIMER_USEC using timer wheel\n");
+    ztimer_wheel_init(ZTIMER_USEC, &_ztimer_wheel_usec,
+                      CONFIG_ZTIMER_WHEEL_USEC_SHIFT);
+#endif
+#if MODULE_ZTIMER_WHEEL_MSEC
+    LOG_DEBUG("ztimer_init(): ZTIMER_MSEC using timer wheel\n");
+    ztimer_wheel_init(ZTIMER_MSEC, &_ztimer_wheel_msec,
+                      CONFIG_ZTIMER_WHEEL_MSEC_SHIFT);
+#endif
+#if MODULE_ZTIMER_WHEEL_SEC
+    LOG_DEBUG("ztimer_init(): ZTIMER_SEC using timer wheel\n");
+    ztimer_wheel_init(ZTIMER_SEC, &_ztimer_wheel_sec,
+                      CONFIG_ZTIMER_WHEEL_SEC_SHIFT);
+#endif
 }
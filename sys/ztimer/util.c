@@ -142,7 +142,7 @@ struct ztimer_mbox_thread_status {
 static void _ztimer_mbox_get_timeout(void *arg)
 {
     struct ztimer_mbox_thread_status *data = arg;
-    if (!list_remove(&data->mbox->readers, &data->thread->rq_entry)) {
+    if (!thread_remove_from_list(&data->mbox->readers, data->thread)) {
         /* timeout triggered just after the message was received but before the
          * timer was canceled. --> ignore the timeout */
         DEBUG_PUTS("ztimer_mbox_get_timeout: timeout triggered, but message already received");
@@ -0,0 +1,248 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser General
+ * Public License v2.1. See the file LICENSE in the top level directory for more
+ * details.
+ */
+
+/**
+ * @ingroup     sys_ztimer_wheel
+ * @{
+ *
+ * @file
+ * @brief       ztimer hierarchical timer wheel implementation
+ *
+ * Timers are kept relative to the level 0 slot number ztimer_wheel_t::pos,
+ * which starts at ztimer_wheel_t::horizon. A timer `du` level 0 slots away is
+ * put on the lowest level `k` with `du < ZTIMER_WHEEL_SLOTS^(k + 1)`, in slot
+ * `((pos + du) >> (k * ZTIMER_WHEEL_SLOT_BITS)) % ZTIMER_WHEEL_SLOTS`. When
+ * `pos` reaches the start of a slot of level `k > 0`, the timers in there are
+ * re-inserted and end up on a lower level. When `pos` reaches a level 0 slot,
+ * its timers are handed to the list of the clock.
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bitarithm.h"
+#include "ztimer.h"
+#include "ztimer/wheel.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#define _LEVEL_BITS(level)  ((level) * ZTIMER_WHEEL_SLOT_BITS)
+#define _SLOT_MASK          (ZTIMER_WHEEL_SLOTS - 1)
+/* number of level 0 slots the wheel spans */
+#define _SPAN_SLOTS         (1LU << _LEVEL_BITS(CONFIG_ZTIMER_WHEEL_LEVELS))
+
+static_assert(_LEVEL_BITS(CONFIG_ZTIMER_WHEEL_LEVELS) < 32,
+              "CONFIG_ZTIMER_WHEEL_LEVELS too large");
+
+/* distance from slot start to the first non-empty slot in bitmap occupied */
+static unsigned _first_occupied(uint16_t occupied, unsigned start)
+{
+    uint32_t bm = occupied;
+
+    bm = ((bm >> start) | (bm << (ZTIMER_WHEEL_SLOTS - start))) &
+         ((1LU << ZTIMER_WHEEL_SLOTS) - 1);
+    assert(bm);
+    return bitarithm_lsb(bm);
+}
+
+/* number of level 0 slots until the first slot in occupied of level is reached */
+static uint32_t _dist(const ztimer_wheel_t *wheel, unsigned level,
+                      uint16_t occupied)
+{
+    unsigned bits = _LEVEL_BITS(level);
+    uint32_t rem = wheel->pos & ((1LU << bits) - 1);
+    unsigned cur = (wheel->pos >> bits) & _SLOT_MASK;
+
+    if (rem == 0) {
+        /* the current slot is reached right now */
+        return (uint32_t)_first_occupied(occupied, cur) << bits;
+    }
+    /* the current slot was already reached, so timers in there wait for the
+     * next rotation */
+    return ((uint32_t)(_first_occupied(occupied, (cur + 1) & _SLOT_MASK) + 1)
+            << bits) - rem;
+}
+
+static void _update_next(ztimer_wheel_t *wheel)
+{
+    uint32_t dist = UINT32_MAX;
+
+    for (unsigned level = 0; level < CONFIG_ZTIMER_WHEEL_LEVELS; level++) {
+        if (wheel->occupied[level]) {
+            uint32_t d = _dist(wheel, level, wheel->occupied[level]);
+
+            if (d < dist) {
+                dist = d;
+            }
+        }
+    }
+    wheel->next = wheel->horizon + (dist << wheel->shift);
+}
+
+/* dist: ticks from horizon to the target of entry,
+ * returns number of level 0 slots until the slot of entry is reached */
+static uint32_t _insert(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                        uint32_t dist)
+{
+    uint32_t du = dist >> wheel->shift;
+    unsigned level = 0;
+    unsigned slot;
+
+    if (du >= _SPAN_SLOTS) {
+        /* park in last slot, will be re-inserted once it is reached */
+        du = _SPAN_SLOTS - 1;
+    }
+    while (((level + 1) < CONFIG_ZTIMER_WHEEL_LEVELS) &&
+           (du >> _LEVEL_BITS(level + 1))) {
+        level++;
+    }
+    slot = ((wheel->pos + du) >> _LEVEL_BITS(level)) & _SLOT_MASK;
+
+    entry->next = wheel->slots[level][slot];
+    if (entry->next) {
+        entry->next->pprev = &entry->next;
+    }
+    entry->pprev = &wheel->slots[level][slot];
+    wheel->slots[level][slot] = entry;
+    wheel->occupied[level] |= 1U << slot;
+    DEBUG("ztimer_wheel: %p to level %u slot %u\n", (void *)entry, level, slot);
+    return _dist(wheel, level, 1U << slot);
+}
+
+static ztimer_base_t *_take_slot(ztimer_wheel_t *wheel, unsigned level,
+                                 unsigned slot)
+{
+    ztimer_base_t *entries = wheel->slots[level][slot];
+
+    wheel->slots[level][slot] = NULL;
+    wheel->occupied[level] &= ~(1U << slot);
+    return entries;
+}
+
+void ztimer_wheel_init(ztimer_clock_t *clock, ztimer_wheel_t *wheel,
+                       unsigned shift)
+{
+    assert(clock->list.next == NULL);
+    assert((_LEVEL_BITS(CONFIG_ZTIMER_WHEEL_LEVELS) + shift) < 32);
+    memset(wheel, 0, sizeof(*wheel));
+    wheel->shift = shift;
+    clock->wheel = wheel;
+}
+
+bool ztimer_wheel_add(ztimer_wheel_t *wheel, ztimer_base_t *entry,
+                      uint32_t now)
+{
+    bool was_empty = ztimer_wheel_is_empty(wheel);
+    uint32_t dist, reached;
+
+    if (was_empty) {
+        /* nothing to keep track of, restart at the current time */
+        wheel->horizon = now + (1LU << wheel->shift);
+    }
+    else if (((int32_t)(now - wheel->horizon) >= 0) &&
+             ((int32_t)(wheel->next - now) > 0)) {
+        /* no slot was reached since horizon, so skip forward to now */
+        uint32_t n = ((now - wheel->horizon) >> wheel->shift) + 1;
+
+        wheel->pos += n;
+        wheel->horizon += n << wheel->shift;
+    }
+
+    if ((int32_t)(wheel->horizon - now) > 0) {
+        if (entry->offset < (wheel->horizon - now)) {
+            return false;
+        }
+        dist = entry->offset - (wheel->horizon - now);
+    }
+    else if (entry->offset >= (_SPAN_SLOTS << wheel->shift)) {
+        dist = UINT32_MAX;
+    }
+    else {
+        /* a slot was reached, but not processed yet */
+        dist = entry->offset + (now - wheel->horizon);
+    }
+    /* keep absolute target for re-insertion */
+    entry->offset += now;
+    /* only the slot of entry can be reached earlier than before */
+    reached = wheel->horizon + (_insert(wheel, entry, dist) << wheel->shift);
+    if (was_empty || ((int32_t)(reached - wheel->next) < 0)) {
+        wheel->next = reached;
+    }
+    return true;
+}
+
+void ztimer_wheel_del(ztimer_wheel_t *wheel, ztimer_base_t *entry)
+{
+    uintptr_t first = (uintptr_t)&wheel->slots[0][0];
+    uintptr_t link = (uintptr_t)entry->pprev;
+
+    assert(entry->pprev);
+    *entry->pprev = entry->next;
+    if (entry->next) {
+        entry->next->pprev = entry->pprev;
+    }
+    else if ((link >= first) && (link < (first + sizeof(wheel->slots)))) {
+        /* entry was the last one in its slot */
+        unsigned idx = (link - first) / sizeof(wheel->slots[0][0]);
+
+        wheel->occupied[idx / ZTIMER_WHEEL_SLOTS] &= ~(1U << (idx & _SLOT_MASK));
+    }
+    /* wheel->next may now be too early, which only costs a spurious wake-up */
+    entry->next = NULL;
+    entry->pprev = NULL;
+}
+
+ztimer_base_t *ztimer_wheel_advance(ztimer_wheel_t *wheel, uint32_t now)
+{
+    ztimer_base_t *due = NULL;
+
+    while (!ztimer_wheel_is_empty(wheel) &&
+           ((int32_t)(now - wheel->next) >= 0)) {
+        ztimer_base_t *entry;
+
+        /* skip the empty slots up to the next one to process */
+        wheel->pos += (wheel->next - wheel->horizon) >> wheel->shift;
+        wheel->horizon = wheel->next;
+
+        for (unsigned level = CONFIG_ZTIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+            unsigned bits = _LEVEL_BITS(level);
+
+            if (wheel->pos & ((1LU << bits) - 1)) {
+                continue;
+            }
+            entry = _take_slot(wheel, level, (wheel->pos >> bits) & _SLOT_MASK);
+            while (entry) {
+                ztimer_base_t *next = entry->next;
+
+                _insert(wheel, entry, entry->offset - wheel->horizon);
+                entry = next;
+            }
+        }
+
+        entry = _take_slot(wheel, 0, wheel->pos & _SLOT_MASK);
+        while (entry) {
+            ztimer_base_t *next = entry->next;
+
+            entry->pprev = NULL;
+            entry->next = due;
+            due = entry;
+            entry = next;
+        }
+
+        wheel->pos++;
+        wheel->horizon += 1LU << wheel->shift;
+        if (!ztimer_wheel_is_empty(wheel)) {
+            _update_next(wheel);
+        }
+    }
+    return due;
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC IPv6 forwarding benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "net/ethernet.h"
+#include "net/ethernet/hdr.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/ipv6/addr.h"
+#include "net/netdev_test.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifdef MODULE_GNRC_IPV6_FWD_CACHE
+#include "net/gnrc/ipv6/fwd_cache.h"
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+#define IFACE_NUMOF     (2U)
+#define IFACE_IN        (0U)
+#define IFACE_OUT       (1U)
+#define DST_PFX_LEN     (64U)
+
+/* IPv6 header + payload:  version+TC  FL: 0       plen: 16    NH:17 HL:64 */
+static const uint8_t _ipv6_pkt[] = { 0x60, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x40,
+    /* source: 2001:db8:0:ef01::1 */
+    0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xef, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    /* destination: 2001:db8:0:abcd::<flow>, set in _recv() */
+    0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* UDP header and 8 bytes of payload */
+    0xf0, 0xb1, 0xf0, 0xb2, 0x00, 0x10, 0x00, 0x00,
+    0x54, 0xb8, 0x59, 0xaf, 0x3a, 0xb4, 0x5c, 0x85,
+};
+#define DST_OFFSET      (24U)
+
+static const uint8_t _nbr_mac[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00 };
+static const uint8_t _src_mac[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x01 };
+static const ipv6_addr_t _nbr = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0x55, 0x44, 0x33, 0xff, 0xfe, 0x22, 0x11, 0x00
+    } };
+static const ipv6_addr_t _dst = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0xab, 0xcd, 0, 0, 0, 0, 0, 0, 0, 0
+    } };
+
+static netdev_test_t _devs[IFACE_NUMOF];
+static gnrc_netif_t _netifs[IFACE_NUMOF];
+static char _stacks[IFACE_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static unsigned _forwarded;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    netdev_test_t *test = container_of(dev, netdev_test_t, netdev.netdev);
+    uint8_t *addr = value;
+
+    expect(max_len >= ETHERNET_ADDR_LEN);
+    memcpy(addr, "\xce\xab\xfe\xad\xf7\x00", ETHERNET_ADDR_LEN);
+    addr[ETHERNET_ADDR_LEN - 1] = (uintptr_t)test->state;
+    return ETHERNET_ADDR_LEN;
+}
+
+/* counts the frames forwarded to the neighbor */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    const ethernet_hdr_t *hdr = iolist->iol_base;
+
+    (void)dev;
+    if ((iolist->iol_len >= sizeof(*hdr)) &&
+        (memcmp(hdr->dst, _nbr_mac, sizeof(_nbr_mac)) == 0)) {
+        _forwarded++;
+    }
+    return iolist_size(iolist);
+}
+
+static void _init_netif(unsigned i)
+{
+    netdev_test_setup(&_devs[i], (void *)(uintptr_t)i);
+    netdev_test_set_get_cb(&_devs[i], NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_devs[i], NETOPT_MAX_PDU_SIZE,
+                           _get_max_packet_size);
+    netdev_test_set_get_cb(&_devs[i], NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_devs[i], _send);
+    expect(gnrc_netif_ethernet_create(&_netifs[i], _stacks[i],
+                                      sizeof(_stacks[i]), GNRC_NETIF_PRIO,
+                                      "bench_eth", &_devs[i].netdev.netdev) == 0);
+}
+
+/* hands a packet of a flow to IPv6 as if received on the incoming interface */
+static void _recv(unsigned flow)
+{
+    gnrc_pktsnip_t *netif_hdr, *pkt;
+    uint8_t dst_mac[ETHERNET_ADDR_LEN];
+
+    _get_address(&_devs[IFACE_IN].netdev.netdev, dst_mac, sizeof(dst_mac));
+    netif_hdr = gnrc_netif_hdr_build(_src_mac, sizeof(_src_mac),
+                                     dst_mac, sizeof(dst_mac));
+    expect(netif_hdr);
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netifs[IFACE_IN]);
+    pkt = gnrc_pktbuf_add(netif_hdr, _ipv6_pkt, sizeof(_ipv6_pkt),
+                          GNRC_NETTYPE_IPV6);
+    expect(pkt);
+    ((uint8_t *)pkt->data)[DST_OFFSET + sizeof(ipv6_addr_t) - 1] = flow + 1;
+    /* IPv6 and the interfaces have higher priority, so the packet is
+     * forwarded when this returns */
+    expect(gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                        GNRC_NETREG_DEMUX_CTX_ALL, pkt) == 1);
+}
+
+static void _bench(unsigned flows)
+{
+    _forwarded = 0;
+
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < REPEAT; i++) {
+        _recv(i % flows);
+    }
+    uint32_t total = ztimer_now(ZTIMER_USEC) - before;
+
+    expect(_forwarded == REPEAT);
+    /* total is in µs, print per packet in ns */
+    printf("%2u flows %8"PRIu32" us / %u = %"PRIu32" ns\n",
+           flows, total, REPEAT, (uint32_t)((total * 1000ULL) / REPEAT));
+}
+
+int main(void)
+{
+    puts("IPv6 forwarding benchmark.\n");
+
+    for (unsigned i = 0; i < IFACE_NUMOF; i++) {
+        _init_netif(i);
+    }
+    expect(gnrc_ipv6_nib_nc_set(&_nbr, _netifs[IFACE_OUT].pid,
+                                _nbr_mac, sizeof(_nbr_mac)) == 0);
+    expect(gnrc_ipv6_nib_ft_add(&_dst, DST_PFX_LEN, &_nbr,
+                                _netifs[IFACE_OUT].pid, 0) == 0);
+
+    _bench(1);
+    _bench(4);
+    _bench(8);
+
+#ifdef MODULE_GNRC_IPV6_FWD_CACHE
+    gnrc_ipv6_fwd_cache_stats_t stats;
+    gnrc_ipv6_fwd_cache_stats_get(&stats);
+    printf("cache: %"PRIu32" hits %"PRIu32" misses %"PRIu32" invalidations\n",
+           stats.hits, stats.misses, stats.invalidations);
+#endif
+
+    puts("done.");
+    return 0;
+}
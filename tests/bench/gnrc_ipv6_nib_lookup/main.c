@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC IPv6 NIB lookup benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "byteorder.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/ipv6/addr.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#include "_nib-internal.h"
+
+#ifndef NIB_SIZE
+#define NIB_SIZE        (256U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+#define IFACE           (2U)
+#define ROUTE_PFX_LEN   (48U)
+
+static const ipv6_addr_t _next_hop = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x1
+    } };
+
+/* 2001:db8::<n> */
+static void _neighbor(ipv6_addr_t *addr, unsigned n)
+{
+    ipv6_addr_from_str(addr, "2001:db8::");
+    addr->u16[7] = byteorder_htons(n + 1);
+}
+
+/* 2001:db8:<n>::/48 and an address within */
+static void _route(ipv6_addr_t *addr, unsigned n)
+{
+    ipv6_addr_from_str(addr, "2001:db8::1");
+    addr->u16[2] = byteorder_htons(n + 1);
+}
+
+static void _fill(unsigned size)
+{
+    ipv6_addr_t addr;
+
+    gnrc_ipv6_nib_init();
+    for (unsigned n = 0; n < size; n++) {
+        _neighbor(&addr, n);
+        expect(_nib_nc_add(&addr, IFACE,
+                           GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED) != NULL);
+        _route(&addr, n);
+        expect(_nib_offl_add(&_next_hop, IFACE, &addr, ROUTE_PFX_LEN,
+                             _FT) != NULL);
+    }
+}
+
+static void _print_result(const char *desc, unsigned size, uint32_t total)
+{
+    /* total is in µs, print per lookup in ns */
+    printf("%20s %4u entries %8"PRIu32" us / %u = %"PRIu32" ns\n",
+           desc, size, total, REPEAT, (uint32_t)((total * 1000ULL) / REPEAT));
+}
+
+static void _bench(unsigned size)
+{
+    ipv6_addr_t addr;
+    gnrc_ipv6_nib_ft_t fte;
+    uint32_t before, diff;
+
+    _fill(size);
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        _neighbor(&addr, n % size);
+        expect(_nib_onl_get(&addr, IFACE) != NULL);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    _print_result("neighbor hit", size, diff);
+
+    _neighbor(&addr, size);
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        expect(_nib_onl_get(&addr, IFACE) == NULL);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    _print_result("neighbor miss", size, diff);
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        _route(&addr, n % size);
+        expect(_nib_get_route(&addr, NULL, &fte) == 0);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    _print_result("route", size, diff);
+}
+
+int main(void)
+{
+    puts("NIB lookup benchmark.\n");
+    printf("index: %s\n", IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_INDEX) ? "on" : "off");
+
+    for (unsigned size = 4; size < NIB_SIZE; size *= 4) {
+        _bench(size);
+    }
+    _bench(NIB_SIZE);
+
+    puts("done.");
+    return 0;
+}
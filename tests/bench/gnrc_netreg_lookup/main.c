@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC netreg lookup benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/gnrc/netreg.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef NETREG_SIZE
+#define NETREG_SIZE     (256U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+/* first port registered */
+#define PORT            (5683U)
+
+static gnrc_netreg_entry_t _entries[NETREG_SIZE];
+static msg_t _msg_queue[2];
+
+static void _fill(unsigned size)
+{
+    gnrc_netreg_init();
+    for (unsigned n = 0; n < size; n++) {
+        gnrc_netreg_entry_init_pid(&_entries[n], PORT + n, thread_getpid());
+        expect(gnrc_netreg_register(GNRC_NETTYPE_UDP, &_entries[n]) == 0);
+    }
+}
+
+static void _print_result(const char *desc, unsigned size, uint32_t total)
+{
+    /* total is in µs, print per lookup in ns */
+    printf("%20s %4u entries %8"PRIu32" us / %u = %"PRIu32" ns\n",
+           desc, size, total, REPEAT, (uint32_t)((total * 1000ULL) / REPEAT));
+}
+
+static void _bench(unsigned size)
+{
+    uint32_t before, diff;
+
+    _fill(size);
+    gnrc_netreg_acquire_shared();
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        expect(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, PORT + (n % size)) != NULL);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    _print_result("hit", size, diff);
+
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < REPEAT; n++) {
+        expect(gnrc_netreg_lookup(GNRC_NETTYPE_UDP, PORT + size) == NULL);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+    _print_result("miss", size, diff);
+
+    gnrc_netreg_release_shared();
+}
+
+int main(void)
+{
+    /* only threads with a message queue may register */
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+
+    puts("netreg lookup benchmark.\n");
+    printf("buckets: %u\n", CONFIG_GNRC_NETREG_DEMUX_BUCKETS);
+
+    for (unsigned size = 4; size < NETREG_SIZE; size *= 4) {
+        _bench(size);
+    }
+    _bench(NETREG_SIZE);
+
+    puts("done.");
+    return 0;
+}
@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC 6LoWPAN IPHC receive benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/hdr.h"
+#include "net/gnrc/netif/ieee802154.h"
+#include "net/ieee802154.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+#define MSG_QUEUE_SIZE  (8U)
+#define SRC_PORT        (0xf0b1U)
+#define DST_PORT        (0xf0b2U)
+#define PAYLOAD_LEN     (64U)
+
+/* IEEE 802.15.4 header: data frame, PAN ID compression, long addresses */
+#define MHR_LEN         (21U)
+#define MHR_SRC_OFFSET  (13U)
+#define MHR_DST_OFFSET  (5U)
+/* IPHC: TF, HLIM 255, addresses elided, followed by UDP NHC with inline
+ * ports and checksum */
+#define IPHC_LEN        (2U + 7U)
+#define CSUM_OFFSET     (MHR_LEN + 7U)
+
+static const uint8_t _src_mac[IEEE802154_LONG_ADDRESS_LEN] = {
+    0x57, 0x44, 0x33, 0x22, 0x11, 0x00, 0xab, 0x01
+};
+static const uint8_t _local_mac[IEEE802154_LONG_ADDRESS_LEN] = {
+    0x57, 0x44, 0x33, 0x22, 0x11, 0x00, 0xab, 0x02
+};
+
+static uint8_t _frame[MHR_LEN + IPHC_LEN + PAYLOAD_LEN] = {
+    /* FCF, sequence number, destination PAN */
+    0x41, 0xcc, 0x00, 0x23, 0x00,
+    /* destination and source address, set in main() */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* IPHC: TF elided, NH compressed, HLIM 255 | SAM and DAM elided */
+    0x7f, 0x33,
+    /* UDP NHC: ports and checksum inline, checksum set in main() */
+    0xf0, SRC_PORT >> 8, SRC_PORT & 0xff, DST_PORT >> 8, DST_PORT & 0xff,
+    0x00, 0x00,
+};
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_IEEE802154;
+    return sizeof(uint16_t);
+}
+
+static int _get_proto(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(gnrc_nettype_t));
+    *((gnrc_nettype_t *)value) = GNRC_NETTYPE_SIXLOWPAN;
+    return sizeof(gnrc_nettype_t);
+}
+
+static int _get_max_pdu_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_FRAME_LEN_MAX;
+    return sizeof(uint16_t);
+}
+
+static int _get_src_len(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = IEEE802154_LONG_ADDRESS_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address_long(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_local_mac));
+    memcpy(value, _local_mac, sizeof(_local_mac));
+    return sizeof(_local_mac);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return sizeof(_frame);
+    }
+    expect((size_t)len >= sizeof(_frame));
+    memcpy(buf, _frame, sizeof(_frame));
+    return sizeof(_frame);
+}
+
+static void _isr(netdev_t *dev)
+{
+    dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+}
+
+/* addresses are sent in reversed byte order */
+static void _set_addr(uint8_t *dst, const uint8_t *addr)
+{
+    for (unsigned i = 0; i < IEEE802154_LONG_ADDRESS_LEN; i++) {
+        dst[i] = addr[IEEE802154_LONG_ADDRESS_LEN - 1 - i];
+    }
+}
+
+/* link-local address with the interface ID derived from an EUI-64 */
+static void _set_link_local(ipv6_addr_t *addr, const uint8_t *eui64)
+{
+    ipv6_addr_set_link_local_prefix(addr);
+    memcpy(&addr->u8[8], eui64, IEEE802154_LONG_ADDRESS_LEN);
+    addr->u8[8] ^= 0x02;
+}
+
+/* builds the frame, the checksum is calculated over the decompressed
+ * IPv6 and UDP header */
+static void _init_frame(ipv6_hdr_t *ipv6)
+{
+    udp_hdr_t udp;
+    uint8_t *payload = &_frame[MHR_LEN + IPHC_LEN];
+    uint16_t csum;
+
+    _set_addr(&_frame[MHR_DST_OFFSET], _local_mac);
+    _set_addr(&_frame[MHR_SRC_OFFSET], _src_mac);
+    for (unsigned i = 0; i < PAYLOAD_LEN; i++) {
+        payload[i] = i;
+    }
+
+    memset(ipv6, 0, sizeof(*ipv6));
+    _set_link_local(&ipv6->src, _src_mac);
+    _set_link_local(&ipv6->dst, _local_mac);
+
+    udp.src_port = byteorder_htons(SRC_PORT);
+    udp.dst_port = byteorder_htons(DST_PORT);
+    udp.length = byteorder_htons(sizeof(udp) + PAYLOAD_LEN);
+    udp.checksum.u16 = 0;
+    csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_UDP, sizeof(udp) + PAYLOAD_LEN);
+    csum = inet_csum(csum, (uint8_t *)&udp, sizeof(udp));
+    csum = ~inet_csum(csum, payload, PAYLOAD_LEN);
+    _frame[CSUM_OFFSET] = csum >> 8;
+    _frame[CSUM_OFFSET + 1] = csum & 0xff;
+}
+
+static void _check(gnrc_pktsnip_t *pkt, const ipv6_hdr_t *exp)
+{
+    gnrc_pktsnip_t *ipv6 = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_IPV6);
+    ipv6_hdr_t *hdr;
+
+    expect(pkt->type == GNRC_NETTYPE_UNDEF);
+    expect(pkt->size == PAYLOAD_LEN);
+    expect(memcmp(pkt->data, &_frame[MHR_LEN + IPHC_LEN], PAYLOAD_LEN) == 0);
+    expect(ipv6 != NULL);
+    hdr = ipv6->data;
+    expect(ipv6_addr_equal(&hdr->src, &exp->src));
+    expect(ipv6_addr_equal(&hdr->dst, &exp->dst));
+    expect(byteorder_ntohs(hdr->len) == sizeof(udp_hdr_t) + PAYLOAD_LEN);
+}
+
+int main(void)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(DST_PORT,
+                                                           thread_getpid());
+    ipv6_hdr_t ipv6;
+    msg_t msg;
+
+    puts("6LoWPAN IPHC receive benchmark.\n");
+
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    _init_frame(&ipv6);
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_PROTO, _get_proto);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_pdu_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_SRC_LEN, _get_src_len);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS_LONG, _get_address_long);
+    netdev_test_set_recv_cb(&_dev, _recv);
+    netdev_test_set_isr_cb(&_dev, _isr);
+    expect(gnrc_netif_ieee802154_create(&_netif, _netif_stack,
+                                        sizeof(_netif_stack), GNRC_NETIF_PRIO,
+                                        "bench_15.4", &_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &ipv6.dst, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry);
+
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+    for (unsigned i = 0; i < REPEAT; i++) {
+        netdev_trigger_event_isr(&_dev.netdev.netdev);
+        msg_receive(&msg);
+        expect(msg.type == GNRC_NETAPI_MSG_TYPE_RCV);
+        _check(msg.content.ptr, &ipv6);
+        gnrc_pktbuf_release(msg.content.ptr);
+    }
+    uint32_t total = ztimer_now(ZTIMER_USEC) - before;
+
+    printf("%u frames %"PRIu32" us, %"PRIu32" ns per frame\n", REPEAT, total,
+           (uint32_t)(((uint64_t)total * NS_PER_US) / REPEAT));
+
+    puts("done.");
+    return 0;
+}
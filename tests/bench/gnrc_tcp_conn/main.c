@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP benchmark with many connections
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "mbox.h"
+#include "net/ethernet.h"
+#include "net/af.h"
+#include "net/ethernet/hdr.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/tcp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef CONNECTIONS
+#define CONNECTIONS     (64U)
+#endif
+
+#ifndef ROUNDS
+#define ROUNDS          (10U)
+#endif
+
+#define SERVER_PORT     (80U)
+#define USER_TIMEOUT_MS (10U * MS_PER_SEC)
+#define LINK_QUEUE_SIZE (64U)
+
+#define TCP_CTL_SYN     (0x0002)
+
+/* link-local address of the node, set statically to not depend on the
+ * auto-configuration of the interface */
+static const ipv6_addr_t _local = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    } };
+/* link-local address of the peer, all frames sent to it are reflected */
+static const ipv6_addr_t _peer = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02
+    } };
+static const uint8_t _peer_mac[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00 };
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static gnrc_tcp_tcb_t _clients[CONNECTIONS];
+static gnrc_tcp_tcb_t _servers[CONNECTIONS];
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+
+static char _link_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _link_queue[LINK_QUEUE_SIZE];
+static mbox_t _link = MBOX_INIT(_link_queue, LINK_QUEUE_SIZE);
+
+/* drop all segments of the clients except SYNs, leaving handshakes half-open */
+static volatile bool _half_open;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= ETHERNET_ADDR_LEN);
+    memcpy(value, "\xce\xab\xfe\xad\xf7\x00", ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+/* reflects TCP segments back into the interface as if sent by the peer */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    size_t size = iolist_size(iolist);
+    gnrc_pktsnip_t *netif_hdr, *pkt;
+    ipv6_hdr_t *ipv6;
+
+    (void)dev;
+    expect(iolist->iol_len == sizeof(ethernet_hdr_t));
+    if (size < sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + sizeof(tcp_hdr_t)) {
+        return size;
+    }
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    if (netif_hdr == NULL) {
+        return size;
+    }
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    pkt = gnrc_pktbuf_add(netif_hdr, NULL, size - sizeof(ethernet_hdr_t),
+                          GNRC_NETTYPE_IPV6);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(netif_hdr);
+        return size;
+    }
+    iolist_to_buffer(iolist->iol_next, pkt->data, pkt->size);
+
+    ipv6 = pkt->data;
+    if (ipv6->nh != PROTNUM_TCP) {
+        gnrc_pktbuf_release(pkt);
+        return size;
+    }
+    tcp_hdr_t *tcp = (tcp_hdr_t *)(ipv6 + 1);
+    if (_half_open && byteorder_ntohs(tcp->dst_port) == SERVER_PORT &&
+        !(byteorder_ntohs(tcp->off_ctl) & TCP_CTL_SYN)) {
+        gnrc_pktbuf_release(pkt);
+        return size;
+    }
+
+    /* the pseudo header checksum does not depend on the order of the
+     * addresses, so the TCP checksum stays valid */
+    ipv6_addr_t tmp = ipv6->src;
+    ipv6->src = ipv6->dst;
+    ipv6->dst = tmp;
+
+    msg_t msg = { .content.ptr = pkt };
+    expect(mbox_try_put(&_link, &msg) == 1);
+    return size;
+}
+
+/* delivers the reflected segments when all other threads are idle, which
+ * delays them like a link with latency would */
+static void *_link_thread(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    while (1) {
+        mbox_get(&_link, &msg);
+        if (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                         GNRC_NETREG_DEMUX_CTX_ALL,
+                                         msg.content.ptr) == 0) {
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return NULL;
+}
+
+static void _connect(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_tcp_ep_t remote;
+
+    expect(gnrc_tcp_ep_init(&remote, AF_INET6, _peer.u8, sizeof(_peer),
+                            SERVER_PORT, _netif.pid) == 0);
+    gnrc_tcp_tcb_init(tcb);
+    expect(gnrc_tcp_open(tcb, &remote, 0) == 0);
+}
+
+/* handshakes whose final ACK is lost must not take the TCBs of the server */
+static void _bench_half_open(void)
+{
+    _half_open = true;
+    uint32_t before = ztimer_now(ZTIMER_MSEC);
+    for (unsigned i = 0; i < CONNECTIONS; i++) {
+        _connect(&_clients[0]);
+        gnrc_tcp_abort(&_clients[0]);
+    }
+    uint32_t total = ztimer_now(ZTIMER_MSEC) - before;
+    _half_open = false;
+
+    printf("%u half-open handshakes %6"PRIu32" ms\n", CONNECTIONS, total);
+}
+
+static void _bench_setup(void)
+{
+    uint32_t before = ztimer_now(ZTIMER_MSEC);
+    for (unsigned i = 0; i < CONNECTIONS; i++) {
+        _connect(&_clients[i]);
+    }
+    uint32_t total = ztimer_now(ZTIMER_MSEC) - before;
+
+    printf("%u connections set up   %6"PRIu32" ms\n", CONNECTIONS, total);
+}
+
+/* every send waits for its acknowledgement, so each round passes two
+ * segments per connection through the connection table */
+static void _bench_rounds(void)
+{
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+    for (unsigned r = 0; r < ROUNDS; r++) {
+        for (unsigned i = 0; i < CONNECTIONS; i++) {
+            expect(gnrc_tcp_send(&_clients[i], "x", 1, USER_TIMEOUT_MS) == 1);
+        }
+    }
+    uint32_t total = ztimer_now(ZTIMER_USEC) - before;
+
+    printf("%u rounds of 1 byte      %6"PRIu32" ms, %"PRIu32" us per send\n",
+           ROUNDS, (uint32_t)(total / US_PER_MS), total / (ROUNDS * CONNECTIONS));
+}
+
+int main(void)
+{
+    gnrc_tcp_ep_t local;
+
+    puts("TCP connection benchmark.\n");
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                      GNRC_NETIF_PRIO, "bench_eth",
+                                      &_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_local, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    expect(gnrc_ipv6_nib_nc_set(&_peer, _netif.pid, _peer_mac,
+                                sizeof(_peer_mac)) == 0);
+
+    thread_create(_link_stack, sizeof(_link_stack), THREAD_PRIORITY_MAIN + 1,
+                  0, _link_thread, NULL, "link");
+
+    /* the server only listens, the eventloop completes the handshakes */
+    expect(gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, SERVER_PORT, 0) == 0);
+    for (unsigned i = 0; i < CONNECTIONS; i++) {
+        gnrc_tcp_tcb_init(&_servers[i]);
+    }
+    expect(gnrc_tcp_listen(&_queue, _servers, CONNECTIONS, &local) == 0);
+
+    _bench_half_open();
+    _bench_setup();
+    _bench_rounds();
+
+    puts("done.");
+    return 0;
+}
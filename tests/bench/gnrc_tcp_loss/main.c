@@ -0,0 +1,376 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP throughput benchmark with injected losses
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "macros/utils.h"
+#include "mbox.h"
+#include "mutex.h"
+#include "net/ethernet.h"
+#include "net/af.h"
+#include "net/ethernet/hdr.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/tcp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE   (256U * 1024U)
+#endif
+
+#ifndef SMALL_WRITES
+#define SMALL_WRITES    (1000U)
+#endif
+
+#define CHUNK_SIZE      (16U * 1024U)
+#define SMALL_SIZE      (16U)
+#define SERVER_PORT     (80U)
+#define USER_TIMEOUT_MS (60U * MS_PER_SEC)
+#define LINK_QUEUE_SIZE (64U)
+
+#define TCP_CTL_SYN     (0x0002)
+#define TCP_OFFSET(x)   (((x) >> 12) * 4U)
+
+/* link-local address of the node, set statically to not depend on the
+ * auto-configuration of the interface */
+static const ipv6_addr_t _local = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    } };
+/* link-local address of the peer, all frames sent to it are reflected */
+static const ipv6_addr_t _peer = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02
+    } };
+static const uint8_t _peer_mac[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00 };
+
+/* losses in per mille of the data segments sent by the client */
+static const unsigned _losses[] = { 0, 10, 50 };
+
+/* how small writes are sent */
+enum {
+    MODE_BULK,          /* not small writes */
+    MODE_NODELAY,       /* right away */
+    MODE_NAGLE,         /* coalesced while data is in flight */
+    MODE_CORK,          /* coalesced until uncorked */
+};
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static gnrc_tcp_tcb_t _client;
+static gnrc_tcp_tcb_t _server;
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static char _server_stack[THREAD_STACKSIZE_MAIN];
+static mutex_t _server_done = MUTEX_INIT_LOCKED;
+static uint32_t _received;
+static uint32_t _received_at;
+static unsigned _corrupted;
+static uint32_t _transfer_size;
+
+static char _link_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _link_queue[LINK_QUEUE_SIZE];
+static mbox_t _link = MBOX_INIT(_link_queue, LINK_QUEUE_SIZE);
+
+static uint8_t _buf[CHUNK_SIZE];
+
+/* written by the interface thread only */
+static unsigned _loss;
+static uint32_t _rand;
+static uint32_t _snd_max;
+static unsigned _segments;
+static unsigned _dropped;
+static unsigned _retransmitted;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= ETHERNET_ADDR_LEN);
+    memcpy(value, "\xce\xab\xfe\xad\xf7\x00", ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+static uint8_t _pattern(uint32_t offset)
+{
+    /* not a power of two, so shifted data is detected */
+    return offset % 251;
+}
+
+/* decides if a data segment of the client is lost, deterministic per run */
+static bool _lose(const tcp_hdr_t *tcp, size_t len)
+{
+    uint32_t seq = byteorder_ntohl(tcp->seq_num);
+    uint32_t end = seq + len;
+
+    if (byteorder_ntohs(tcp->dst_port) != SERVER_PORT) {
+        return false;
+    }
+    if (byteorder_ntohs(tcp->off_ctl) & TCP_CTL_SYN) {
+        _snd_max = seq + 1;
+        return false;
+    }
+    if (len == 0) {
+        return false;
+    }
+    if ((int32_t)(end - _snd_max) <= 0) {
+        _retransmitted++;
+    }
+    else {
+        _snd_max = end;
+        _segments++;
+    }
+    _rand = _rand * 1103515245U + 12345U;
+    if (((_rand >> 16) % 1000) < _loss) {
+        _dropped++;
+        return true;
+    }
+    return false;
+}
+
+/* reflects TCP segments back into the interface as if sent by the peer */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    size_t size = iolist_size(iolist);
+    gnrc_pktsnip_t *netif_hdr, *pkt;
+    ipv6_hdr_t *ipv6;
+
+    (void)dev;
+    expect(iolist->iol_len == sizeof(ethernet_hdr_t));
+    if (size < sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + sizeof(tcp_hdr_t)) {
+        return size;
+    }
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    if (netif_hdr == NULL) {
+        return size;
+    }
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    pkt = gnrc_pktbuf_add(netif_hdr, NULL, size - sizeof(ethernet_hdr_t),
+                          GNRC_NETTYPE_IPV6);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(netif_hdr);
+        return size;
+    }
+    iolist_to_buffer(iolist->iol_next, pkt->data, pkt->size);
+
+    ipv6 = pkt->data;
+    if (ipv6->nh != PROTNUM_TCP) {
+        gnrc_pktbuf_release(pkt);
+        return size;
+    }
+    tcp_hdr_t *tcp = (tcp_hdr_t *)(ipv6 + 1);
+    size_t hdr_len = TCP_OFFSET(byteorder_ntohs(tcp->off_ctl));
+    if (_lose(tcp, byteorder_ntohs(ipv6->len) - hdr_len)) {
+        gnrc_pktbuf_release(pkt);
+        return size;
+    }
+
+    /* the pseudo header checksum does not depend on the order of the
+     * addresses, so the TCP checksum stays valid */
+    ipv6_addr_t tmp = ipv6->src;
+    ipv6->src = ipv6->dst;
+    ipv6->dst = tmp;
+
+    msg_t msg = { .content.ptr = pkt };
+    expect(mbox_try_put(&_link, &msg) == 1);
+    return size;
+}
+
+/* delivers the reflected segments when all other threads are idle, which
+ * delays them like a link with latency would */
+static void *_link_thread(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    while (1) {
+        mbox_get(&_link, &msg);
+        if (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                         GNRC_NETREG_DEMUX_CTX_ALL,
+                                         msg.content.ptr) == 0) {
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return NULL;
+}
+
+static void *_server_thread(void *arg)
+{
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *tcb;
+
+    (void)arg;
+    expect(gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, SERVER_PORT, 0) == 0);
+    gnrc_tcp_tcb_init(&_server);
+    expect(gnrc_tcp_listen(&_queue, &_server, 1, &local) == 0);
+
+    while (1) {
+        expect(gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT) == 0);
+        _received = 0;
+        _corrupted = 0;
+
+        ssize_t res;
+        static uint8_t buf[CHUNK_SIZE];
+        while ((res = gnrc_tcp_recv(tcb, buf, sizeof(buf), USER_TIMEOUT_MS)) > 0) {
+            for (ssize_t i = 0; i < res; i++) {
+                if (buf[i] != _pattern(_received + i)) {
+                    _corrupted++;
+                }
+            }
+            _received += res;
+            if (_received == _transfer_size) {
+                _received_at = ztimer_now(ZTIMER_MSEC);
+            }
+        }
+        gnrc_tcp_close(tcb);
+        mutex_unlock(&_server_done);
+    }
+    return NULL;
+}
+
+static void _set_mode(unsigned mode)
+{
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+    expect(gnrc_tcp_set_nodelay(&_client, mode == MODE_NODELAY) == 0);
+    expect(gnrc_tcp_set_cork(&_client, mode == MODE_CORK) == 0);
+#else
+    (void)mode;
+#endif
+}
+
+/* sends the data in writes of write_size and returns the time it took until
+ * the server received all of it */
+static uint32_t _transfer(unsigned loss, unsigned mode, size_t write_size,
+                          uint32_t size)
+{
+    gnrc_tcp_ep_t remote;
+
+    _loss = loss;
+    _rand = 1;
+    _segments = 0;
+    _dropped = 0;
+    _retransmitted = 0;
+    _transfer_size = size;
+
+    expect(gnrc_tcp_ep_init(&remote, AF_INET6, _peer.u8, sizeof(_peer),
+                            SERVER_PORT, _netif.pid) == 0);
+    gnrc_tcp_tcb_init(&_client);
+    _set_mode(mode);
+    expect(gnrc_tcp_open(&_client, &remote, 0) == 0);
+
+    uint32_t before = ztimer_now(ZTIMER_MSEC);
+    for (uint32_t sent = 0; sent < size;) {
+        size_t len = MIN(write_size, size - sent);
+
+        for (size_t i = 0; i < len; i++) {
+            _buf[i] = _pattern(sent + i);
+        }
+        ssize_t res = gnrc_tcp_send(&_client, _buf, len, USER_TIMEOUT_MS);
+        expect(res > 0);
+        sent += res;
+    }
+    if (mode == MODE_CORK) {
+        _set_mode(MODE_NAGLE);
+    }
+
+    gnrc_tcp_close(&_client);
+    mutex_lock(&_server_done);
+    expect(_received == size);
+    expect(_corrupted == 0);
+    return _received_at - before;
+}
+
+static void _bench(unsigned loss)
+{
+    uint32_t total = _transfer(loss, MODE_BULK, CHUNK_SIZE, TRANSFER_SIZE);
+
+    printf("loss %2u.%u %% %6"PRIu32" ms %6"PRIu32" KiB/s, "
+           "%u dropped %u retransmitted\n",
+           loss / 10, loss % 10, total,
+           (uint32_t)((TRANSFER_SIZE * 1000ULL) / (MAX(total, 1U) * 1024U)),
+           _dropped, _retransmitted);
+}
+
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+/* coalescing small writes needs a send buffer */
+static void _bench_small_writes(unsigned mode, const char *name)
+{
+    uint32_t total = _transfer(0, mode, SMALL_SIZE, SMALL_WRITES * SMALL_SIZE);
+
+    printf("%u writes of %u bytes, %-7s %6"PRIu32" ms, %u segments\n",
+           SMALL_WRITES, SMALL_SIZE, name, total, _segments);
+}
+#endif
+
+int main(void)
+{
+    puts("TCP loss benchmark.\n");
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                      GNRC_NETIF_PRIO, "bench_eth",
+                                      &_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_local, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    expect(gnrc_ipv6_nib_nc_set(&_peer, _netif.pid, _peer_mac,
+                                sizeof(_peer_mac)) == 0);
+
+    thread_create(_link_stack, sizeof(_link_stack), THREAD_PRIORITY_MAIN + 1,
+                  0, _link_thread, NULL, "link");
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _server_thread, NULL, "server");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_losses); i++) {
+        _bench(_losses[i]);
+    }
+#if CONFIG_GNRC_TCP_SND_BUF_SIZE
+    _bench_small_writes(MODE_NODELAY, "nodelay");
+    _bench_small_writes(MODE_NAGLE, "nagle");
+    _bench_small_writes(MODE_CORK, "cork");
+#endif
+
+    puts("done.");
+    return 0;
+}
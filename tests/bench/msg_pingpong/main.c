@@ -21,6 +21,7 @@
 #include <stdint.h>
 #include <stdatomic.h>
 #include <stdio.h>
+#include "container.h"
 #include "macros/units.h"
 #include "thread.h"
 #include "clk.h"
@@ -32,7 +33,11 @@
 #define TEST_DURATION_US    (1000000U)
 #endif
 
+#define BATCH_SIZE_MAX      (16U)
+
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _bulk_stack[THREAD_STACKSIZE_MAIN];
+static msg_t _bulk_queue[BATCH_SIZE_MAX];
 
 static void _timer_callback(void *_flag)
 {
@@ -52,6 +57,49 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_bulk_thread(void *arg)
+{
+    (void)arg;
+
+    msg_init_queue(_bulk_queue, ARRAY_SIZE(_bulk_queue));
+    while (1) {
+        msg_t test[BATCH_SIZE_MAX];
+        msg_receive_bulk(test, ARRAY_SIZE(test));
+    }
+
+    return NULL;
+}
+
+static void _print_result(uint32_t n)
+{
+    printf("{ \"result\" : %"PRIu32, n);
+    printf(", \"ticks\" : %"PRIu32,
+           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
+    puts(" }");
+}
+
+static uint32_t _run(kernel_pid_t other, unsigned batch)
+{
+    atomic_flag flag = ATOMIC_FLAG_INIT;
+    uint32_t n = 0;
+
+    xtimer_t timer = {
+        .callback = _timer_callback,
+        .arg = &flag,
+    };
+
+    atomic_flag_test_and_set(&flag);
+    xtimer_set(&timer, TEST_DURATION_US);
+
+    while (atomic_flag_test_and_set(&flag)) {
+        msg_t test[BATCH_SIZE_MAX];
+        msg_send_bulk(test, batch, other);
+        n += batch;
+    }
+
+    return n;
+}
+
 int main(void)
 {
     puts("main starting");
@@ -81,10 +129,23 @@ int main(void)
         n++;
     }
 
-    printf("{ \"result\" : %"PRIu32, n);
-    printf(", \"ticks\" : %"PRIu32,
-           (uint32_t)((TEST_DURATION_US/US_PER_MS) * (coreclk()/KHZ(1)))/n);
-    puts(" }");
+    _print_result(n);
+
+    /* batched variant, the receiver drains its queue with one call */
+    other = thread_create(_bulk_stack,
+                          sizeof(_bulk_stack),
+                          (THREAD_PRIORITY_MAIN - 1),
+                          0,
+                          _bulk_thread,
+                          NULL,
+                          "bulk_thread");
+
+    static const unsigned batch_sizes[] = { 1, 4, BATCH_SIZE_MAX };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(batch_sizes); i++) {
+        printf("batch size %2u: ", batch_sizes[i]);
+        _print_result(_run(other, batch_sizes[i]));
+    }
 
     return 0;
 }
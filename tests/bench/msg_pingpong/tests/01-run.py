@@ -13,6 +13,9 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+(, \"ticks\" : \d+)? }")
+    for batch in (1, 4, 16):
+        child.expect(r"batch size\s+{}: {{ \"result\" : \d+(, \"ticks\" : \d+)? }}"
+                     .format(batch))
 
 
 if __name__ == "__main__":
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       MTD write-back sector cache benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "mtd.h"
+#include "mtd_cache.h"
+#include "mtd_emulated.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#define SECTOR_COUNT        (16U)
+#define PAGES_PER_SECTOR    (4U)
+#define PAGE_SIZE           (64U)
+#define SECTOR_SIZE         (PAGES_PER_SECTOR * PAGE_SIZE)
+#define MTD_SIZE            (SECTOR_COUNT * SECTOR_SIZE)
+
+/* size of a single write */
+#define RECORD_SIZE         (16U)
+
+/* sectors the records are overwritten in */
+#define OVERWRITE_SECTORS   (2U)
+
+MTD_EMULATED_DEV(0, SECTOR_COUNT, PAGES_PER_SECTOR, PAGE_SIZE);
+
+/* counts the operations on the emulated device */
+typedef struct {
+    mtd_dev_t mtd;
+    mtd_dev_t *parent;
+    unsigned written;
+    unsigned erases;
+} _counter_t;
+
+static int _counter_init(mtd_dev_t *mtd)
+{
+    _counter_t *counter = container_of(mtd, _counter_t, mtd);
+    mtd_dev_t *parent = counter->parent;
+
+    mtd->sector_count = parent->sector_count;
+    mtd->pages_per_sector = parent->pages_per_sector;
+    mtd->page_size = parent->page_size;
+    mtd->write_size = parent->write_size;
+    return mtd_init(parent);
+}
+
+static int _counter_read(mtd_dev_t *mtd, void *dest, uint32_t addr,
+                         uint32_t count)
+{
+    _counter_t *counter = container_of(mtd, _counter_t, mtd);
+
+    return mtd_read(counter->parent, dest, addr, count);
+}
+
+static int _counter_write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                               uint32_t offset, uint32_t count)
+{
+    _counter_t *counter = container_of(mtd, _counter_t, mtd);
+
+    counter->written += count;
+    int res = mtd_write_page_raw(counter->parent, src, page, offset, count);
+    return (res < 0) ? res : (int)count;
+}
+
+static int _counter_erase_sector(mtd_dev_t *mtd, uint32_t sector,
+                                 uint32_t count)
+{
+    _counter_t *counter = container_of(mtd, _counter_t, mtd);
+
+    counter->erases += count;
+    return mtd_erase_sector(counter->parent, sector, count);
+}
+
+static const mtd_desc_t _counter_driver = {
+    .init = _counter_init,
+    .read = _counter_read,
+    .write_page = _counter_write_page,
+    .erase_sector = _counter_erase_sector,
+};
+
+static _counter_t _counter = {
+    .mtd = { .driver = &_counter_driver },
+    .parent = &mtd_emulated_dev0.base,
+};
+
+static uint8_t _cache_buf[CONFIG_MTD_CACHE_SECTORS * SECTOR_SIZE];
+static mtd_cache_t _cache = MTD_CACHE_INIT(&_counter.mtd, _cache_buf);
+
+static uint8_t _expected[MTD_SIZE];
+static uint8_t _read_buf[MTD_SIZE];
+static unsigned _writes;
+
+static void _record(uint8_t *record, unsigned n)
+{
+    memset(record, n, RECORD_SIZE);
+}
+
+static void _write(mtd_dev_t *dev, uint32_t addr, unsigned n)
+{
+    uint8_t record[RECORD_SIZE];
+
+    _record(record, n);
+    expect(mtd_write_page(dev, record, addr / PAGE_SIZE, addr % PAGE_SIZE,
+                          sizeof(record)) == 0);
+    memcpy(&_expected[addr], record, sizeof(record));
+    _writes++;
+}
+
+/* appends records to erased memory, like a log or a file growing */
+static void _append(mtd_dev_t *dev)
+{
+    for (unsigned n = 0; n < MTD_SIZE / RECORD_SIZE; n++) {
+        _write(dev, n * RECORD_SIZE, n);
+    }
+}
+
+/* overwrites records in a few sectors, like a file allocation table */
+static void _overwrite(mtd_dev_t *dev)
+{
+    for (unsigned n = 0; n < MTD_SIZE / RECORD_SIZE; n++) {
+        uint32_t addr = ((n * 7) * RECORD_SIZE) % (OVERWRITE_SECTORS * SECTOR_SIZE);
+
+        _write(dev, addr, n);
+    }
+}
+
+/* overwrites records in sectors already written */
+static void _rewrite(mtd_dev_t *dev)
+{
+    _append(dev);
+    expect(mtd_sync(dev) == 0);
+    _overwrite(dev);
+}
+
+static void _run(const char *desc, mtd_dev_t *dev, void (*workload)(mtd_dev_t *))
+{
+    expect(mtd_erase_sector(dev, 0, SECTOR_COUNT) == 0);
+    expect(mtd_sync(dev) == 0);
+    memset(_expected, 0xff, sizeof(_expected));
+    _counter.written = 0;
+    _writes = 0;
+    _counter.erases = 0;
+
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+    workload(dev);
+    expect(mtd_sync(dev) == 0);
+    uint32_t total = ztimer_now(ZTIMER_USEC) - before;
+
+    /* the data must have reached the device */
+    expect(mtd_read(&_counter.mtd, _read_buf, 0, sizeof(_read_buf)) == 0);
+    expect(memcmp(_read_buf, _expected, sizeof(_expected)) == 0);
+
+    printf("%16s %4u writes of %u B: %6u B written %4u erases %6"PRIu32" us\n",
+           desc, _writes, RECORD_SIZE, _counter.written,
+           _counter.erases, total);
+}
+
+int main(void)
+{
+    puts("MTD cache benchmark.\n");
+
+    expect(mtd_init(&_counter.mtd) == 0);
+    expect(mtd_init(&_cache.mtd) == 0);
+
+    _run("append", &_counter.mtd, _append);
+    _run("append cached", &_cache.mtd, _append);
+    _run("overwrite", &_counter.mtd, _overwrite);
+    _run("overwrite cached", &_cache.mtd, _overwrite);
+    _run("rewrite", &_counter.mtd, _rewrite);
+    _run("rewrite cached", &_cache.mtd, _rewrite);
+
+    mtd_cache_stats_t stats;
+    mtd_cache_stats_get(&_cache, &stats);
+    printf("cache: %"PRIu32" hits %"PRIu32" misses %"PRIu32" writes %"PRIu32
+           " erases\n", stats.hits, stats.misses, stats.writes, stats.erases);
+
+    puts("done.");
+    return 0;
+}
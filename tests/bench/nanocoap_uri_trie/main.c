@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       nanocoap URI-Path trie benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "net/nanocoap/uri_trie.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef URI_TRIE_SIZE
+#define URI_TRIE_SIZE   (1000U)
+#endif
+
+#ifndef REPEAT
+#define REPEAT          (10000U)
+#endif
+
+/* number of different requests dispatched in turn */
+#define REQUESTS        (16U)
+
+#define PATH_LEN        sizeof("/dev/0000/temp")
+
+static char _paths[URI_TRIE_SIZE][PATH_LEN];
+static coap_resource_t _resources[URI_TRIE_SIZE];
+static coap_uri_trie_node_t _nodes[COAP_URI_TRIE_NODES_NUMOF(URI_TRIE_SIZE)];
+static uint16_t _next[URI_TRIE_SIZE];
+static coap_uri_trie_t _trie = COAP_URI_TRIE_INIT(_nodes, _next);
+
+static uint8_t _req_bufs[REQUESTS + 1][32];
+static coap_pkt_t _reqs[REQUESTS + 1];
+static uint8_t _resp_buf[32];
+static unsigned _size;
+static unsigned _hits;
+
+static ssize_t _handler(coap_pkt_t *pkt, uint8_t *buf, size_t len,
+                        coap_request_ctx_t *ctx)
+{
+    (void)pkt;
+    (void)buf;
+    (void)len;
+    (void)ctx;
+    _hits++;
+    return 0;
+}
+
+static void _build_req(unsigned idx, const char *path)
+{
+    size_t len = coap_build_hdr((coap_hdr_t *)_req_bufs[idx], COAP_TYPE_NON,
+                                NULL, 0, COAP_METHOD_GET, idx);
+
+    coap_pkt_init(&_reqs[idx], _req_bufs[idx], sizeof(_req_bufs[idx]), len);
+    expect(coap_opt_add_uri_path(&_reqs[idx], path) > 0);
+    coap_opt_finish(&_reqs[idx], COAP_OPT_FINISH_NONE);
+}
+
+static void _setup(unsigned size)
+{
+    for (unsigned n = 0; n < size; n++) {
+        snprintf(_paths[n], PATH_LEN, "/dev/%04u/temp", n);
+        _resources[n] = (coap_resource_t){
+            .path = _paths[n],
+            .methods = COAP_GET,
+            .handler = _handler,
+        };
+    }
+    _size = size;
+    expect(coap_uri_trie_build(&_trie, _resources, size) == 0);
+
+    /* requests spread over all resources, the last one is not found */
+    for (unsigned n = 0; n < REQUESTS; n++) {
+        _build_req(n, _paths[(n * size) / REQUESTS]);
+    }
+    _build_req(REQUESTS, "/dev/none/temp");
+}
+
+static void _print_result(const char *desc, unsigned size, uint32_t total)
+{
+    /* total is in µs, print per request in ns */
+    printf("%14s %4u resources %8"PRIu32" us / %u = %"PRIu32" ns\n",
+           desc, size, total, REPEAT, (uint32_t)((total * 1000ULL) / REPEAT));
+}
+
+static uint32_t _run(bool trie, bool hit)
+{
+    coap_request_ctx_t ctx = { 0 };
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned n = 0; n < REPEAT; n++) {
+        coap_pkt_t *pkt = &_reqs[hit ? (n % REQUESTS) : REQUESTS];
+
+        if (trie) {
+            coap_uri_trie_handler(pkt, _resp_buf, sizeof(_resp_buf), &ctx,
+                                  &_trie);
+        }
+        else {
+            coap_tree_handler(pkt, _resp_buf, sizeof(_resp_buf), &ctx,
+                              _resources, _size);
+        }
+    }
+    return ztimer_now(ZTIMER_USEC) - before;
+}
+
+static void _bench(unsigned size)
+{
+    _setup(size);
+
+    _hits = 0;
+    _print_result("linear hit", size, _run(false, true));
+    _print_result("trie hit", size, _run(true, true));
+    expect(_hits == 2 * REPEAT);
+    _print_result("linear miss", size, _run(false, false));
+    _print_result("trie miss", size, _run(true, false));
+    expect(_hits == 2 * REPEAT);
+}
+
+int main(void)
+{
+    puts("nanocoap URI trie benchmark.\n");
+
+    for (unsigned size = 10; size < URI_TRIE_SIZE; size *= 10) {
+        _bench(size);
+    }
+    _bench(URI_TRIE_SIZE);
+
+    puts("done.");
+    return 0;
+}
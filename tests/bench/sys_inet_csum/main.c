@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for inet_csum_slice()
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "container.h"
+#include "net/inet_csum.h"
+#include "ztimer.h"
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS    (1000U)
+#endif
+
+static const uint16_t _lens[] = { 40, 256, 1280 };
+static uint8_t _data[1280 + 1];
+
+/* the byte-wise implementation inet_csum_slice() used before, for comparison */
+static uint16_t _bytewise_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i * 7;
+    }
+
+    for (unsigned offset = 0; offset < 2; offset++) {
+        for (unsigned i = 0; i < ARRAY_SIZE(_lens); i++) {
+            const uint8_t *buf = &_data[offset];
+            uint16_t len = _lens[i];
+            /* volatile, so the loops aren't optimized out */
+            volatile uint16_t ref, res;
+            uint32_t start, bytewise, slice;
+
+            start = ztimer_now(ZTIMER_USEC);
+            for (unsigned n = 0; n < BENCH_ITERATIONS; n++) {
+                ref = _bytewise_csum(n, buf, len);
+            }
+            bytewise = ztimer_now(ZTIMER_USEC) - start;
+
+            start = ztimer_now(ZTIMER_USEC);
+            for (unsigned n = 0; n < BENCH_ITERATIONS; n++) {
+                res = inet_csum_slice(n, buf, len, 0);
+            }
+            slice = ztimer_now(ZTIMER_USEC) - start;
+
+            if (ref != res) {
+                puts("FAILED");
+                return 1;
+            }
+            printf("%u x %4u bytes (offset %u): byte-wise %6" PRIu32
+                   " us, inet_csum_slice() %6" PRIu32 " us\n",
+                   BENCH_ITERATIONS, len, offset, bytewise, slice);
+        }
+    }
+    puts("done.");
+
+    return 0;
+}
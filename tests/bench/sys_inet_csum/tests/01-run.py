@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for offset in (0, 1):
+        for length in (40, 256, 1280):
+            child.expect(r"\d+ x\s+{} bytes \(offset {}\): byte-wise\s+\d+ us, "
+                         r"inet_csum_slice\(\)\s+\d+ us\r\n".format(length, offset))
+    child.expect_exact("done.")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput of the spscrb ringbuffer compared to tsrb
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "container.h"
+#include "spscrb.h"
+#include "tsrb.h"
+#include "ztimer.h"
+
+#ifndef BENCH_RB_SIZE
+#define BENCH_RB_SIZE       (256U)
+#endif
+
+#ifndef BENCH_TOTAL_BYTES
+#define BENCH_TOTAL_BYTES   (256UL * 1024)
+#endif
+
+static const unsigned _chunk_sizes[] = { 1, 16, 64 };
+
+static uint8_t _rb_buf[BENCH_RB_SIZE];
+static uint8_t _in[64];
+static uint8_t _out[64];
+
+static void _print_result(const char *name, unsigned chunk, uint32_t usec)
+{
+    /* bytes per ms are kB/s */
+    uint32_t rate = ((uint64_t)BENCH_TOTAL_BYTES * 1000U) / (usec ? usec : 1);
+
+    printf("%-6s chunk %2u: %" PRIu32 " kB/s\n", name, chunk, rate);
+}
+
+static uint32_t _bench_tsrb(unsigned chunk)
+{
+    tsrb_t rb;
+
+    tsrb_init(&rb, _rb_buf, sizeof(_rb_buf));
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned long n = 0; n < BENCH_TOTAL_BYTES; n += chunk) {
+        tsrb_add(&rb, _in, chunk);
+        tsrb_get(&rb, _out, chunk);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+static uint32_t _bench_spscrb(unsigned chunk)
+{
+    spscrb_t rb;
+
+    spscrb_init(&rb, _rb_buf, sizeof(_rb_buf));
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    for (unsigned long n = 0; n < BENCH_TOTAL_BYTES; n += chunk) {
+        spscrb_write(&rb, _in, chunk);
+        spscrb_read(&rb, _out, chunk);
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i;
+    }
+
+    printf("moving %lu bytes through a %u byte ringbuffer\n",
+           (unsigned long)BENCH_TOTAL_BYTES, BENCH_RB_SIZE);
+    for (unsigned i = 0; i < ARRAY_SIZE(_chunk_sizes); i++) {
+        unsigned chunk = _chunk_sizes[i];
+
+        _print_result("tsrb", chunk, _bench_tsrb(chunk));
+        _print_result("spscrb", chunk, _bench_spscrb(chunk));
+        if (memcmp(_in, _out, chunk)) {
+            puts("FAILED");
+            return 1;
+        }
+    }
+    puts("done.");
+
+    return 0;
+}
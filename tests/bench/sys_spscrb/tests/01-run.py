@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"moving \d+ bytes through a \d+ byte ringbuffer\r\n")
+    for chunk in (1, 16, 64):
+        for name in ("tsrb", "spscrb"):
+            child.expect(r"{}\s+chunk\s+{}: \d+ kB/s\r\n".format(name, chunk))
+    child.expect_exact("done.")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
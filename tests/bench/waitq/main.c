@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Waiter list benchmark application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "irq.h"
+#include "list.h"
+#include "thread.h"
+#include "ztimer.h"
+
+/* waiting threads before the measured ones are added */
+#define MAX_WAITERS     (128U)
+
+/* measured threads added to the waiting ones */
+#define ADDED           (16U)
+
+#define REPETITIONS     (1024U)
+
+/* thread control blocks only, the threads never run */
+static thread_t _waiters[MAX_WAITERS + ADDED];
+
+static void _fill(list_node_t *list, unsigned waiters, unsigned prios)
+{
+    list->next = NULL;
+    for (unsigned i = 0; i < waiters; i++) {
+        _waiters[i].priority = i % prios;
+        thread_add_to_list(list, &_waiters[i]);
+    }
+}
+
+/* adds threads of the lowest priority and returns the time it took, which
+ * is spent with IRQs disabled in mutex_lock(), msg_send() etc. */
+static uint32_t _add(list_node_t *list, unsigned waiters, unsigned prios)
+{
+    unsigned state = irq_disable();
+    uint32_t before = ztimer_now(ZTIMER_USEC);
+
+    for (unsigned i = waiters; i < waiters + ADDED; i++) {
+        _waiters[i].priority = prios;
+        thread_add_to_list(list, &_waiters[i]);
+    }
+
+    uint32_t total = ztimer_now(ZTIMER_USEC) - before;
+    irq_restore(state);
+
+    return total;
+}
+
+static void _run(unsigned prios)
+{
+    printf("\nwaiters of %u priorities + 1 lower priority:\n", prios);
+
+    for (unsigned waiters = 0; waiters <= MAX_WAITERS;
+         waiters = waiters ? waiters * 2 : 1) {
+        list_node_t list;
+        uint32_t total = 0;
+
+        for (unsigned r = 0; r < REPETITIONS; r++) {
+            _fill(&list, waiters, prios);
+            total += _add(&list, waiters, prios);
+        }
+
+        printf("%4u waiters: %6" PRIu32 " ns per added thread\n", waiters,
+               (uint32_t)(((uint64_t)total * 1000) / (REPETITIONS * ADDED)));
+    }
+}
+
+int main(void)
+{
+    puts("Waiter list benchmark.");
+    printf("core_waitq_buckets: %s\n",
+           IS_USED(MODULE_CORE_WAITQ_BUCKETS) ? "yes" : "no");
+
+    for (unsigned i = 0; i < MAX_WAITERS + ADDED; i++) {
+        _waiters[i].status = STATUS_MUTEX_BLOCKED;
+    }
+
+    _run(1);
+    _run(4);
+
+    puts("\ndone.");
+    return 0;
+}
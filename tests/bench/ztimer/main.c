@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 
+#include "container.h"
 #include "test_utils/expect.h"
 
 #include "msg.h"
@@ -47,6 +48,10 @@
 #endif
 
 static ztimer_t _timers[NUMOF_TIMERS];
+static ztimer_t _timer_extra;
+
+/* numbers of pending timers to measure single set() / remove() with */
+static const unsigned _pending[] = { 10, 100, 1000 };
 
 /* This variable is set by any timer that actually triggers.  As the test is
  * only testing set/remove/now operations, timers are not supposed to trigger.
@@ -273,6 +278,42 @@ int main(void)
     _print_result("remove() many decreasing", NUMOF_TIMERS, diff);
     expect(!_triggers);
 
+    /*
+     * test setting / removing one timer REPEAT times in between 10, 100 and
+     * 1000 pending timers
+     *
+     */
+    _timer_extra.callback = _callback;
+    _timer_extra.arg = &_triggers;
+    for (unsigned i = 0; i < ARRAY_SIZE(_pending); i++) {
+        unsigned numof = _pending[i];
+        char desc[32];
+
+        if (numof > NUMOF_TIMERS) {
+            break;
+        }
+        _base = BASE - (ztimer_now(ZTIMER_USEC) - start);
+        for (n = 0; n < numof; n++) {
+            _timer_set(n);
+        }
+
+        before = ztimer_now(ZTIMER_USEC);
+        for (n = 0; n < REPEAT; n++) {
+            ztimer_set(ZTIMER, &_timer_extra, _timer_val(numof / 2) + 1);
+            ztimer_remove(ZTIMER, &_timer_extra);
+        }
+
+        diff = ztimer_now(ZTIMER_USEC) - before;
+
+        snprintf(desc, sizeof(desc), "set() + remove() %4u pending", numof);
+        _print_result(desc, REPEAT, diff);
+        expect(!_triggers);
+
+        for (n = 0; n < numof; n++) {
+            _timer_remove(n);
+        }
+    }
+
     /*
      * test ztimer_now()
      *
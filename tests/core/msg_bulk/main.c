@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   msg_receive_bulk() and msg_send_bulk() test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "container.h"
+#include "msg.h"
+#include "thread.h"
+
+#define QUEUE_SIZE      (8U)
+#define SENDER_NUMOF    (12U)
+#define RECEIVER_NUMOF  (5U)
+
+static kernel_pid_t _main_pid;
+static msg_t _main_queue[QUEUE_SIZE];
+static msg_t _receiver_queue[QUEUE_SIZE / 2];
+
+static char _sender_stack[THREAD_STACKSIZE_MAIN];
+static char _receiver_stack[THREAD_STACKSIZE_MAIN];
+
+static void _fill(msg_t *msgs, unsigned num)
+{
+    for (unsigned i = 0; i < num; i++) {
+        msgs[i].type = i;
+        msgs[i].content.value = i;
+    }
+}
+
+static void _print(const char *name, const msg_t *msgs, int num)
+{
+    printf("%s: %d:", name, num);
+    for (int i = 0; i < num; i++) {
+        printf(" %u", (unsigned)msgs[i].content.value);
+    }
+    puts("");
+}
+
+static void *_sender(void *arg)
+{
+    msg_t msgs[SENDER_NUMOF];
+
+    (void)arg;
+    _fill(msgs, ARRAY_SIZE(msgs));
+    /* only the first QUEUE_SIZE messages fit, so this blocks */
+    int res = msg_send_bulk(msgs, ARRAY_SIZE(msgs), _main_pid);
+    printf("sender: sent %d\n", res);
+    return NULL;
+}
+
+static void *_receiver(void *arg)
+{
+    msg_t msgs[QUEUE_SIZE];
+    unsigned received = 0;
+
+    (void)arg;
+    msg_init_queue(_receiver_queue, ARRAY_SIZE(_receiver_queue));
+    while (received < RECEIVER_NUMOF) {
+        int res = msg_receive_bulk(msgs, ARRAY_SIZE(msgs));
+
+        _print("receiver", msgs, res);
+        received += res;
+    }
+    return NULL;
+}
+
+int main(void)
+{
+    msg_t msgs[SENDER_NUMOF];
+    int res;
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_main_queue, ARRAY_SIZE(_main_queue));
+
+    /* queue to self */
+    _fill(msgs, 10);
+    res = msg_try_send_bulk(msgs, 10, _main_pid);
+    printf("self: sent %d\n", res);
+    res = msg_receive_bulk(msgs, 5);
+    _print("self", msgs, res);
+    res = msg_receive_bulk(msgs, ARRAY_SIZE(msgs));
+    _print("self", msgs, res);
+
+    /* take messages of a blocked sender */
+    thread_create(_sender_stack, sizeof(_sender_stack),
+                  THREAD_PRIORITY_MAIN - 1, 0, _sender, NULL, "sender");
+    res = msg_receive_bulk(msgs, 4);
+    _print("main", msgs, res);
+    res = msg_receive_bulk(msgs, ARRAY_SIZE(msgs));
+    _print("main", msgs, res);
+
+    /* deliver to a waiting receiver */
+    kernel_pid_t receiver = thread_create(_receiver_stack,
+                                          sizeof(_receiver_stack),
+                                          THREAD_PRIORITY_MAIN - 1, 0,
+                                          _receiver, NULL, "receiver");
+    _fill(msgs, RECEIVER_NUMOF);
+    res = msg_send_bulk(msgs, RECEIVER_NUMOF, receiver);
+    printf("main: sent %d\n", res);
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,27 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("self: sent 8")
+    child.expect_exact("self: 5: 0 1 2 3 4")
+    child.expect_exact("self: 3: 5 6 7")
+    child.expect_exact("sender: sent 12")
+    child.expect_exact("main: 4: 0 1 2 3")
+    child.expect_exact("main: 8: 4 5 6 7 8 9 10 11")
+    child.expect_exact("receiver: 1: 0")
+    child.expect_exact("receiver: 4: 1 2 3 4")
+    child.expect_exact("main: sent 5")
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
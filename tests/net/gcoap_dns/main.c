@@ -540,12 +540,8 @@ static const coap_resource_t _resources[] = {
 };
 
 static gcoap_listener_t _listener = {
-    &_resources[0],
-    ARRAY_SIZE(_resources),
-    GCOAP_SOCKET_TYPE_UNDEF,
-    NULL,
-    NULL,
-    NULL
+    .resources = &_resources[0],
+    .resources_len = ARRAY_SIZE(_resources),
 };
 
 static const shell_command_t _shell_commands[] = {
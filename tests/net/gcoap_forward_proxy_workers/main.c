@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for concurrent requests to the gcoap forward
+ *              proxy with gcoap workers
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "net/gcoap.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS              (10U)
+#endif
+
+#define CLIENT_PORT         (61616U)
+#define ORIGIN_DELAY_MS     (20U)
+#define RECV_TIMEOUT_US     (1U * US_PER_SEC)
+
+static ssize_t _origin_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                               coap_request_ctx_t *ctx);
+
+/* the resources of the origin server, each answers with its own name */
+static const coap_resource_t _resources[] = {
+    { "/a", COAP_GET, _origin_handler, "a" },
+    { "/b", COAP_GET, _origin_handler, "b" },
+};
+
+static const char *_proxy_uris[] = {
+    "coap://[::1]/a",
+    "coap://[::1]/b",
+};
+
+static gcoap_listener_t _listener = {
+    .resources = _resources,
+    .resources_len = ARRAY_SIZE(_resources),
+};
+
+static ssize_t _origin_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                               coap_request_ctx_t *ctx)
+{
+    const char *name = coap_request_ctx_get_context(ctx);
+
+    /* keep the other proxied requests in flight meanwhile */
+    ztimer_sleep(ZTIMER_MSEC, ORIGIN_DELAY_MS);
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    size_t resp_len = coap_opt_finish(pdu, COAP_OPT_FINISH_PAYLOAD);
+    expect(pdu->payload_len >= strlen(name));
+    memcpy(pdu->payload, name, strlen(name));
+    return resp_len + strlen(name);
+}
+
+static void _send_request(sock_udp_t *sock, const sock_udp_ep_t *proxy,
+                          unsigned round, unsigned idx)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    uint8_t token[] = { round, idx };
+    coap_pkt_t pdu;
+    ssize_t hdr_len;
+
+    hdr_len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_NON, token,
+                             sizeof(token), COAP_METHOD_GET,
+                             (round * ARRAY_SIZE(_proxy_uris)) + idx);
+    expect(hdr_len > 0);
+    coap_pkt_init(&pdu, buf, sizeof(buf), hdr_len);
+    expect(coap_opt_add_proxy_uri(&pdu, _proxy_uris[idx]) > 0);
+    ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    expect(sock_udp_send(sock, buf, len, proxy) == len);
+}
+
+/* every response must carry the payload of the resource its token asked for */
+static void _recv_response(sock_udp_t *sock, unsigned round, unsigned *received)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    ssize_t res = sock_udp_recv(sock, buf, sizeof(buf), RECV_TIMEOUT_US, NULL);
+    if (res <= 0) {
+        printf("round %u: no response (%d)\n", round, (int)res);
+        expect(0);
+    }
+    expect(coap_parse(&pdu, buf, res) == 0);
+    expect(coap_get_code_raw(&pdu) == COAP_CODE_CONTENT);
+    expect(coap_get_token_len(&pdu) == 2);
+
+    uint8_t *token = coap_get_token(&pdu);
+    unsigned idx = token[1];
+
+    expect(token[0] == round);
+    expect(idx < ARRAY_SIZE(_resources));
+    expect(!(*received & (1U << idx)));
+    *received |= 1U << idx;
+
+    const char *name = _resources[idx].context;
+    if ((pdu.payload_len != strlen(name)) ||
+        (memcmp(pdu.payload, name, pdu.payload_len) != 0)) {
+        printf("round %u: response to %s carries \"%.*s\"\n", round,
+               _proxy_uris[idx], (int)pdu.payload_len, (char *)pdu.payload);
+        expect(0);
+    }
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_ep_t proxy = SOCK_IPV6_EP_ANY;
+    sock_udp_t sock;
+
+    puts("gcoap forward proxy test with workers");
+
+    gcoap_register_listener(&_listener);
+    local.port = CLIENT_PORT;
+    expect(sock_udp_create(&sock, &local, NULL, 0) == 0);
+    ipv6_addr_set_loopback((ipv6_addr_t *)&proxy.addr.ipv6);
+    proxy.port = CONFIG_GCOAP_PORT;
+
+    for (unsigned round = 0; round < ROUNDS; round++) {
+        unsigned received = 0;
+
+        /* send all requests before any is handled */
+        for (unsigned i = 0; i < ARRAY_SIZE(_proxy_uris); i++) {
+            _send_request(&sock, &proxy, round, i);
+        }
+        for (unsigned i = 0; i < ARRAY_SIZE(_proxy_uris); i++) {
+            _recv_response(&sock, round, &received);
+        }
+    }
+
+    puts("SUCCESS");
+    return 0;
+}
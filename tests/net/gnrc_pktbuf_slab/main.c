@@ -0,0 +1,391 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the size-class packet buffer implementation
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/pktbuf_slab.h"
+#include "net/gnrc/nettype.h"
+
+#include "pktbuf_internal.h"
+
+#define TEST_STRING4    "1234"
+#define TEST_STRING16   "0123456789abcdef"
+
+enum {
+    SLAB_SNIP = 0,
+    SLAB_SMALL,
+    SLAB_MEDIUM,
+    SLAB_LARGE,
+};
+
+static uint8_t _data[CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE];
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = (uint8_t)i;
+    }
+}
+
+static unsigned _used(unsigned slab)
+{
+    gnrc_pktbuf_slab_usage_t usage;
+
+    gnrc_pktbuf_slab_get_usage(&usage);
+    return usage.slabs[slab].used;
+}
+
+static size_t _block_size(unsigned slab)
+{
+    gnrc_pktbuf_slab_usage_t usage;
+
+    gnrc_pktbuf_slab_get_usage(&usage);
+    return usage.slabs[slab].block_size;
+}
+
+static void test_pktbuf_slab_init(void)
+{
+    gnrc_pktbuf_slab_usage_t usage;
+    size_t total = 0;
+
+    gnrc_pktbuf_slab_get_usage(&usage);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(0, usage.requested);
+    TEST_ASSERT_EQUAL_INT(0, usage.reserved);
+    TEST_ASSERT_EQUAL_INT(0, usage.max_reserved);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_slab_fragmentation(&usage));
+    for (unsigned i = 0; i < GNRC_PKTBUF_SLAB_NUMOF; i++) {
+        TEST_ASSERT(usage.slabs[i].numof > 0);
+        TEST_ASSERT_EQUAL_INT(0, usage.slabs[i].used);
+        if (i > 0) {
+            TEST_ASSERT(usage.slabs[i - 1].block_size <= usage.slabs[i].block_size);
+        }
+        total += usage.slabs[i].block_size * usage.slabs[i].numof;
+    }
+    TEST_ASSERT(total <= CONFIG_GNRC_PKTBUF_SIZE);
+    TEST_ASSERT(_block_size(SLAB_LARGE) >= CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE);
+}
+
+static void test_pktbuf_slab_add__size_classes(void)
+{
+    gnrc_pktsnip_t *pkt1, *pkt2, *pkt3;
+
+    /* payload fits into a snip sized block */
+    pkt1 = gnrc_pktbuf_add(NULL, TEST_STRING4, sizeof(TEST_STRING4),
+                           GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt1);
+    TEST_ASSERT_EQUAL_INT(2, _used(SLAB_SNIP));
+    pkt2 = gnrc_pktbuf_add(pkt1, NULL, _block_size(SLAB_SMALL),
+                           GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT_EQUAL_INT(3, _used(SLAB_SNIP));
+    TEST_ASSERT_EQUAL_INT(1, _used(SLAB_SMALL));
+    pkt3 = gnrc_pktbuf_add(pkt2, _data, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE,
+                           GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt3);
+    TEST_ASSERT_EQUAL_INT(0, _used(SLAB_MEDIUM));
+    TEST_ASSERT_EQUAL_INT(1, _used(SLAB_LARGE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, pkt3->data, pkt3->size));
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING4, pkt1->data);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt3);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_slab_add__too_large(void)
+{
+    gnrc_pktbuf_slab_usage_t usage;
+
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, _block_size(SLAB_LARGE) + 1,
+                                     GNRC_NETTYPE_TEST));
+    gnrc_pktbuf_slab_get_usage(&usage);
+    TEST_ASSERT_EQUAL_INT(0, usage.fails);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_add__spill_and_exhaust(void)
+{
+    gnrc_pktbuf_slab_usage_t usage;
+    gnrc_pktsnip_t *pkt = NULL, *next;
+    unsigned medium, large;
+
+    gnrc_pktbuf_slab_get_usage(&usage);
+    medium = usage.slabs[SLAB_MEDIUM].numof;
+    large = usage.slabs[SLAB_LARGE].numof;
+    /* header data for the snips is put in the snip slab, so payloads just
+     * above small size fill up the medium slab and then the large one */
+    for (unsigned i = 0; i < (medium + large); i++) {
+        next = gnrc_pktbuf_add(pkt, NULL, _block_size(SLAB_SMALL) + 1,
+                               GNRC_NETTYPE_TEST);
+        TEST_ASSERT_NOT_NULL(next);
+        pkt = next;
+    }
+    gnrc_pktbuf_slab_get_usage(&usage);
+    TEST_ASSERT_EQUAL_INT(medium, usage.slabs[SLAB_MEDIUM].used);
+    TEST_ASSERT_EQUAL_INT(large, usage.slabs[SLAB_LARGE].used);
+    TEST_ASSERT_EQUAL_INT(large, usage.spills);
+    TEST_ASSERT_EQUAL_INT(0, usage.fails);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* all slabs able to hold the payload are exhausted */
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(pkt, NULL, _block_size(SLAB_SMALL) + 1,
+                                     GNRC_NETTYPE_TEST));
+    gnrc_pktbuf_slab_get_usage(&usage);
+    TEST_ASSERT_EQUAL_INT(1, usage.fails);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_slab_mark(void)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+
+    pkt = gnrc_pktbuf_add(NULL, _data, _block_size(SLAB_MEDIUM),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    hdr = gnrc_pktbuf_mark(pkt, sizeof(TEST_STRING16), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(pkt->next == hdr);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16), hdr->size);
+    TEST_ASSERT_EQUAL_INT(_block_size(SLAB_MEDIUM) - sizeof(TEST_STRING16),
+                          pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, hdr->data, hdr->size));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[sizeof(TEST_STRING16)], pkt->data,
+                                    pkt->size));
+    TEST_ASSERT_EQUAL_INT(1, _used(SLAB_MEDIUM));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* payload keeps pointing into its original block; mark again */
+    hdr = gnrc_pktbuf_mark(pkt, sizeof(TEST_STRING4), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[sizeof(TEST_STRING16)], hdr->data,
+                                    hdr->size));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* growing the payload in place is not possible, as it is at the end of
+     * its block */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, pkt->size + 1));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_data[sizeof(TEST_STRING16) + sizeof(TEST_STRING4)],
+                                    pkt->data, pkt->size - 1));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_slab_mark__whole(void)
+{
+    gnrc_pktsnip_t *pkt, *hdr;
+    void *data;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, sizeof(TEST_STRING16), GNRC_NETTYPE_UNDEF);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(data == hdr->data);
+    TEST_ASSERT_NULL(pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, pkt->size);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_take_headroom(void)
+{
+    gnrc_pktsnip_t *pkt, *headroom, *other;
+    void *data;
+
+    pkt = gnrc_pktbuf_add(NULL, _data, _block_size(SLAB_SMALL),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    headroom = gnrc_pktbuf_mark_headroom(pkt, sizeof(TEST_STRING16));
+    TEST_ASSERT_NOT_NULL(headroom);
+    TEST_ASSERT(pkt->next == headroom);
+    TEST_ASSERT_NULL(headroom->data);
+    other = gnrc_pktbuf_add(NULL, _data, _block_size(SLAB_SMALL),
+                            GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(other);
+    TEST_ASSERT_NOT_NULL(gnrc_pktbuf_mark_headroom(other, sizeof(TEST_STRING16)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* the headroom of another packet is not in front of pkt */
+    TEST_ASSERT_EQUAL_INT(-ENOSPC,
+                          gnrc_pktbuf_take_headroom(pkt, other->next,
+                                                    sizeof(TEST_STRING4)));
+    /* a shared headroom can not be taken */
+    gnrc_pktbuf_hold(headroom, 1);
+    TEST_ASSERT_EQUAL_INT(-ENOSPC,
+                          gnrc_pktbuf_take_headroom(pkt, headroom,
+                                                    sizeof(TEST_STRING4)));
+    gnrc_pktbuf_release(headroom);
+    TEST_ASSERT_EQUAL_INT(-ENOSPC,
+                          gnrc_pktbuf_take_headroom(pkt, headroom,
+                                                    sizeof(TEST_STRING16) + 1));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_take_headroom(pkt, headroom,
+                                                       sizeof(TEST_STRING16)));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(_block_size(SLAB_SMALL), pkt->size);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(other);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_slab_realloc_data(void)
+{
+    gnrc_pktbuf_slab_usage_t usage;
+    gnrc_pktsnip_t *pkt;
+    void *data;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING4, sizeof(TEST_STRING4),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    /* still fits into the block */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, _block_size(SLAB_SNIP)));
+    TEST_ASSERT(data == pkt->data);
+    gnrc_pktbuf_slab_get_usage(&usage);
+    TEST_ASSERT_EQUAL_INT(sizeof(gnrc_pktsnip_t) + _block_size(SLAB_SNIP),
+                          usage.requested);
+    /* needs a larger block */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, _block_size(SLAB_SMALL)));
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING4, pkt->data);
+    TEST_ASSERT_EQUAL_INT(1, _used(SLAB_SMALL));
+    TEST_ASSERT_EQUAL_INT(1, _used(SLAB_SNIP));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_EQUAL_INT(ENOMEM,
+                          gnrc_pktbuf_realloc_data(pkt, _block_size(SLAB_LARGE) + 1));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 0));
+    TEST_ASSERT_NULL(pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, _used(SLAB_SMALL));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_start_write(void)
+{
+    gnrc_pktsnip_t *pkt, *copy;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    gnrc_pktbuf_hold(pkt, 1);
+    copy = gnrc_pktbuf_start_write(pkt);
+    TEST_ASSERT_NOT_NULL(copy);
+    TEST_ASSERT(copy != pkt);
+    TEST_ASSERT(copy->data != pkt->data);
+    TEST_ASSERT_EQUAL_STRING(TEST_STRING16, copy->data);
+    TEST_ASSERT_EQUAL_INT(1, pkt->users);
+    gnrc_pktbuf_release(pkt);
+    gnrc_pktbuf_release(copy);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_slab_usage(void)
+{
+    gnrc_pktbuf_slab_usage_t usage;
+    gnrc_pktsnip_t *pkt;
+    size_t reserved;
+
+    pkt = gnrc_pktbuf_add(NULL, NULL, _block_size(SLAB_SMALL) + 1,
+                          GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    reserved = _block_size(SLAB_SNIP) + _block_size(SLAB_MEDIUM);
+    gnrc_pktbuf_slab_get_usage(&usage);
+    TEST_ASSERT_EQUAL_INT(sizeof(gnrc_pktsnip_t) + _block_size(SLAB_SMALL) + 1,
+                          usage.requested);
+    TEST_ASSERT_EQUAL_INT(reserved, usage.reserved);
+    TEST_ASSERT_EQUAL_INT(reserved, usage.max_reserved);
+    TEST_ASSERT_EQUAL_INT(((reserved - usage.requested) * 1000U) / reserved,
+                          gnrc_pktbuf_slab_fragmentation(&usage));
+    gnrc_pktbuf_release(pkt);
+    /* high-water marks are kept after release */
+    gnrc_pktbuf_slab_get_usage(&usage);
+    TEST_ASSERT_EQUAL_INT(0, usage.requested);
+    TEST_ASSERT_EQUAL_INT(0, usage.reserved);
+    TEST_ASSERT_EQUAL_INT(reserved, usage.max_reserved);
+    TEST_ASSERT_EQUAL_INT(1, usage.slabs[SLAB_SNIP].max_used);
+    TEST_ASSERT_EQUAL_INT(0, usage.slabs[SLAB_SMALL].max_used);
+    TEST_ASSERT_EQUAL_INT(1, usage.slabs[SLAB_MEDIUM].max_used);
+}
+
+static void test_pktbuf_slab_mixed_traffic(void)
+{
+    static const size_t sizes[] = { 4, 60, 1280, 40, 127, 8, 200, 1500 };
+    gnrc_pktsnip_t *pkts[ARRAY_SIZE(sizes)];
+
+    /* repeatedly allocate and release in a different order than allocated,
+     * the slabs may never lose blocks to fragmentation */
+    for (unsigned round = 0; round < 64; round++) {
+        for (unsigned i = 0; i < ARRAY_SIZE(sizes); i++) {
+            pkts[i] = gnrc_pktbuf_add(NULL, _data, sizes[(i + round) % ARRAY_SIZE(sizes)],
+                                      GNRC_NETTYPE_TEST);
+            TEST_ASSERT_NOT_NULL(pkts[i]);
+        }
+        TEST_ASSERT(gnrc_pktbuf_is_sane());
+        for (unsigned i = 0; i < ARRAY_SIZE(sizes); i += 2) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+        for (unsigned i = 1; i < ARRAY_SIZE(sizes); i += 2) {
+            gnrc_pktbuf_release(pkts[i]);
+        }
+        TEST_ASSERT(gnrc_pktbuf_is_empty());
+        TEST_ASSERT(gnrc_pktbuf_is_sane());
+    }
+}
+
+static Test *tests_gnrc_pktbuf_slab(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktbuf_slab_init),
+        new_TestFixture(test_pktbuf_slab_add__size_classes),
+        new_TestFixture(test_pktbuf_slab_add__too_large),
+        new_TestFixture(test_pktbuf_slab_add__spill_and_exhaust),
+        new_TestFixture(test_pktbuf_slab_mark),
+        new_TestFixture(test_pktbuf_slab_mark__whole),
+        new_TestFixture(test_pktbuf_slab_take_headroom),
+        new_TestFixture(test_pktbuf_slab_realloc_data),
+        new_TestFixture(test_pktbuf_slab_start_write),
+        new_TestFixture(test_pktbuf_slab_usage),
+        new_TestFixture(test_pktbuf_slab_mixed_traffic),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL, fixtures);
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_pktbuf_slab());
+    TESTS_END();
+
+    return 0;
+}
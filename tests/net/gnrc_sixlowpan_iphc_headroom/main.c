@@ -0,0 +1,256 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests IPHC decompression into the headroom of a received
+ *              packet
+ *
+ * @}
+ */
+
+#include <string.h>
+
+#include "byteorder.h"
+#include "embUnit.h"
+#include "msg.h"
+#include "net/gnrc.h"
+#include "net/gnrc/sixlowpan/iphc.h"
+#include "net/ipv6/hdr.h"
+#include "net/protnum.h"
+#include "net/sixlowpan.h"
+#include "net/udp.h"
+
+#define MSG_QUEUE_SIZE      (4U)
+#define SRC_PORT            (0xf0b1U)
+#define DST_PORT            (0x61a8U)
+#define CSUM                (0x1234U)
+#define PAYLOAD_LEN         (16U)
+
+/* IPHC: traffic class and flow label elided, next header compressed, hop
+ * limit 255 | addresses inline */
+#define IPHC_LEN            (2U + (2U * sizeof(ipv6_addr_t)))
+#define IPHC1               (SIXLOWPAN_IPHC1_DISP | SIXLOWPAN_IPHC1_TF | \
+                             SIXLOWPAN_IPHC1_NH | SIXLOWPAN_IPHC1_HL)
+#define IPHC2               (0x00)
+/* NHC for an encapsulated IPv6 header, next header not compressed */
+#define NHC_IPV6            (0xee)
+/* NHC for UDP with inline ports and checksum */
+#define NHC_UDP_LEN         (7U)
+#define NHC_UDP             (0xf0)
+
+/* headroom enough for the in place decompression of both test datagrams */
+#define HEADROOM            (16U)
+/* less than the UDP header grows by */
+#define HEADROOM_TOO_SMALL  (4U)
+
+static const ipv6_addr_t _src = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    } };
+static const ipv6_addr_t _dst = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02
+    } };
+static const ipv6_addr_t _inner_src = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x03
+    } };
+static const ipv6_addr_t _inner_dst = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x04
+    } };
+
+static msg_t _msg_queue[MSG_QUEUE_SIZE];
+static gnrc_netreg_entry_t _ipv6_entry;
+
+/* the compressed datagram and the one expected after decompression */
+static uint8_t _frame[IPHC_LEN + 1U + IPHC_LEN + NHC_UDP_LEN + PAYLOAD_LEN];
+static size_t _frame_len;
+static uint8_t _exp[(2U * sizeof(ipv6_hdr_t)) + sizeof(udp_hdr_t) + PAYLOAD_LEN];
+static size_t _exp_len;
+
+static void _set_up(void)
+{
+    _frame_len = 0;
+    _exp_len = 0;
+}
+
+static void _tear_down(void)
+{
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void _put_iphc(const ipv6_addr_t *src, const ipv6_addr_t *dst)
+{
+    _frame[_frame_len++] = IPHC1;
+    _frame[_frame_len++] = IPHC2;
+    memcpy(&_frame[_frame_len], src, sizeof(*src));
+    _frame_len += sizeof(*src);
+    memcpy(&_frame[_frame_len], dst, sizeof(*dst));
+    _frame_len += sizeof(*dst);
+}
+
+static void _put_nhc_udp(void)
+{
+    _frame[_frame_len++] = NHC_UDP;
+    _frame[_frame_len++] = SRC_PORT >> 8;
+    _frame[_frame_len++] = SRC_PORT & 0xff;
+    _frame[_frame_len++] = DST_PORT >> 8;
+    _frame[_frame_len++] = DST_PORT & 0xff;
+    _frame[_frame_len++] = CSUM >> 8;
+    _frame[_frame_len++] = CSUM & 0xff;
+    for (unsigned i = 0; i < PAYLOAD_LEN; i++) {
+        _frame[_frame_len++] = i;
+    }
+}
+
+static void _exp_ipv6(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                      uint8_t nh, size_t len)
+{
+    ipv6_hdr_t *hdr = (ipv6_hdr_t *)&_exp[_exp_len];
+
+    memset(hdr, 0, sizeof(*hdr));
+    ipv6_hdr_set_version(hdr);
+    hdr->len = byteorder_htons(len);
+    hdr->nh = nh;
+    hdr->hl = 255;
+    hdr->src = *src;
+    hdr->dst = *dst;
+    _exp_len += sizeof(*hdr);
+}
+
+static void _exp_udp(void)
+{
+    udp_hdr_t *hdr = (udp_hdr_t *)&_exp[_exp_len];
+
+    hdr->src_port = byteorder_htons(SRC_PORT);
+    hdr->dst_port = byteorder_htons(DST_PORT);
+    hdr->length = byteorder_htons(sizeof(*hdr) + PAYLOAD_LEN);
+    hdr->checksum = byteorder_htons(CSUM);
+    _exp_len += sizeof(*hdr);
+    for (unsigned i = 0; i < PAYLOAD_LEN; i++) {
+        _exp[_exp_len++] = i;
+    }
+}
+
+static void _init_udp(void)
+{
+    _put_iphc(&_src, &_dst);
+    _put_nhc_udp();
+    _exp_ipv6(&_src, &_dst, PROTNUM_UDP, sizeof(udp_hdr_t) + PAYLOAD_LEN);
+    _exp_udp();
+}
+
+static void _init_ipv6_in_ipv6(void)
+{
+    _put_iphc(&_src, &_dst);
+    _frame[_frame_len++] = NHC_IPV6;
+    _put_iphc(&_inner_src, &_inner_dst);
+    _put_nhc_udp();
+    _exp_ipv6(&_src, &_dst, PROTNUM_IPV6,
+              sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t) + PAYLOAD_LEN);
+    _exp_ipv6(&_inner_src, &_inner_dst, PROTNUM_UDP,
+              sizeof(udp_hdr_t) + PAYLOAD_LEN);
+    _exp_udp();
+}
+
+/* passes _frame with headroom in front of it to IPHC, in_place is where the
+ * decompressed datagram starts if it is decompressed in place */
+static void _recv(size_t headroom, uint8_t **in_place)
+{
+    gnrc_pktsnip_t *netif, *sixlo;
+
+    netif = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    TEST_ASSERT_NOT_NULL(netif);
+    sixlo = gnrc_pktbuf_add(netif, NULL, headroom + _frame_len,
+                            GNRC_NETTYPE_SIXLOWPAN);
+    TEST_ASSERT_NOT_NULL(sixlo);
+    memcpy((uint8_t *)sixlo->data + headroom, _frame, _frame_len);
+    TEST_ASSERT_NOT_NULL(gnrc_pktbuf_mark_headroom(sixlo, headroom));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(sixlo->data, _frame, _frame_len));
+
+    *in_place = (uint8_t *)sixlo->data - (_exp_len - _frame_len);
+    gnrc_sixlowpan_iphc_recv(sixlo, NULL, 0);
+}
+
+/* checks the datagram dispatched by IPHC, data is where it starts */
+static void _check(uint8_t **data)
+{
+    gnrc_pktsnip_t *ipv6;
+    msg_t msg;
+
+    TEST_ASSERT_EQUAL_INT(1, msg_try_receive(&msg));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV, msg.type);
+    ipv6 = msg.content.ptr;
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_IPV6, ipv6->type);
+    TEST_ASSERT_EQUAL_INT(_exp_len, ipv6->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_exp, ipv6->data, _exp_len));
+    /* the headroom is not passed up */
+    TEST_ASSERT_NOT_NULL(ipv6->next);
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_NETIF, ipv6->next->type);
+    *data = ipv6->data;
+    gnrc_pktbuf_release(ipv6);
+}
+
+static void test_recv__nhc_udp_in_place(void)
+{
+    uint8_t *in_place, *data;
+
+    _init_udp();
+    _recv(HEADROOM, &in_place);
+    _check(&data);
+    TEST_ASSERT(in_place == data);
+}
+
+static void test_recv__ipv6_in_ipv6_in_place(void)
+{
+    uint8_t *in_place, *data;
+
+    _init_ipv6_in_ipv6();
+    _recv(HEADROOM, &in_place);
+    _check(&data);
+    TEST_ASSERT(in_place == data);
+}
+
+static void test_recv__headroom_too_small(void)
+{
+    uint8_t *in_place, *data;
+
+    _init_udp();
+    TEST_ASSERT(HEADROOM_TOO_SMALL < (_exp_len - _frame_len));
+    _recv(HEADROOM_TOO_SMALL, &in_place);
+    _check(&data);
+    /* decompressed into a new buffer instead */
+    TEST_ASSERT(in_place != data);
+}
+
+static Test *tests_gnrc_sixlowpan_iphc_headroom(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_recv__nhc_udp_in_place),
+        new_TestFixture(test_recv__ipv6_in_ipv6_in_place),
+        new_TestFixture(test_recv__headroom_too_small),
+    };
+
+    EMB_UNIT_TESTCALLER(iphc_headroom_tests, _set_up, _tear_down, fixtures);
+
+    return (Test *)&iphc_headroom_tests;
+}
+
+int main(void)
+{
+    msg_init_queue(_msg_queue, MSG_QUEUE_SIZE);
+    gnrc_netreg_entry_init_pid(&_ipv6_entry, GNRC_NETREG_DEMUX_CTX_ALL,
+                               thread_getpid());
+    gnrc_netreg_register(GNRC_NETTYPE_IPV6, &_ipv6_entry);
+
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_sixlowpan_iphc_headroom());
+    TESTS_END();
+    return 0;
+}
@@ -308,6 +308,48 @@ static void test_sock_udp_recv__socketed(void)
     expect(_check_net());
 }
 
+#ifdef MODULE_GNRC_SOCK_MBOX_POOL
+static void test_sock_udp_recv__pool_max(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    _sock.reg.rx_max = 2;
+    for (unsigned i = 0; i < 3; i++) {
+        expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                              _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                              _TEST_NETIF));
+    }
+    expect(1 == _sock.reg.rx_drops);
+    for (unsigned i = 0; i < 2; i++) {
+        expect(sizeof("ABCD") == sock_udp_recv(&_sock, _test_buffer,
+                                               sizeof(_test_buffer), 0, NULL));
+    }
+    expect(-EAGAIN == sock_udp_recv(&_sock, _test_buffer, sizeof(_test_buffer),
+                                    0, NULL));
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv__pool_close(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    /* queued packets are released on close */
+    sock_udp_close(&_sock);
+    expect(_check_net());
+}
+#endif
+
 static void test_sock_udp_recv__socketed_with_remote(void)
 {
     static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
@@ -518,6 +560,74 @@ static void test_sock_udp_recv_buf__success(void)
     expect(_check_net());
 }
 
+static void test_sock_udp_recv_view__success(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_recv_view_t view;
+    sock_udp_ep_t result;
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    expect(sizeof("ABCD") == sock_udp_recv_view(&_sock, &view, 0, &result));
+    expect(sizeof("ABCD") == view.len);
+    expect(NULL == view.snips[0].iol_next);
+    expect(sizeof("ABCD") == view.snips[0].iol_len);
+    expect(memcmp("ABCD", view.snips[0].iol_base, sizeof("ABCD")) == 0);
+    expect(_TEST_PORT_REMOTE == result.port);
+    sock_udp_recv_view_release(&_sock, &view);
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_view__scattered(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    iolist_t tail = { .iol_base = "EFG", .iol_len = sizeof("EFG") };
+    iolist_t head = { .iol_next = &tail, .iol_base = "ABCD", .iol_len = 4 };
+    char data[sizeof("ABCDEFG")];
+    sock_udp_recv_view_t view;
+
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_scattered_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                                    _TEST_PORT_LOCAL, &head, _TEST_NETIF));
+    expect(sizeof("ABCDEFG") == sock_udp_recv_view(&_sock, &view, 0, NULL));
+    expect(2 == iolist_count(view.snips));
+    expect(sizeof(data) == iolist_to_buffer(view.snips, data, sizeof(data)));
+    expect(strcmp("ABCDEFG", data) == 0);
+    sock_udp_recv_view_release(&_sock, &view);
+    expect(_check_net());
+}
+
+static void test_sock_udp_recv_view__ENOBUFS(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    iolist_t payload[CONFIG_SOCK_UDP_RECV_VIEW_SNIPS + 1];
+    sock_udp_recv_view_t view;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(payload); i++) {
+        payload[i] = (iolist_t){
+            .iol_next = (i + 1 < ARRAY_SIZE(payload)) ? &payload[i + 1] : NULL,
+            .iol_base = "AB",
+            .iol_len = 2,
+        };
+    }
+    expect(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    expect(_inject_scattered_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                                    _TEST_PORT_LOCAL, payload, _TEST_NETIF));
+    expect(-ENOBUFS == sock_udp_recv_view(&_sock, &view, 0, NULL));
+    expect(_check_net());
+}
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -847,6 +957,10 @@ int main(void)
     CALL(test_sock_udp_recv__multicast());
     CALL(test_sock_udp_recv__ETIMEDOUT());
     CALL(test_sock_udp_recv__socketed());
+#ifdef MODULE_GNRC_SOCK_MBOX_POOL
+    CALL(test_sock_udp_recv__pool_max());
+    CALL(test_sock_udp_recv__pool_close());
+#endif
     CALL(test_sock_udp_recv__socketed_with_remote());
     CALL(test_sock_udp_recv__socketed_with_port0());
     CALL(test_sock_udp_recv__unsocketed());
@@ -855,6 +969,9 @@ int main(void)
     CALL(test_sock_udp_recv__non_blocking());
     CALL(test_sock_udp_recv__aux());
     CALL(test_sock_udp_recv_buf__success());
+    CALL(test_sock_udp_recv_view__success());
+    CALL(test_sock_udp_recv_view__scattered());
+    CALL(test_sock_udp_recv_view__ENOBUFS());
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -115,6 +115,65 @@ bool _inject_packet_aux(const ipv6_addr_t *src, const ipv6_addr_t *dst,
                                          GNRC_NETREG_DEMUX_CTX_ALL, pkt) > 0);
 }
 
+bool _inject_scattered_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                              uint16_t src_port, uint16_t dst_port,
+                              const iolist_t *payload, uint16_t netif)
+{
+    gnrc_pktsnip_t *udp, *ipv6, *netif_hdr_snip, *head = NULL, *last = NULL;
+    udp_hdr_t *udp_hdr;
+    ipv6_hdr_t *ipv6_hdr;
+    size_t len = sizeof(udp_hdr_t) + iolist_size(payload);
+
+    udp = gnrc_pktbuf_add(NULL, NULL, sizeof(udp_hdr_t), GNRC_NETTYPE_UDP);
+    if (udp == NULL) {
+        return false;
+    }
+    udp_hdr = udp->data;
+    udp_hdr->src_port = byteorder_htons(src_port);
+    udp_hdr->dst_port = byteorder_htons(dst_port);
+    udp_hdr->length = byteorder_htons((uint16_t)len);
+    udp_hdr->checksum.u16 = 0;
+    ipv6 = gnrc_ipv6_hdr_build(NULL, src, dst);
+    if (ipv6 == NULL) {
+        return false;
+    }
+    ipv6_hdr = ipv6->data;
+    ipv6_hdr->len = byteorder_htons((uint16_t)len);
+    ipv6_hdr->nh = PROTNUM_UDP;
+    ipv6_hdr->hl = 64;
+    udp = gnrc_pkt_append(udp, ipv6);
+    netif_hdr_snip = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    if (netif_hdr_snip == NULL) {
+        return false;
+    }
+    ((gnrc_netif_hdr_t *)netif_hdr_snip->data)->if_pid = (kernel_pid_t)netif;
+    udp = gnrc_pkt_append(udp, netif_hdr_snip);
+    /* one snip per payload chunk in front of the already marked UDP header,
+     * as gnrc_udp would pass it on */
+    for (; payload; payload = payload->iol_next) {
+        gnrc_pktsnip_t *snip = gnrc_pktbuf_add(NULL, payload->iol_base,
+                                               payload->iol_len,
+                                               GNRC_NETTYPE_UNDEF);
+        if (snip == NULL) {
+            return false;
+        }
+        if (last == NULL) {
+            head = snip;
+        }
+        else {
+            last->next = snip;
+        }
+        last = snip;
+    }
+    if (last == NULL) {
+        head = udp;
+    }
+    else {
+        last->next = udp;
+    }
+    return (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_UDP, dst_port, head) > 0);
+}
+
 bool _check_net(void)
 {
     return (gnrc_pktbuf_is_sane() && gnrc_pktbuf_is_empty());
@@ -89,6 +89,24 @@ static inline bool _inject_packet(const ipv6_addr_t *src,
                               netif, NULL);
 }
 
+/**
+ * @brief   Injects a received UDP packet with its payload split over several
+ *          packet snips directly to the sock
+ *
+ * @param[in] src       The source address of the UDP packet
+ * @param[in] dst       The destination address of the UDP packet
+ * @param[in] src_port  The source port of the UDP packet
+ * @param[in] dst_port  The destination port of the UDP packet
+ * @param[in] payload   The payload of the UDP packet, one snip per element
+ * @param[in] netif     The interface the packet came over
+ *
+ * @return  true, if packet was successfully injected
+ * @return  false, if an error occurred during injection
+ */
+bool _inject_scattered_packet(const ipv6_addr_t *src, const ipv6_addr_t *dst,
+                              uint16_t src_port, uint16_t dst_port,
+                              const iolist_t *payload, uint16_t netif);
+
 /**
  * @brief   Checks networking state (e.g. packet buffer state)
  *
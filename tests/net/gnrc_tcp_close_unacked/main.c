@@ -0,0 +1,242 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for closing a GNRC TCP connection while data
+ *              is unacknowledged
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "byteorder.h"
+#include "mbox.h"
+#include "mutex.h"
+#include "net/af.h"
+#include "net/ethernet.h"
+#include "net/ethernet/hdr.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/gnrc/tcp.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/tcp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define SERVER_PORT     (80U)
+#define USER_TIMEOUT_MS (10U * MS_PER_SEC)
+#define LINK_QUEUE_SIZE (16U)
+
+#define TCP_CTL_FIN     (0x0001)
+
+/* link-local address of the node, set statically to not depend on the
+ * auto-configuration of the interface */
+static const ipv6_addr_t _local = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    } };
+/* link-local address of the peer, all frames sent to it are reflected */
+static const ipv6_addr_t _peer = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02
+    } };
+static const uint8_t _peer_mac[] = { 0x57, 0x44, 0x33, 0x22, 0x11, 0x00 };
+
+static const char _data[] = "unacked data";
+
+static netdev_test_t _dev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static gnrc_tcp_tcb_t _client;
+static gnrc_tcp_tcb_t _server;
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static char _server_stack[THREAD_STACKSIZE_MAIN];
+static mutex_t _server_done = MUTEX_INIT_LOCKED;
+static char _received[sizeof(_data)];
+static size_t _received_len;
+static ssize_t _eof;
+
+static char _link_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _link_queue[LINK_QUEUE_SIZE];
+static mbox_t _link = MBOX_INIT(_link_queue, LINK_QUEUE_SIZE);
+
+/* written by the interface thread only */
+static unsigned _fins;
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= ETHERNET_ADDR_LEN);
+    memcpy(value, "\xce\xab\xfe\xad\xf7\x00", ETHERNET_ADDR_LEN);
+    return ETHERNET_ADDR_LEN;
+}
+
+/* the first FIN of the client is lost, so it must be retransmitted */
+static bool _lose(const tcp_hdr_t *tcp)
+{
+    if ((byteorder_ntohs(tcp->dst_port) != SERVER_PORT) ||
+        !(byteorder_ntohs(tcp->off_ctl) & TCP_CTL_FIN)) {
+        return false;
+    }
+    return (_fins++ == 0);
+}
+
+/* reflects TCP segments back into the interface as if sent by the peer */
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    size_t size = iolist_size(iolist);
+    gnrc_pktsnip_t *netif_hdr, *pkt;
+    ipv6_hdr_t *ipv6;
+
+    (void)dev;
+    expect(iolist->iol_len == sizeof(ethernet_hdr_t));
+    if (size < sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) + sizeof(tcp_hdr_t)) {
+        return size;
+    }
+    netif_hdr = gnrc_netif_hdr_build(NULL, 0, NULL, 0);
+    if (netif_hdr == NULL) {
+        return size;
+    }
+    gnrc_netif_hdr_set_netif(netif_hdr->data, &_netif);
+    pkt = gnrc_pktbuf_add(netif_hdr, NULL, size - sizeof(ethernet_hdr_t),
+                          GNRC_NETTYPE_IPV6);
+    if (pkt == NULL) {
+        gnrc_pktbuf_release(netif_hdr);
+        return size;
+    }
+    iolist_to_buffer(iolist->iol_next, pkt->data, pkt->size);
+
+    ipv6 = pkt->data;
+    if ((ipv6->nh != PROTNUM_TCP) || _lose((tcp_hdr_t *)(ipv6 + 1))) {
+        gnrc_pktbuf_release(pkt);
+        return size;
+    }
+
+    /* the pseudo header checksum does not depend on the order of the
+     * addresses, so the TCP checksum stays valid */
+    ipv6_addr_t tmp = ipv6->src;
+    ipv6->src = ipv6->dst;
+    ipv6->dst = tmp;
+
+    msg_t msg = { .content.ptr = pkt };
+    expect(mbox_try_put(&_link, &msg) == 1);
+    return size;
+}
+
+/* delivers the reflected segments when all other threads are idle, which
+ * delays them like a link with latency would */
+static void *_link_thread(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    while (1) {
+        mbox_get(&_link, &msg);
+        if (gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                         GNRC_NETREG_DEMUX_CTX_ALL,
+                                         msg.content.ptr) == 0) {
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+    return NULL;
+}
+
+static void *_server_thread(void *arg)
+{
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *tcb;
+    ssize_t res;
+
+    (void)arg;
+    expect(gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, SERVER_PORT, 0) == 0);
+    gnrc_tcp_tcb_init(&_server);
+    expect(gnrc_tcp_listen(&_queue, &_server, 1, &local) == 0);
+    expect(gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT) == 0);
+
+    /* reads until the end of the stream, which needs the FIN of the client */
+    while ((res = gnrc_tcp_recv(tcb, &_received[_received_len],
+                                sizeof(_received) - _received_len,
+                                USER_TIMEOUT_MS)) > 0) {
+        _received_len += res;
+    }
+    _eof = res;
+    gnrc_tcp_close(tcb);
+    mutex_unlock(&_server_done);
+    return NULL;
+}
+
+int main(void)
+{
+    gnrc_tcp_ep_t remote;
+
+    puts("TCP close with unacknowledged data test.");
+
+    netdev_test_setup(&_dev, NULL);
+    netdev_test_set_get_cb(&_dev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_dev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_dev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_dev, _send);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                      GNRC_NETIF_PRIO, "test_eth",
+                                      &_dev.netdev.netdev) == 0);
+    expect(gnrc_netif_ipv6_addr_add(&_netif, &_local, 64,
+                                    GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID) > 0);
+    expect(gnrc_ipv6_nib_nc_set(&_peer, _netif.pid, _peer_mac,
+                                sizeof(_peer_mac)) == 0);
+
+    thread_create(_link_stack, sizeof(_link_stack), THREAD_PRIORITY_MAIN + 1,
+                  0, _link_thread, NULL, "link");
+    thread_create(_server_stack, sizeof(_server_stack), THREAD_PRIORITY_MAIN - 1,
+                  0, _server_thread, NULL, "server");
+
+    expect(gnrc_tcp_ep_init(&remote, AF_INET6, _peer.u8, sizeof(_peer),
+                            SERVER_PORT, _netif.pid) == 0);
+    gnrc_tcp_tcb_init(&_client);
+    expect(gnrc_tcp_open(&_client, &remote, 0) == 0);
+
+    /* the data fills the retransmission queue, so the close is requested
+     * before it is acknowledged */
+    expect(gnrc_tcp_send(&_client, _data, sizeof(_data), USER_TIMEOUT_MS) ==
+           sizeof(_data));
+    gnrc_tcp_close(&_client);
+    mutex_lock(&_server_done);
+
+    printf("received %u bytes, %u FINs sent, end of stream: %d\n",
+           (unsigned)_received_len, _fins, (int)_eof);
+    expect(_received_len == sizeof(_data));
+    expect(memcmp(_received, _data, sizeof(_data)) == 0);
+    expect(_eof == 0);
+    expect(_fins > 1);
+
+    puts("SUCCESS");
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   Scheduler profiler test application
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "sched_profiler.h"
+#include "shell.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#define NUM_MSGS    (16U)
+#define NUM_SLEEPS  (8U)
+
+static char _rx_stack[THREAD_STACKSIZE_DEFAULT];
+static char _sleep_stack[THREAD_STACKSIZE_DEFAULT];
+static volatile unsigned _sleeps_done;
+
+static void *_rx_thread(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    while (1) {
+        msg_receive(&m);
+    }
+
+    return NULL;
+}
+
+static void *_sleep_thread(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; i < NUM_SLEEPS; i++) {
+        ztimer_sleep(ZTIMER_USEC, 1000);
+        _sleeps_done++;
+    }
+
+    return NULL;
+}
+
+static void _write_count(const void *data, size_t len, void *arg)
+{
+    (void)data;
+    *(size_t *)arg += len;
+}
+
+static int _check(const char *what, int cond)
+{
+    printf("%s: %s\n", what, cond ? "OK" : "FAILED");
+    return cond;
+}
+
+int main(void)
+{
+    sched_profiler_stat_t main_stat, rx_stat, sleep_stat;
+    int ok = 1;
+
+    sched_profiler_reset();
+
+    /* every message wakes up the higher priority thread, which preempts
+     * main from thread context */
+    kernel_pid_t rx = thread_create(_rx_stack, sizeof(_rx_stack),
+                                    THREAD_PRIORITY_MAIN - 1, 0,
+                                    _rx_thread, NULL, "rx");
+    for (unsigned i = 0; i < NUM_MSGS; i++) {
+        msg_t m = { .type = i };
+        msg_send(&m, rx);
+    }
+
+    /* the sleeping thread is woken up by the timer ISR while main is busy */
+    kernel_pid_t sleeper = thread_create(_sleep_stack, sizeof(_sleep_stack),
+                                         THREAD_PRIORITY_MAIN - 2, 0,
+                                         _sleep_thread, NULL, "sleeper");
+    while (_sleeps_done < NUM_SLEEPS) {}
+
+    sched_profiler_get(thread_getpid(), &main_stat);
+    sched_profiler_get(rx, &rx_stat);
+    sched_profiler_get(sleeper, &sleep_stat);
+
+    uint32_t rx_wakeups = 0;
+    for (unsigned i = 0; i < CONFIG_SCHED_PROFILER_HIST_SIZE; i++) {
+        rx_wakeups += rx_stat.latency_hist[i];
+    }
+
+    ok &= _check("rx woken per message",
+                 rx_wakeups == NUM_MSGS + 1);
+    ok &= _check("rx blocks voluntarily",
+                 rx_stat.voluntary == NUM_MSGS + 1);
+    ok &= _check("main preempted",
+                 main_stat.involuntary >= NUM_MSGS + 1 + NUM_SLEEPS);
+    ok &= _check("main preempted by ISR",
+                 main_stat.preempted_by_isr >= NUM_SLEEPS);
+    ok &= _check("sleeper never preempted",
+                 sleep_stat.involuntary == 0);
+    ok &= _check("sleeper blocks voluntarily",
+                 sleep_stat.voluntary >= NUM_SLEEPS);
+
+    size_t len = 0;
+    size_t ret = sched_profiler_export(_write_count, &len);
+    ok &= _check("export length", (len == ret) && (len > 5));
+
+    puts(ok ? "SUCCESS" : "FAILURE");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(NULL, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2026 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("SUCCESS")
+    child.sendline("schedprof")
+    child.expect(r"\tpid \| name\s+\|\s+runtime_us \|\s+switches \|")
+    child.expect(r"\t\s+\d+ \| rx\s+\| +\d+ \| +\d+ \| +\d+ \| +\d+ \| +\d+ \|")
+    child.sendline("schedprof hist 1")
+    child.expect(r"wake-up latency of 1 \(\w+\):")
+    child.expect(r"\t>= +\d+ us: \d+")
+    child.sendline("schedprof export")
+    # magic "SP", version 1
+    child.expect(r"535001[0-9a-f]+")
+    child.sendline("schedprof reset")
+    child.expect_exact(">")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the static tracepoints
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "trace.h"
+#include "ztimer.h"
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static mutex_t _mutex = MUTEX_INIT_LOCKED;
+static trace_event_t _events[CONFIG_TRACE_BUFSIZE];
+
+static void *_thread(void *arg)
+{
+    (void)arg;
+    msg_t m;
+
+    /* blocks until main unlocks */
+    mutex_lock(&_mutex);
+    msg_receive(&m);
+    ztimer_sleep(ZTIMER_USEC, 100);
+    mutex_unlock(&_mutex);
+
+    return NULL;
+}
+
+int main(void)
+{
+    static const uint16_t expected[] = {
+        TRACE_EVENT_USER,
+        TRACE_EVENT_SCHED_SWITCH,
+        TRACE_EVENT_SCHED_WAKEUP,
+        TRACE_EVENT_MSG_SEND,
+        TRACE_EVENT_MSG_RECV,
+        TRACE_EVENT_MUTEX_BLOCK,
+        TRACE_EVENT_MUTEX_RESUME,
+        TRACE_EVENT_MUTEX_HANDOVER,
+        TRACE_EVENT_ZTIMER_SET,
+        TRACE_EVENT_ZTIMER_FIRE,
+    };
+    bool ok = true;
+
+    trace_reset();
+    trace(0x1234);
+
+    kernel_pid_t pid = thread_create(_stack, sizeof(_stack),
+                                     THREAD_PRIORITY_MAIN - 1, 0,
+                                     _thread, NULL, "tracee");
+    mutex_unlock(&_mutex);
+    msg_t m = { .type = 0x42 };
+    msg_send(&m, pid);
+    mutex_lock(&_mutex);
+
+    size_t n = trace_read(_events, ARRAY_SIZE(_events));
+    printf("read %u events\n", (unsigned)n);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(expected); i++) {
+        bool found = false;
+
+        for (size_t j = 0; j < n; j++) {
+            if (_events[j].id != expected[i]) {
+                continue;
+            }
+            found = true;
+            if ((expected[i] == TRACE_EVENT_MSG_SEND) &&
+                ((_events[j].arg0 != (uint32_t)pid) ||
+                 (_events[j].arg1 != 0x42) ||
+                 (_events[j].ctx != thread_getpid()))) {
+                found = false;
+            }
+            if (found) {
+                break;
+            }
+        }
+        printf("%s: %s\n", trace_event_name(expected[i]),
+               found ? "OK" : "missing");
+        ok &= found;
+    }
+
+    /* everything was taken out */
+    ok &= (trace_read(_events, ARRAY_SIZE(_events)) == 0);
+
+    puts(ok ? "SUCCESS" : "FAILURE");
+
+    return 0;
+}
@@ -18,6 +18,10 @@
 #include "embUnit.h"
 
 #include "net/gcoap.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/udp.h"
+#include "net/ipv6/addr.h"
 
 #include "unittests-constants.h"
 #include "tests-gcoap.h"
@@ -392,6 +396,66 @@ static void test_gcoap__server_get_resource_list(void)
     TEST_ASSERT_EQUAL_STRING(resource_list_str, (char *)res);
 }
 
+static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
+                          const sock_udp_ep_t *remote)
+{
+    (void)memo;
+    (void)pdu;
+    (void)remote;
+}
+
+/*
+ * Client requests tracked in a pool of request memos provided at runtime,
+ * larger than the built-in one.
+ */
+static void test_gcoap__client_req_memo_pool(void)
+{
+    static gcoap_request_memo_t memos[CONFIG_GCOAP_REQ_WAITING_MAX + 3];
+    uint8_t bufs[ARRAY_SIZE(memos) + 1][CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdus[ARRAY_SIZE(bufs)];
+    /* no one listens on the remote port, so the requests stay open */
+    sock_udp_ep_t remote = { .family = AF_INET6, .port = COAP_PORT + 1 };
+
+    memcpy(remote.addr.ipv6, &ipv6_addr_loopback, sizeof(remote.addr.ipv6));
+    /* auto_init is disabled for the unittests */
+    if (gnrc_ipv6_pid == KERNEL_PID_UNDEF) {
+        gnrc_pktbuf_init();
+        gnrc_ipv6_init();
+        gnrc_udp_init();
+        gcoap_init();
+    }
+    TEST_ASSERT_EQUAL_INT(0, gcoap_req_memo_pool_set(memos, ARRAY_SIZE(memos)));
+
+    for (unsigned i = 0; i < ARRAY_SIZE(bufs); i++) {
+        size_t len = gcoap_request(&pdus[i], bufs[i], sizeof(bufs[i]),
+                                   COAP_METHOD_GET, "/time");
+        ssize_t res = gcoap_req_send(bufs[i], len, &remote, NULL,
+                                     _resp_handler, NULL,
+                                     GCOAP_SOCKET_TYPE_UNDEF);
+        /* the last request finds no free memo */
+        TEST_ASSERT_EQUAL_INT((i < ARRAY_SIZE(memos)) ? (ssize_t)len : 0, res);
+    }
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(memos), gcoap_op_state());
+    TEST_ASSERT_EQUAL_INT(-EBUSY, gcoap_req_memo_pool_set(NULL, 0));
+
+    /* forget the requests in reverse order, so memos are taken from the
+     * middle of the hash buckets */
+    for (unsigned i = ARRAY_SIZE(memos); i-- > 0;) {
+        TEST_ASSERT_EQUAL_INT(0, gcoap_obs_req_forget(&remote,
+                                                      coap_get_token(&pdus[i]),
+                                                      coap_get_token_len(&pdus[i])));
+        TEST_ASSERT_EQUAL_INT(-ENOENT, gcoap_obs_req_forget(&remote,
+                                                            coap_get_token(&pdus[i]),
+                                                            coap_get_token_len(&pdus[i])));
+    }
+    TEST_ASSERT_EQUAL_INT(0, gcoap_op_state());
+    TEST_ASSERT_EQUAL_INT(0, gcoap_req_memo_pool_set(NULL, 0));
+    /* the forgotten requests must not time out in the released pool */
+    for (unsigned i = 0; i < ARRAY_SIZE(memos); i++) {
+        TEST_ASSERT(!event_timeout_is_pending(&memos[i].resp_evt_tmout));
+    }
+}
+
 Test *tests_gcoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -405,7 +469,8 @@ Test *tests_gcoap_tests(void)
         new_TestFixture(test_gcoap__server_get_resp),
         new_TestFixture(test_gcoap__server_con_req),
         new_TestFixture(test_gcoap__server_con_resp),
-        new_TestFixture(test_gcoap__server_get_resource_list)
+        new_TestFixture(test_gcoap__server_get_resource_list),
+        new_TestFixture(test_gcoap__client_req_memo_pool),
     };
 
     EMB_UNIT_TESTCALLER(gcoap_tests, NULL, NULL, fixtures);
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <string.h>
+
+#include "net/gnrc/ipv6/fwd_cache.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/ipv6/nib/nc.h"
+
+#include "tests-gnrc_ipv6_fwd_cache.h"
+
+#define GLOBAL_PREFIX       { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0 }
+#define L2ADDR              { 0x90, 0xd5, 0x8e, 0x8c, 0x92, 0x43, 0x73, 0x5c }
+#define IN_IFACE            (5)
+#define IFACE               (6)
+
+static const ipv6_addr_t _dst = { .u8 = {
+        0x20, 0x01, 0x0d, 0xb8, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    } };
+static const ipv6_addr_t _next_hop = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02
+    } };
+static const uint8_t _l2addr[] = L2ADDR;
+
+static void set_up(void)
+{
+    gnrc_ipv6_nib_init();
+    /* entries of previous tests are not valid anymore */
+    gnrc_ipv6_fwd_cache_invalidate();
+}
+
+/* adds the next hop as unmanaged neighbor and gets its entry */
+static void _set_next_hop(gnrc_ipv6_nib_nc_t *nce)
+{
+    void *state = NULL;
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&_next_hop, IFACE, _l2addr,
+                                                  sizeof(_l2addr)));
+    TEST_ASSERT(gnrc_ipv6_nib_nc_iter(IFACE, &state, nce));
+    TEST_ASSERT(ipv6_addr_equal(&_next_hop, &nce->ipv6));
+}
+
+/* caches the next hop for _dst as _send_unicast() of gnrc_ipv6 does */
+static void _add(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+
+    _set_next_hop(&nce);
+    gnrc_ipv6_fwd_cache_add(&_dst, IN_IFACE, &nce,
+                            gnrc_ipv6_fwd_cache_generation());
+    TEST_ASSERT_NOT_NULL(gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE));
+}
+
+/*
+ * Adds the next hop of a flow to the cache
+ * Expected result: gnrc_ipv6_fwd_cache_get() returns the next hop for the flow
+ * only
+ */
+static void test_fwd_cache_add__success(void)
+{
+    const gnrc_ipv6_fwd_cache_entry_t *entry;
+    ipv6_addr_t other = _dst;
+
+    _add();
+    entry = gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT(ipv6_addr_equal(&_dst, &entry->dst));
+    TEST_ASSERT_EQUAL_INT(IFACE, entry->iface);
+    TEST_ASSERT_EQUAL_INT(sizeof(_l2addr), entry->l2addr_len);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_l2addr, entry->l2addr, sizeof(_l2addr)));
+    TEST_ASSERT_NULL(gnrc_ipv6_fwd_cache_get(&_dst, IFACE));
+    other.u8[15]++;
+    TEST_ASSERT_NULL(gnrc_ipv6_fwd_cache_get(&other, IN_IFACE));
+}
+
+/*
+ * Changes the NIB between getting the generation and adding the next hop
+ * Expected result: the next hop is not cached
+ */
+static void test_fwd_cache_add__nib_changed(void)
+{
+    gnrc_ipv6_nib_nc_t nce;
+    uint32_t generation = gnrc_ipv6_fwd_cache_generation();
+
+    _set_next_hop(&nce);
+    gnrc_ipv6_fwd_cache_add(&_dst, IN_IFACE, &nce, generation);
+    TEST_ASSERT_NULL(gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE));
+}
+
+/*
+ * Adds a neighbor cache entry for another neighbor
+ * Expected result: the cache is invalidated
+ */
+static void test_fwd_cache_invalidate__nc_set(void)
+{
+    ipv6_addr_t other = _next_hop;
+
+    _add();
+    other.u8[15]++;
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_nc_set(&other, IFACE, _l2addr,
+                                                  sizeof(_l2addr)));
+    TEST_ASSERT_NULL(gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE));
+}
+
+/*
+ * Removes the neighbor cache entry of the next hop
+ * Expected result: the cache is invalidated
+ */
+static void test_fwd_cache_invalidate__nc_del(void)
+{
+    _add();
+    gnrc_ipv6_nib_nc_del(&_next_hop, IFACE);
+    TEST_ASSERT_NULL(gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE));
+}
+
+/*
+ * Adds a route to the forwarding table
+ * Expected result: the cache is invalidated
+ */
+static void test_fwd_cache_invalidate__ft_add(void)
+{
+    static const ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+
+    _add();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&pfx, 32, &_next_hop, IFACE,
+                                                  0));
+    TEST_ASSERT_NULL(gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE));
+}
+
+/*
+ * Removes a route from the forwarding table after the next hop was cached
+ * Expected result: the cache is invalidated
+ */
+static void test_fwd_cache_invalidate__ft_del(void)
+{
+    static const ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&pfx, 32, &_next_hop, IFACE,
+                                                  0));
+    _add();
+    gnrc_ipv6_nib_ft_del(&pfx, 32);
+    TEST_ASSERT_NULL(gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE));
+}
+
+/*
+ * Adds a default route
+ * Expected result: the cache is invalidated
+ */
+static void test_fwd_cache_invalidate__default_route(void)
+{
+    _add();
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(NULL, 0, &_next_hop, IFACE,
+                                                  0));
+    TEST_ASSERT_NULL(gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE));
+}
+
+/*
+ * Looks up a flow, records a hit and invalidates the cache
+ * Expected result: only the recorded hit, the next hop resolved by the NIB and
+ * the invalidation are counted
+ */
+static void test_fwd_cache_stats(void)
+{
+    gnrc_ipv6_fwd_cache_stats_t before, after;
+    const gnrc_ipv6_fwd_cache_entry_t *entry;
+
+    gnrc_ipv6_fwd_cache_stats_get(&before);
+    _add();
+    entry = gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE);
+    TEST_ASSERT_NOT_NULL(entry);
+    gnrc_ipv6_fwd_cache_hit(entry);
+    gnrc_ipv6_fwd_cache_invalidate();
+    TEST_ASSERT_NULL(gnrc_ipv6_fwd_cache_get(&_dst, IN_IFACE));
+    gnrc_ipv6_fwd_cache_stats_get(&after);
+    TEST_ASSERT_EQUAL_INT(1, after.hits - before.hits);
+    TEST_ASSERT_EQUAL_INT(1, after.misses - before.misses);
+    /* _add() changes the neighbor cache, too */
+    TEST_ASSERT(after.invalidations - before.invalidations >= 2);
+}
+
+Test *tests_gnrc_ipv6_fwd_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_fwd_cache_add__success),
+        new_TestFixture(test_fwd_cache_add__nib_changed),
+        new_TestFixture(test_fwd_cache_invalidate__nc_set),
+        new_TestFixture(test_fwd_cache_invalidate__nc_del),
+        new_TestFixture(test_fwd_cache_invalidate__ft_add),
+        new_TestFixture(test_fwd_cache_invalidate__ft_del),
+        new_TestFixture(test_fwd_cache_invalidate__default_route),
+        new_TestFixture(test_fwd_cache_stats),
+    };
+
+    EMB_UNIT_TESTCALLER(fwd_cache_tests, set_up, NULL, fixtures);
+
+    return (Test *)&fwd_cache_tests;
+}
+
+void tests_gnrc_ipv6_fwd_cache(void)
+{
+    TESTS_RUN(tests_gnrc_ipv6_fwd_cache_tests());
+}
+/** @} */
@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <kernel_defines.h>
+
+#include "net/ipv6/addr.h"
+#include "net/gnrc/ipv6/nib/conf.h"
+
+#include "_nib-internal.h"
+
+#include "tests-gnrc_ipv6_nib.h"
+
+#define IFACE               (6)
+
+/* 2001:db8:<a>:<b>::<c> */
+#define ADDR(a, b, c)       { .u8 = { 0x20, 0x01, 0x0d, 0xb8, 0, a, 0, b, \
+                                      0, 0, 0, 0, 0, 0, 0, c } }
+
+static const ipv6_addr_t _next_hop = { .u8 = {
+        0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01
+    } };
+static const ipv6_addr_t _pfx32 = ADDR(0, 0, 0);
+static const ipv6_addr_t _pfx48 = ADDR(1, 0, 0);
+static const ipv6_addr_t _pfx64 = ADDR(1, 2, 0);
+
+static void set_up(void)
+{
+    _nib_init();
+}
+
+static void _add(const ipv6_addr_t *pfx, unsigned pfx_len,
+                 const ipv6_addr_t *next_hop, _nib_offl_entry_t **dst)
+{
+    *dst = _nib_ft_add(next_hop, IFACE, pfx, pfx_len);
+    TEST_ASSERT_NOT_NULL(*dst);
+}
+
+/* checks that dst is the best match for 2001:db8:<a>:<b>::<c> */
+static void _check(unsigned a, unsigned b, unsigned c,
+                   const _nib_offl_entry_t *dst)
+{
+    const ipv6_addr_t addr = ADDR(a, b, c);
+
+    TEST_ASSERT(_nib_offl_index_get_match(&addr) == dst);
+}
+
+/*
+ * Looks up an address in an empty index
+ * Expected result: no match
+ */
+static void test_nib_offl_index_get_match__empty(void)
+{
+    _check(1, 2, 3, NULL);
+}
+
+/*
+ * Adds a prefix and looks up addresses in and outside of it
+ * Expected result: only the address within the prefix matches
+ */
+static void test_nib_offl_index_get_match__insert(void)
+{
+    static const ipv6_addr_t outside = { .u8 = {
+            0x20, 0x01, 0x0d, 0xb9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1
+        } };
+    _nib_offl_entry_t *dst;
+
+    _add(&_pfx32, 32, &_next_hop, &dst);
+    _check(0, 0, 1, dst);
+    _check(0xff, 0xff, 0xff, dst);
+    TEST_ASSERT_NULL(_nib_offl_index_get_match(&outside));
+}
+
+/*
+ * Adds a host route and looks up its address and its neighbors
+ * Expected result: only the address of the host route matches
+ */
+static void test_nib_offl_index_get_match__host_route(void)
+{
+    const ipv6_addr_t host = ADDR(1, 2, 3);
+    _nib_offl_entry_t *dst;
+
+    _add(&host, IPV6_ADDR_BIT_LEN, &_next_hop, &dst);
+    _check(1, 2, 3, dst);
+    _check(1, 2, 2, NULL);
+    _check(1, 2, 4, NULL);
+}
+
+/*
+ * Adds nested prefixes, not ordered by length
+ * Expected result: every address matches the longest prefix containing it
+ */
+static void test_nib_offl_index_get_match__longest_prefix(void)
+{
+    _nib_offl_entry_t *dst32, *dst48, *dst64;
+
+    _add(&_pfx64, 64, &_next_hop, &dst64);
+    _add(&_pfx32, 32, &_next_hop, &dst32);
+    _add(&_pfx48, 48, &_next_hop, &dst48);
+    _check(1, 2, 1, dst64);
+    _check(1, 3, 1, dst48);
+    _check(2, 2, 1, dst32);
+}
+
+/*
+ * Adds two prefixes that diverge after their common prefix, then a prefix
+ * covering both
+ * Expected result: addresses match their own prefix, an address of neither
+ * prefix does not match the branch point between them but the covering prefix
+ */
+static void test_nib_offl_index_get_match__diverging(void)
+{
+    const ipv6_addr_t pfx = ADDR(2, 0, 0);
+    _nib_offl_entry_t *dst1, *dst2, *dst32;
+
+    _add(&_pfx48, 48, &_next_hop, &dst1);
+    _add(&pfx, 48, &_next_hop, &dst2);
+    _check(1, 0, 1, dst1);
+    _check(2, 0, 1, dst2);
+    _check(3, 0, 1, NULL);
+    _add(&_pfx32, 32, &_next_hop, &dst32);
+    _check(1, 0, 1, dst1);
+    _check(2, 0, 1, dst2);
+    _check(3, 0, 1, dst32);
+}
+
+/*
+ * Adds the same prefix over two next hops
+ * Expected result: the entry first in the off-link entry array matches, as
+ * with a linear search, until it is removed
+ */
+static void test_nib_offl_index_get_match__same_prefix(void)
+{
+    ipv6_addr_t next_hop = _next_hop;
+    _nib_offl_entry_t *dst1, *dst2;
+
+    _add(&_pfx48, 48, &next_hop, &dst1);
+    next_hop.u8[15]++;
+    _add(&_pfx48, 48, &next_hop, &dst2);
+    TEST_ASSERT(dst1 != dst2);
+    _check(1, 0, 1, (dst1 < dst2) ? dst1 : dst2);
+    _nib_ft_remove((dst1 < dst2) ? dst1 : dst2);
+    _check(1, 0, 1, (dst1 < dst2) ? dst2 : dst1);
+}
+
+/*
+ * Removes nested prefixes one by one
+ * Expected result: addresses fall back to the next shorter prefix, no address
+ * matches after the last one is removed
+ */
+static void test_nib_offl_index_get_match__delete(void)
+{
+    _nib_offl_entry_t *dst32, *dst48, *dst64;
+
+    _add(&_pfx32, 32, &_next_hop, &dst32);
+    _add(&_pfx48, 48, &_next_hop, &dst48);
+    _add(&_pfx64, 64, &_next_hop, &dst64);
+    _nib_ft_remove(dst48);
+    _check(1, 2, 1, dst64);
+    _check(1, 3, 1, dst32);
+    _nib_ft_remove(dst64);
+    _check(1, 2, 1, dst32);
+    _nib_ft_remove(dst32);
+    _check(1, 2, 1, NULL);
+    _check(0, 0, 1, NULL);
+}
+
+/*
+ * Removes one of two diverging prefixes and adds it again
+ * Expected result: the other prefix still matches, the added prefix matches
+ * again
+ */
+static void test_nib_offl_index_get_match__delete_branch(void)
+{
+    const ipv6_addr_t pfx = ADDR(2, 0, 0);
+    _nib_offl_entry_t *dst1, *dst2;
+
+    _add(&_pfx48, 48, &_next_hop, &dst1);
+    _add(&pfx, 48, &_next_hop, &dst2);
+    _nib_ft_remove(dst1);
+    _check(1, 0, 1, NULL);
+    _check(2, 0, 1, dst2);
+    _add(&_pfx48, 48, &_next_hop, &dst1);
+    _check(1, 0, 1, dst1);
+    _check(2, 0, 1, dst2);
+}
+
+Test *tests_gnrc_ipv6_nib_index_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_nib_offl_index_get_match__empty),
+        new_TestFixture(test_nib_offl_index_get_match__insert),
+        new_TestFixture(test_nib_offl_index_get_match__host_route),
+        new_TestFixture(test_nib_offl_index_get_match__longest_prefix),
+        new_TestFixture(test_nib_offl_index_get_match__diverging),
+        new_TestFixture(test_nib_offl_index_get_match__same_prefix),
+        new_TestFixture(test_nib_offl_index_get_match__delete),
+        new_TestFixture(test_nib_offl_index_get_match__delete_branch),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, NULL,
+                        fixtures);
+
+    return (Test *)&tests;
+}
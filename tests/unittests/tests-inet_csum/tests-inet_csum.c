@@ -12,8 +12,11 @@
  * @file
  */
 #include <errno.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "container.h"
 #include "embUnit.h"
 
 #include "net/inet_csum.h"
@@ -165,6 +168,68 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* byte-wise reference implementation of inet_csum_slice() */
+static uint16_t _ref_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len,
+                                size_t accum_len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < len; i++) {
+        if ((accum_len + i) & 1) {
+            csum += buf[i];
+        }
+        else {
+            csum += (uint16_t)(buf[i] << 8);
+        }
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void _cross_check(const uint8_t *data, size_t data_len)
+{
+    static const uint16_t sums[] = { 0x0000, 0x1234, 0xffff };
+
+    /* every alignment a word or SIMD loop might care about */
+    for (unsigned offset = 0; offset < 32; offset++) {
+        for (unsigned len = 0; (offset + len) <= data_len;
+             len += (len < 128) ? 1 : 61) {
+            for (unsigned accum_len = 0; accum_len < 2; accum_len++) {
+                for (unsigned i = 0; i < ARRAY_SIZE(sums); i++) {
+                    uint16_t ref = _ref_csum_slice(sums[i], &data[offset],
+                                                   len, accum_len);
+                    uint16_t res = inet_csum_slice(sums[i], &data[offset],
+                                                   len, accum_len);
+                    if (ref != res) {
+                        printf("offset %u len %u accum_len %u sum 0x%04x: "
+                               "0x%04x != 0x%04x\n", offset, len, accum_len,
+                               sums[i], res, ref);
+                    }
+                    TEST_ASSERT_EQUAL_INT(ref, res);
+                }
+            }
+        }
+    }
+}
+
+static void test_inet_csum__cross_check(void)
+{
+    static uint8_t data[1600];
+    uint32_t state = 0x5eed;
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        state = (state * 1103515245U) + 12345U;
+        data[i] = state >> 16;
+    }
+    _cross_check(data, sizeof(data));
+
+    /* provoke as many carries as possible */
+    memset(data, 0xff, sizeof(data));
+    _cross_check(data, sizeof(data));
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +241,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__cross_check),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -310,6 +310,115 @@ static void test_nanocoap_cache__max_age(void)
     TEST_ASSERT(nanocoap_cache_entry_is_stale(c, 20));
 }
 
+/* adds a response of len bytes filled with id under the cache key id */
+static nanocoap_cache_entry_t *_add_filled(uint8_t id, size_t len)
+{
+    uint8_t key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH] = { id };
+    uint8_t rbuf[_BUF_SIZE];
+    coap_pkt_t resp = { .hdr = (coap_hdr_t *)rbuf, .payload = &rbuf[4] };
+
+    memset(rbuf, id, sizeof(rbuf));
+    return nanocoap_cache_add_by_key(key, COAP_METHOD_GET, &resp, len);
+}
+
+/* looks up the response cached under the cache key id, NULL if it is not
+ * cached or does not hold the data of _add_filled() */
+static nanocoap_cache_entry_t *_lookup_filled(uint8_t id)
+{
+    uint8_t key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH] = { id };
+    nanocoap_cache_entry_t *c = nanocoap_cache_key_lookup(key);
+
+    if (!c || ((uint8_t *)c->response_pkt.hdr != c->response_buf) ||
+        (c->response_pkt.payload != &c->response_buf[4])) {
+        return NULL;
+    }
+    for (unsigned i = 0; i < c->response_len; i++) {
+        if (c->response_buf[i] != id) {
+            return NULL;
+        }
+    }
+    return c;
+}
+
+static void test_nanocoap_cache__arena(void)
+{
+    /* the defaults give an arena of 8 * 128 bytes */
+    const size_t small = (CONFIG_NANOCOAP_CACHE_ARENA_SIZE /
+                          CONFIG_NANOCOAP_CACHE_ENTRIES) - 28;
+    const size_t large = CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE;
+    nanocoap_cache_stats_t stats;
+
+    nanocoap_cache_init();
+
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        TEST_ASSERT_NOT_NULL(_add_filled(i, small));
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES * small,
+                          nanocoap_cache_arena_used());
+
+    /* leave holes in the arena, the large responses then need compaction */
+    for (unsigned i = 1; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i += 2) {
+        TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_del(_lookup_filled(i)));
+    }
+    TEST_ASSERT_NOT_NULL(_add_filled(100, large));
+    TEST_ASSERT_NOT_NULL(_add_filled(101, large));
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i += 2) {
+        TEST_ASSERT_NOT_NULL(_lookup_filled(i));
+    }
+    TEST_ASSERT_NOT_NULL(_lookup_filled(100));
+    TEST_ASSERT_NOT_NULL(_lookup_filled(101));
+    nanocoap_cache_stats_get(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.evictions);
+
+    /* replaces the least recently used entries once the arena is full */
+    for (unsigned i = 102; i < 102 + CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        TEST_ASSERT_NOT_NULL(_add_filled(i, large));
+        TEST_ASSERT(nanocoap_cache_arena_used() <=
+                    CONFIG_NANOCOAP_CACHE_ARENA_SIZE);
+    }
+    TEST_ASSERT_NULL(_lookup_filled(0));
+    TEST_ASSERT_NULL(_lookup_filled(100));
+    for (unsigned i = 102; i < 102 + CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        TEST_ASSERT_NOT_NULL(_lookup_filled(i));
+    }
+    TEST_ASSERT_EQUAL_INT(CONFIG_NANOCOAP_CACHE_ENTRIES * large,
+                          nanocoap_cache_arena_used());
+
+    /* a response of a different length replaces the one of the same key */
+    TEST_ASSERT_NOT_NULL(_add_filled(102, small));
+    TEST_ASSERT_EQUAL_INT(small, _lookup_filled(102)->response_len);
+    TEST_ASSERT_EQUAL_INT((CONFIG_NANOCOAP_CACHE_ENTRIES - 1) * large + small,
+                          nanocoap_cache_arena_used());
+
+    /* too large or empty responses are not cached */
+    TEST_ASSERT_NULL(_add_filled(200, CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE + 1));
+    TEST_ASSERT_NULL(_add_filled(200, 0));
+}
+
+static void test_nanocoap_cache__stats(void)
+{
+    nanocoap_cache_stats_t stats;
+
+    nanocoap_cache_init();
+    nanocoap_cache_stats_get(&stats);
+    TEST_ASSERT_EQUAL_INT(0, stats.hits);
+    TEST_ASSERT_EQUAL_INT(0, stats.misses);
+    TEST_ASSERT_EQUAL_INT(0, stats.evictions);
+
+    for (unsigned i = 0; i <= CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        TEST_ASSERT_NOT_NULL(_add_filled(i, 16));
+    }
+    TEST_ASSERT_NULL(_lookup_filled(0));
+    TEST_ASSERT_NOT_NULL(_lookup_filled(1));
+    TEST_ASSERT_NOT_NULL(_lookup_filled(CONFIG_NANOCOAP_CACHE_ENTRIES));
+
+    nanocoap_cache_stats_get(&stats);
+    TEST_ASSERT_EQUAL_INT(2, stats.hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, stats.evictions);
+    TEST_ASSERT_EQUAL_INT(-1, nanocoap_cache_del(NULL));
+}
+
 Test *tests_nanocoap_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -318,6 +427,8 @@ Test *tests_nanocoap_cache_tests(void)
         new_TestFixture(test_nanocoap_cache__cachekey),
         new_TestFixture(test_nanocoap_cache__cachekey_blockwise),
         new_TestFixture(test_nanocoap_cache__max_age),
+        new_TestFixture(test_nanocoap_cache__arena),
+        new_TestFixture(test_nanocoap_cache__stats),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_cache_entry_tests, NULL, NULL, fixtures);
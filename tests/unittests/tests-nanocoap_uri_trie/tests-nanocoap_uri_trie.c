@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/nanocoap/uri_trie.h"
+
+#include "tests-nanocoap_uri_trie.h"
+
+#define _BUF_SIZE (128U)
+
+static const coap_resource_t _resources[] = {
+    { "/a", COAP_GET, NULL, NULL },
+    { "/ab", COAP_GET | COAP_POST, NULL, NULL },
+    { "/abc/", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+    { "/b", COAP_POST, NULL, NULL },
+    { "/b", COAP_GET, NULL, NULL },
+    { "/abc", COAP_PUT, NULL, NULL },
+    { "/", COAP_GET, NULL, NULL },
+    { "/b/c", COAP_GET | COAP_MATCH_SUBTREE, NULL, NULL },
+};
+
+static coap_uri_trie_node_t _nodes[COAP_URI_TRIE_NODES_NUMOF(ARRAY_SIZE(_resources))];
+static uint16_t _next[ARRAY_SIZE(_resources)];
+static coap_uri_trie_t _trie = COAP_URI_TRIE_INIT(_nodes, _next);
+static uint8_t _buf[_BUF_SIZE];
+
+static void _build_req(coap_pkt_t *pkt, unsigned code, const char *path)
+{
+    size_t len = coap_build_hdr((coap_hdr_t *)_buf, COAP_TYPE_NON, NULL, 0,
+                                code, 1);
+
+    coap_pkt_init(pkt, _buf, sizeof(_buf), len);
+    if (path) {
+        coap_opt_add_uri_path(pkt, path);
+    }
+    coap_opt_finish(pkt, COAP_OPT_FINISH_NONE);
+}
+
+/* returns the index of the resource found or the error */
+static int _lookup(unsigned code, const char *path)
+{
+    coap_pkt_t pkt;
+    const coap_resource_t *resource = NULL;
+
+    _build_req(&pkt, code, path);
+    int res = coap_uri_trie_lookup(&_trie, &pkt, &resource);
+    return (res < 0) ? res : (int)(resource - _resources);
+}
+
+static void set_up(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, coap_uri_trie_build(&_trie, _resources,
+                                                 ARRAY_SIZE(_resources)));
+}
+
+static void test_nanocoap_uri_trie__exact(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, _lookup(COAP_METHOD_GET, "/a"));
+    TEST_ASSERT_EQUAL_INT(1, _lookup(COAP_METHOD_GET, "/ab"));
+    TEST_ASSERT_EQUAL_INT(1, _lookup(COAP_METHOD_POST, "/ab"));
+    TEST_ASSERT_EQUAL_INT(5, _lookup(COAP_METHOD_PUT, "/abc"));
+    TEST_ASSERT_EQUAL_INT(6, _lookup(COAP_METHOD_GET, NULL));
+}
+
+static void test_nanocoap_uri_trie__same_path(void)
+{
+    TEST_ASSERT_EQUAL_INT(3, _lookup(COAP_METHOD_POST, "/b"));
+    TEST_ASSERT_EQUAL_INT(4, _lookup(COAP_METHOD_GET, "/b"));
+}
+
+static void test_nanocoap_uri_trie__subtree(void)
+{
+    TEST_ASSERT_EQUAL_INT(2, _lookup(COAP_METHOD_GET, "/abc/d"));
+    TEST_ASSERT_EQUAL_INT(2, _lookup(COAP_METHOD_GET, "/abc/d/e/f"));
+    /* subtree matches are string prefixes */
+    TEST_ASSERT_EQUAL_INT(7, _lookup(COAP_METHOD_GET, "/b/c"));
+    TEST_ASSERT_EQUAL_INT(7, _lookup(COAP_METHOD_GET, "/b/cd"));
+    TEST_ASSERT_EQUAL_INT(7, _lookup(COAP_METHOD_GET, "/b/c/d"));
+}
+
+static void test_nanocoap_uri_trie__no_match(void)
+{
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _lookup(COAP_METHOD_GET, "/c"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _lookup(COAP_METHOD_GET, "/abcd"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _lookup(COAP_METHOD_GET, "/a/b"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _lookup(COAP_METHOD_GET, "/b/"));
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, _lookup(COAP_METHOD_DELETE, "/a"));
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, _lookup(COAP_METHOD_GET, "/abc"));
+    TEST_ASSERT_EQUAL_INT(-ENOTSUP, _lookup(COAP_METHOD_POST, "/abc/d"));
+}
+
+static void test_nanocoap_uri_trie__as_linear(void)
+{
+    static const char *paths[] = {
+        "/", "/a", "/ab", "/abc", "/abc/", "/abc/x", "/b", "/b/c", "/b/c/x",
+        "/ba", "/x/y/z",
+    };
+    static const unsigned codes[] = {
+        COAP_METHOD_GET, COAP_METHOD_POST, COAP_METHOD_PUT,
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(paths); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(codes); j++) {
+            coap_method_flags_t flag = coap_method2flag(codes[j]);
+            int expected = -ENOENT;
+
+            /* first match as coap_tree_handler() picks it */
+            for (unsigned k = 0; k < ARRAY_SIZE(_resources); k++) {
+                if (coap_match_path(&_resources[k],
+                                    (const uint8_t *)paths[i]) == 0) {
+                    if (_resources[k].methods & flag) {
+                        expected = k;
+                        break;
+                    }
+                    expected = -ENOTSUP;
+                }
+            }
+            TEST_ASSERT_EQUAL_INT(expected,
+                                  _lookup(codes[j], strcmp(paths[i], "/")
+                                                    ? paths[i] : NULL));
+        }
+    }
+}
+
+static void test_nanocoap_uri_trie__ENOMEM(void)
+{
+    coap_uri_trie_node_t nodes[4];
+    uint16_t next[ARRAY_SIZE(_resources)];
+    coap_uri_trie_t trie = COAP_URI_TRIE_INIT(nodes, next);
+
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, coap_uri_trie_build(&trie, _resources,
+                                                       ARRAY_SIZE(_resources)));
+    TEST_ASSERT_EQUAL_INT(-ENOMEM, coap_uri_trie_build(&_trie, _resources,
+                                                       ARRAY_SIZE(_next) + 1));
+}
+
+Test *tests_nanocoap_uri_trie_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_nanocoap_uri_trie__exact),
+        new_TestFixture(test_nanocoap_uri_trie__same_path),
+        new_TestFixture(test_nanocoap_uri_trie__subtree),
+        new_TestFixture(test_nanocoap_uri_trie__no_match),
+        new_TestFixture(test_nanocoap_uri_trie__as_linear),
+        new_TestFixture(test_nanocoap_uri_trie__ENOMEM),
+    };
+
+    EMB_UNIT_TESTCALLER(nanocoap_uri_trie_tests, set_up, NULL, fixtures);
+
+    return (Test *)&nanocoap_uri_trie_tests;
+}
+
+void tests_nanocoap_uri_trie(void)
+{
+    TESTS_RUN(tests_nanocoap_uri_trie_tests());
+}
+/** @} */
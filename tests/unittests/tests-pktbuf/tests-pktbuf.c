@@ -661,6 +661,110 @@ static void test_pktbuf_realloc_data__success3(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
+static void test_pktbuf_mark_headroom__size_too_large(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16),
+                                          GNRC_NETTYPE_TEST);
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NULL(gnrc_pktbuf_mark_headroom(pkt, sizeof(TEST_STRING16)));
+    TEST_ASSERT_NULL(pkt->next);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16), pkt->size);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* gnrc_pktbuf_malloc can't take headroom */
+static void test_pktbuf_take_headroom__success(void)
+{
+    uint8_t *data = (uint8_t *)(TEST_STRING64);
+    gnrc_pktsnip_t *pkt, *headroom;
+    uint8_t *exp_data;
+
+    pkt = gnrc_pktbuf_add(NULL, data, sizeof(TEST_STRING64), GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    exp_data = pkt->data;
+    /* odd size, so the data of pkt does not start aligned */
+    TEST_ASSERT_NOT_NULL((headroom = gnrc_pktbuf_mark_headroom(pkt, 11)));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(pkt->next == headroom);
+    TEST_ASSERT(exp_data + 11 == pkt->data);
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING64) - 11, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 11, pkt->data, pkt->size));
+    TEST_ASSERT_EQUAL_INT(GNRC_NETTYPE_UNDEF, headroom->type);
+    TEST_ASSERT(headroom->size <= 11);
+
+    /* release the end of the data behind the unaligned start */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 13));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(exp_data + 11 == pkt->data);
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_take_headroom(pkt, headroom, 5));
+    TEST_ASSERT(exp_data + 6 == pkt->data);
+    TEST_ASSERT_EQUAL_INT(18, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 11, (uint8_t *)pkt->data + 5, 13));
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, gnrc_pktbuf_take_headroom(pkt, headroom, 7));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_take_headroom(pkt, headroom, 6));
+    TEST_ASSERT(exp_data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(24, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(data + 11, (uint8_t *)pkt->data + 11, 13));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_take_headroom__pkt_users_2(void)
+{
+    gnrc_pktsnip_t *pkt, *headroom;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING16, sizeof(TEST_STRING16), GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((headroom = gnrc_pktbuf_mark_headroom(pkt, 8)));
+    gnrc_pktbuf_hold(pkt, 1);
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, gnrc_pktbuf_take_headroom(pkt, headroom, 8));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING16) - 8, pkt->size);
+    gnrc_pktbuf_release(pkt);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_take_headroom__headroom_users_2(void)
+{
+    gnrc_pktsnip_t *pkt, *headroom;
+
+    pkt = gnrc_pktbuf_add(NULL, TEST_STRING64, sizeof(TEST_STRING64), GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((headroom = gnrc_pktbuf_mark_headroom(pkt, 16)));
+    gnrc_pktbuf_hold(headroom, 1);
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, gnrc_pktbuf_take_headroom(pkt, headroom, 8));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING64) - 16, pkt->size);
+    gnrc_pktbuf_release(headroom);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_take_headroom__other_pkt(void)
+{
+    gnrc_pktsnip_t *pkt1, *pkt2, *headroom2;
+
+    pkt1 = gnrc_pktbuf_add(NULL, TEST_STRING64, sizeof(TEST_STRING64), GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt1);
+    TEST_ASSERT_NOT_NULL(gnrc_pktbuf_mark_headroom(pkt1, 16));
+    pkt2 = gnrc_pktbuf_add(NULL, TEST_STRING64, sizeof(TEST_STRING64), GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt2);
+    TEST_ASSERT_NOT_NULL((headroom2 = gnrc_pktbuf_mark_headroom(pkt2, 16)));
+    /* the headroom of pkt2 is not in front of pkt1 */
+    TEST_ASSERT_EQUAL_INT(-ENOSPC, gnrc_pktbuf_take_headroom(pkt1, headroom2, 8));
+    TEST_ASSERT_EQUAL_INT(sizeof(TEST_STRING64) - 16, pkt1->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(TEST_STRING64 + 16, pkt1->data, pkt1->size));
+    gnrc_pktbuf_release(pkt1);
+    gnrc_pktbuf_release(pkt2);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif /* MODULE_GNRC_PKTBUF_MALLOC */
+
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
 static void test_pktbuf_merge_data__memfull(void)
 {
@@ -900,6 +1004,13 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_realloc_data__success),
         new_TestFixture(test_pktbuf_realloc_data__success2),
         new_TestFixture(test_pktbuf_realloc_data__success3),
+        new_TestFixture(test_pktbuf_mark_headroom__size_too_large),
+#ifndef MODULE_GNRC_PKTBUF_MALLOC
+        new_TestFixture(test_pktbuf_take_headroom__success),
+        new_TestFixture(test_pktbuf_take_headroom__pkt_users_2),
+        new_TestFixture(test_pktbuf_take_headroom__headroom_users_2),
+        new_TestFixture(test_pktbuf_take_headroom__other_pkt),
+#endif /* MODULE_GNRC_PKTBUF_MALLOC */
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_merge_data__memfull),
 #endif /* MODULE_GNRC_PKTBUF_MALLOC */
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit/embUnit.h"
+
+#include "container.h"
+#include "spscrb.h"
+#include "tests-spscrb.h"
+
+#define TEST_INPUT          (0xdb)
+#define BUFFER_SIZE         (16U)
+#define OFFSET              (5U)
+
+typedef struct {
+    uint32_t a;
+    uint16_t b;
+} test_obj_t;
+
+static uint8_t _buffer[BUFFER_SIZE];
+static uint8_t _io_buffer[BUFFER_SIZE * 2];
+static spscrb_t _rb = SPSCRB_INIT(_buffer);
+static test_obj_t _objs[BUFFER_SIZE / 2];
+static test_obj_t _io_objs[BUFFER_SIZE];
+static spscrb_obj_t _obj_rb = SPSCRB_OBJ_INIT(_objs);
+
+static void set_up(void)
+{
+    for (unsigned i = 0; i < sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(_io_objs); i++) {
+        _io_objs[i] = (test_obj_t){ .a = TEST_INPUT * i, .b = i };
+    }
+    memset(_buffer, 0, sizeof(_buffer));
+    spscrb_init(&_rb, _buffer, sizeof(_buffer));
+    spscrb_obj_init(&_obj_rb, _objs, sizeof(_objs[0]), ARRAY_SIZE(_objs));
+}
+
+/* move the read and write positions to OFFSET, so data wraps around */
+static void _offset(void)
+{
+    TEST_ASSERT_EQUAL_INT(OFFSET, spscrb_write(&_rb, _io_buffer, OFFSET));
+    TEST_ASSERT_EQUAL_INT(OFFSET, spscrb_read(&_rb, NULL, OFFSET));
+    TEST_ASSERT(spscrb_empty(&_rb));
+}
+
+static void test_avail_free(void)
+{
+    TEST_ASSERT(spscrb_empty(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_free(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_write(&_rb, _io_buffer,
+                                                    sizeof(_io_buffer)));
+    TEST_ASSERT(spscrb_full(&_rb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_avail(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_free(&_rb));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_write(&_rb, _io_buffer, 1));
+}
+
+static void test_reserve_commit(void)
+{
+    uint8_t *data;
+
+    _offset();
+    /* free space is split at the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - OFFSET, spscrb_reserve(&_rb, &data));
+    TEST_ASSERT(data == &_buffer[OFFSET]);
+    memcpy(data, _io_buffer, BUFFER_SIZE - OFFSET);
+    spscrb_commit(&_rb, BUFFER_SIZE - OFFSET);
+    TEST_ASSERT_EQUAL_INT(OFFSET, spscrb_reserve(&_rb, &data));
+    TEST_ASSERT(data == &_buffer[0]);
+    memcpy(data, &_io_buffer[BUFFER_SIZE - OFFSET], 2);
+    spscrb_commit(&_rb, 2);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - OFFSET + 2, spscrb_avail(&_rb));
+
+    memset(&_io_buffer[BUFFER_SIZE], 0, BUFFER_SIZE);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - OFFSET + 2,
+                          spscrb_read(&_rb, &_io_buffer[BUFFER_SIZE],
+                                      BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_io_buffer, &_io_buffer[BUFFER_SIZE],
+                                    BUFFER_SIZE - OFFSET + 2));
+}
+
+static void test_peek_release(void)
+{
+    const uint8_t *data;
+
+    TEST_ASSERT_EQUAL_INT(0, spscrb_peek(&_rb, &data));
+    _offset();
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_write(&_rb, _io_buffer,
+                                                    BUFFER_SIZE));
+    /* data is split at the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - OFFSET, spscrb_peek(&_rb, &data));
+    TEST_ASSERT(data == &_buffer[OFFSET]);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_io_buffer, data, BUFFER_SIZE - OFFSET));
+    spscrb_release(&_rb, BUFFER_SIZE - OFFSET);
+    TEST_ASSERT_EQUAL_INT(OFFSET, spscrb_peek(&_rb, &data));
+    TEST_ASSERT(data == &_buffer[0]);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_io_buffer[BUFFER_SIZE - OFFSET], data,
+                                    OFFSET));
+    spscrb_release(&_rb, OFFSET);
+    TEST_ASSERT(spscrb_empty(&_rb));
+}
+
+static void test_write_read(void)
+{
+    uint8_t out[BUFFER_SIZE];
+
+    _offset();
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_write(&_rb, _io_buffer,
+                                                    sizeof(_io_buffer)));
+    memset(out, 0, sizeof(out));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, spscrb_copy(&_rb, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_io_buffer, out, sizeof(out)));
+    TEST_ASSERT(spscrb_full(&_rb));
+    memset(out, 0, sizeof(out));
+    TEST_ASSERT_EQUAL_INT(3, spscrb_read(&_rb, out, 3));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, spscrb_read(&_rb, &out[3],
+                                                       sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_io_buffer, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_read(&_rb, out, sizeof(out)));
+}
+
+static void test_obj(void)
+{
+    test_obj_t out[ARRAY_SIZE(_objs)];
+    void *slots;
+
+    /* move positions to the middle, so objects wrap around */
+    TEST_ASSERT_EQUAL_INT(3, spscrb_obj_write(&_obj_rb, _io_objs, 3));
+    TEST_ASSERT_EQUAL_INT(3, spscrb_obj_read(&_obj_rb, out, 3));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_io_objs, out, 3 * sizeof(out[0])));
+
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_objs) - 3,
+                          spscrb_obj_reserve(&_obj_rb, &slots));
+    TEST_ASSERT(slots == &_objs[3]);
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_objs),
+                          spscrb_obj_write(&_obj_rb, _io_objs,
+                                           ARRAY_SIZE(_io_objs)));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_obj_free(&_obj_rb));
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_objs) - 3,
+                          spscrb_obj_peek(&_obj_rb, &slots));
+    TEST_ASSERT(slots == &_objs[3]);
+    spscrb_obj_release(&_obj_rb, 1);
+
+    memset(out, 0, sizeof(out));
+    TEST_ASSERT_EQUAL_INT(ARRAY_SIZE(_objs) - 1,
+                          spscrb_obj_read(&_obj_rb, out, ARRAY_SIZE(out)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&_io_objs[1], out,
+                                    (ARRAY_SIZE(_objs) - 1) * sizeof(out[0])));
+    TEST_ASSERT_EQUAL_INT(0, spscrb_obj_avail(&_obj_rb));
+}
+
+static Test *tests_spscrb_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_avail_free),
+        new_TestFixture(test_reserve_commit),
+        new_TestFixture(test_peek_release),
+        new_TestFixture(test_write_read),
+        new_TestFixture(test_obj),
+    };
+
+    EMB_UNIT_TESTCALLER(spscrb_tests, set_up, NULL, fixtures);
+
+    return (Test *)&spscrb_tests;
+}
+
+void tests_spscrb(void)
+{
+    TESTS_RUN(tests_spscrb_tests());
+}
+/** @} */
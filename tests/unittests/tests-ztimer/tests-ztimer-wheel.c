@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ztimer timer wheel
+ */
+
+#include <string.h>
+
+#include "container.h"
+#include "ztimer.h"
+#include "ztimer/mock.h"
+#include "ztimer/wheel.h"
+
+#include "embUnit/embUnit.h"
+
+#include "tests-ztimer.h"
+
+#define WHEEL_SHIFT     (2U)
+#define WHEEL_SPAN      (1LU << (WHEEL_SHIFT + \
+                                 (CONFIG_ZTIMER_WHEEL_LEVELS * ZTIMER_WHEEL_SLOT_BITS)))
+/* time after which all timers set by these tests have triggered */
+#define WHEEL_ALL_DONE  ((8 * WHEEL_SPAN) + (1LU << (WHEEL_SHIFT + 10)))
+
+typedef struct {
+    ztimer_t timer;
+    ztimer_mock_t *mock;
+    uint32_t target;
+    uint32_t fired_at;
+    unsigned fired;
+} wheel_test_timer_t;
+
+static ztimer_mock_t zmock;
+static ztimer_wheel_t wheel;
+static wheel_test_timer_t timers[96];
+static uint32_t rand_state;
+
+static uint32_t _rand(void)
+{
+    /* deterministic LCG, good enough to spread timers over the wheel */
+    rand_state = (rand_state * 1103515245U) + 12345U;
+    return rand_state >> 1;
+}
+
+static void _cb(void *arg)
+{
+    wheel_test_timer_t *t = arg;
+
+    t->fired_at = t->mock->now;
+    t->fired++;
+}
+
+static void _init(unsigned width)
+{
+    ztimer_mock_init(&zmock, width);
+    ztimer_wheel_init(&zmock.super, &wheel, WHEEL_SHIFT);
+    rand_state = width;
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        timers[i] = (wheel_test_timer_t){
+            .timer = { .callback = _cb, .arg = &timers[i] },
+            .mock = &zmock,
+        };
+    }
+}
+
+static void _set(wheel_test_timer_t *t, uint32_t val)
+{
+    t->target = ztimer_set(&zmock.super, &t->timer, val) + val;
+    if (zmock.mask < UINT32_MAX) {
+        t->target &= zmock.mask;
+    }
+}
+
+/* offsets from within the first wheel slot to beyond the span of the wheel */
+static uint32_t _rand_offset(unsigned i)
+{
+    switch (i % 4) {
+    case 0:
+        return _rand() % (1U << WHEEL_SHIFT);
+    case 1:
+        return _rand() % (1U << (WHEEL_SHIFT + 8));
+    case 2:
+        return _rand() % WHEEL_SPAN;
+    default:
+        return WHEEL_SPAN + (_rand() % (4 * WHEEL_SPAN));
+    }
+}
+
+static void _check_all_fired_on_time(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        if (timers[i].target == UINT32_MAX) {
+            /* removed */
+            TEST_ASSERT_EQUAL_INT(0, timers[i].fired);
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(1, timers[i].fired);
+        TEST_ASSERT_EQUAL_INT(timers[i].target, timers[i].fired_at);
+        TEST_ASSERT(!ztimer_is_set(&zmock.super, &timers[i].timer));
+    }
+    TEST_ASSERT(ztimer_wheel_is_empty(&wheel));
+    TEST_ASSERT_NULL(zmock.super.list.next);
+}
+
+static void test_ztimer_wheel_set(void)
+{
+    _init(32);
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        _set(&timers[i], _rand_offset(i));
+        TEST_ASSERT(ztimer_is_set(&zmock.super, &timers[i].timer));
+        /* spread the set operations over time */
+        ztimer_mock_advance(&zmock, _rand() % 64);
+    }
+    ztimer_mock_advance(&zmock, WHEEL_ALL_DONE);
+    _check_all_fired_on_time();
+}
+
+static void test_ztimer_wheel_remove(void)
+{
+    _init(32);
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        _set(&timers[i], _rand_offset(i));
+    }
+    /* re-set and remove some of the timers while the wheel advances */
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        if (timers[i].fired) {
+            continue;
+        }
+        if (i % 3 == 0) {
+            TEST_ASSERT(ztimer_remove(&zmock.super, &timers[i].timer));
+            TEST_ASSERT(!ztimer_is_set(&zmock.super, &timers[i].timer));
+            timers[i].target = UINT32_MAX;
+        }
+        else if (i % 3 == 1) {
+            _set(&timers[i], _rand_offset(i + 1));
+        }
+        ztimer_mock_advance(&zmock, _rand() % (1U << (WHEEL_SHIFT + 6)));
+    }
+    ztimer_mock_advance(&zmock, WHEEL_ALL_DONE);
+    _check_all_fired_on_time();
+}
+
+static void test_ztimer_wheel_set_after_idle(void)
+{
+    _init(32);
+    /* the wheel only wakes up for the far timer, setting a near one after a
+     * while must not wait for that */
+    _set(&timers[0], 3 * (1U << (WHEEL_SHIFT + 8)));
+    ztimer_mock_advance(&zmock, 2 * (1U << (WHEEL_SHIFT + 8)) + 5);
+    TEST_ASSERT_EQUAL_INT(0, timers[0].fired);
+    _set(&timers[1], 1);
+    _set(&timers[2], (1U << WHEEL_SHIFT) + 1);
+    ztimer_mock_advance(&zmock, (1U << WHEEL_SHIFT) + 1);
+    TEST_ASSERT_EQUAL_INT(1, timers[1].fired);
+    TEST_ASSERT_EQUAL_INT(1, timers[2].fired);
+    TEST_ASSERT_EQUAL_INT(0, timers[0].fired);
+    for (unsigned i = 3; i < ARRAY_SIZE(timers); i++) {
+        timers[i].target = UINT32_MAX;
+    }
+    ztimer_mock_advance(&zmock, WHEEL_ALL_DONE);
+    _check_all_fired_on_time();
+}
+
+static void test_ztimer_wheel_extend(void)
+{
+    _init(16);
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        _set(&timers[i], _rand_offset(i));
+    }
+    ztimer_mock_advance(&zmock, WHEEL_ALL_DONE);
+    _check_all_fired_on_time();
+}
+
+static void _count_cb(void *arg)
+{
+    unsigned *count = arg;
+
+    (*count)++;
+}
+
+static void test_ztimer_wheel_remove_never_set(void)
+{
+    ztimer_t timer;
+    uintptr_t stale[4];
+    unsigned count = 0;
+
+    _init(32);
+    for (unsigned i = 0; i < ARRAY_SIZE(timers); i++) {
+        _set(&timers[i], WHEEL_SPAN / 2 + i);
+    }
+    /* model stale stack contents, every pointer of the timer leads to
+     * readable memory that does not link back to it */
+    memset(stale, 0xa5, sizeof(stale));
+    for (unsigned i = 0; i < sizeof(timer) / sizeof(uintptr_t); i++) {
+        uintptr_t garbage = (uintptr_t)&stale[i % ARRAY_SIZE(stale)];
+
+        memcpy((uint8_t *)&timer + (i * sizeof(garbage)), &garbage,
+               sizeof(garbage));
+    }
+    TEST_ASSERT(!ztimer_is_set(&zmock.super, &timer));
+    TEST_ASSERT(!ztimer_remove(&zmock.super, &timer));
+    for (unsigned i = 0; i < ARRAY_SIZE(stale); i++) {
+        TEST_ASSERT(stale[i] == (uintptr_t)0xa5a5a5a5a5a5a5a5ULL);
+    }
+    timer.callback = _count_cb;
+    timer.arg = &count;
+    ztimer_set(&zmock.super, &timer, 3 * (1U << (WHEEL_SHIFT + 8)));
+    TEST_ASSERT(ztimer_is_set(&zmock.super, &timer));
+    ztimer_mock_advance(&zmock, WHEEL_ALL_DONE);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    _check_all_fired_on_time();
+}
+
+Test *tests_ztimer_wheel_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_ztimer_wheel_set),
+        new_TestFixture(test_ztimer_wheel_remove),
+        new_TestFixture(test_ztimer_wheel_set_after_idle),
+        new_TestFixture(test_ztimer_wheel_extend),
+        new_TestFixture(test_ztimer_wheel_remove_never_set),
+    };
+
+    EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);
+
+    return (Test *)&ztimer_tests;
+}
+
+/** @} */